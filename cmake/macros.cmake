@@ -94,3 +94,9 @@ macro(add_tests_if_enabled TEST_FOLDER_NAME)
         add_subdirectory(${TEST_FOLDER_NAME})
     endif ()
 endmacro()
+
+macro(add_benchmarks_if_enabled BENCHMARK_FOLDER_NAME)
+    if (NES_ENABLE_BENCHMARKS)
+        add_subdirectory(${BENCHMARK_FOLDER_NAME})
+    endif ()
+endmacro()
@@ -0,0 +1,58 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <benchmark/benchmark.h>
+#include <spdlog/common.h>
+
+/// This Benchmark compares the throughput of worker threads that log an INFO message per task against worker threads with disabled logging.
+/// A task is simulated by a loop over state.range(0) tuples. The logger is called directly, as benchmark builds remove all NES_INFO calls
+/// at compile time.
+template <NES::LogLevel Level, NES::LogOverflowPolicy OverflowPolicy>
+static void BM_WorkerTaskWithInfoLogging(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        NES::Logger::setupLogging("LoggerBenchmark.log", Level, false, OverflowPolicy);
+    }
+
+    uint64_t tupleSum = 0;
+    uint64_t taskId = 0;
+    for (auto _ : state)
+    {
+        for (int64_t tuple = 0; tuple < state.range(0); ++tuple)
+        {
+            tupleSum += tuple;
+            benchmark::DoNotOptimize(tupleSum);
+        }
+        NES::Logger::getInstance()->info(
+            spdlog::source_loc{__FILE__, __LINE__, SPDLOG_FUNCTION}, "Processed task {} with tuple sum {}", ++taskId, tupleSum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    if (state.thread_index() == 0)
+    {
+        NES::Logger::getInstance()->forceFlush();
+    }
+}
+
+/// Register the function as a benchmark
+BENCHMARK_TEMPLATE(BM_WorkerTaskWithInfoLogging, NES::LogLevel::LOG_NONE, NES::LogOverflowPolicy::BLOCK)->Arg(1000)->ThreadRange(1, 16);
+BENCHMARK_TEMPLATE(BM_WorkerTaskWithInfoLogging, NES::LogLevel::LOG_INFO, NES::LogOverflowPolicy::BLOCK)->Arg(1000)->ThreadRange(1, 16);
+BENCHMARK_TEMPLATE(BM_WorkerTaskWithInfoLogging, NES::LogLevel::LOG_INFO, NES::LogOverflowPolicy::DROP)->Arg(1000)->ThreadRange(1, 16);
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,73 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Sequencing/NonBlockingMonotonicSeqQueue.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <benchmark/benchmark.h>
+
+/// This benchmark measures concurrent emplaces into the NonBlockingMonotonicSeqQueue, as done by the watermark processors of all worker
+/// threads. Every thread takes a batch of consecutive sequence numbers and emplaces them in a random order, thus, the queue receives
+/// sequence numbers out-of-order within a batch and across threads. As the current sequence number moves across many blocks, the
+/// benchmark also covers appending and recycling blocks.
+
+namespace
+{
+constexpr uint64_t SEQUENCE_NUMBERS_PER_BATCH = 64;
+
+std::unique_ptr<NES::Sequencing::NonBlockingMonotonicSeqQueue<uint64_t>> queue;
+std::atomic<uint64_t> nextSequenceNumber;
+}
+
+static void BM_ConcurrentOutOfOrderEmplace(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        queue = std::make_unique<NES::Sequencing::NonBlockingMonotonicSeqQueue<uint64_t>>();
+        nextSequenceNumber = NES::SequenceNumber::INITIAL;
+    }
+
+    std::mt19937_64 generator(state.thread_index());
+    std::vector<uint64_t> batch(SEQUENCE_NUMBERS_PER_BATCH);
+    for (auto _ : state)
+    {
+        const auto firstSequenceNumber = nextSequenceNumber.fetch_add(SEQUENCE_NUMBERS_PER_BATCH);
+        std::ranges::generate(batch, [sequenceNumber = firstSequenceNumber]() mutable { return sequenceNumber++; });
+        std::ranges::shuffle(batch, generator);
+        for (const auto sequenceNumber : batch)
+        {
+            queue->emplace(
+                NES::SequenceData{NES::SequenceNumber(sequenceNumber), NES::INITIAL_CHUNK_NUMBER, true}, sequenceNumber);
+        }
+        benchmark::DoNotOptimize(queue->getCurrentValue());
+    }
+    state.SetItemsProcessed(state.iterations() * SEQUENCE_NUMBERS_PER_BATCH);
+
+    if (state.thread_index() == 0)
+    {
+        queue.reset();
+    }
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_ConcurrentOutOfOrderEmplace)->ThreadRange(16, 64)->UseRealTime();
+
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -21,10 +21,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Sequencing/ChunkCollector.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <Time/Timestamp.hpp>
+#include <folly/Synchronized.h>
 #include <ErrorHandling.hpp>
 
 namespace NES::Sequencing
@@ -48,6 +50,12 @@ namespace NES::Sequencing
 ///
 /// GetCurrentValue will return the following sequence of current values:
 /// [<1,T1>,<2,T2>,<2,T2>,<2,T2>,<2,T2>,<4,T6>,<7,T7>]
+///
+/// Blocks are linked via raw pointers and are recycled instead of being freed, once the current sequence number has moved past them.
+/// As other threads might still traverse a block that has been unlinked from the list, we use epoch-based reclamation: every operation
+/// registers itself in the current epoch, and an unlinked block is only recycled after the epoch has advanced twice, i.e., after all
+/// operations that could have observed the block have finished. Thus, in a steady state, the queue neither allocates blocks nor updates
+/// reference counts.
 template <class T, uint64_t BlockSize = 8192>
 class NonBlockingMonotonicSeqQueue
 {
@@ -61,27 +69,81 @@ private:
 
     /// @brief Block of values, which is one element in the linked-list.
     /// If the next block exists *next* contains the reference.
+    /// A recycled block keeps the sequence numbers of its previous use. As block indexes only increase, these can never match a
+    /// sequence number of the new block index, and thus do not have to be reset.
     class Block
     {
     public:
         explicit Block(size_t blockIndex) : blockIndex(blockIndex) { };
         ~Block() = default;
-        const size_t blockIndex;
+        size_t blockIndex;
         std::array<Container, BlockSize> log = {};
-        std::shared_ptr<Block> next = std::shared_ptr<Block>();
+        std::atomic<Block*> next = nullptr;
+    };
+
+    struct RetiredBlock
+    {
+        Block* block;
+        uint64_t retiredInEpoch;
+    };
+
+    /// Owns all blocks of the queue. Blocks are only requested and retired when the queue crosses a block boundary, i.e., once every
+    /// BlockSize sequence numbers, thus, the pool is protected by a lock.
+    struct BlockPool
+    {
+        std::vector<std::unique_ptr<Block>> blocks;
+        std::vector<RetiredBlock> retiredBlocks;
+        std::vector<Block*> unusedBlocks;
+    };
+
+    /// Counts the operations that have registered themselves in an epoch with the given parity.
+    struct alignas(64) ActiveOperations
+    {
+        std::atomic<uint64_t> counter = 0;
+    };
+
+    /// @brief Registers an operation in the current epoch for its lifetime.
+    /// While the guard exists, no block that was reachable from the head during its lifetime gets recycled.
+    class EpochGuard
+    {
+    public:
+        explicit EpochGuard(const NonBlockingMonotonicSeqQueue& queue) : queue(queue)
+        {
+            while (true)
+            {
+                epoch = queue.globalEpoch.load();
+                queue.activeOperations[epoch % 2].counter.fetch_add(1);
+                /// If the epoch has advanced in the meantime, the epoch might already wait for operations of the other parity to finish
+                if (queue.globalEpoch.load() == epoch)
+                {
+                    return;
+                }
+                queue.activeOperations[epoch % 2].counter.fetch_sub(1);
+            }
+        }
+
+        EpochGuard(const EpochGuard&) = delete;
+        EpochGuard(EpochGuard&&) = delete;
+        EpochGuard& operator=(const EpochGuard&) = delete;
+        EpochGuard& operator=(EpochGuard&&) = delete;
+
+        ~EpochGuard() { queue.activeOperations[epoch % 2].counter.fetch_sub(1, std::memory_order::release); }
+
+    private:
+        const NonBlockingMonotonicSeqQueue& queue;
+        uint64_t epoch = 0;
     };
 
 public:
-    NonBlockingMonotonicSeqQueue() : head(std::make_shared<Block>(0)), currentSeq(0) { }
+    NonBlockingMonotonicSeqQueue() : head(allocateBlock(0)), currentSeq(0) { }
 
     ~NonBlockingMonotonicSeqQueue() = default;
 
-    NonBlockingMonotonicSeqQueue& operator=(const NonBlockingMonotonicSeqQueue& other)
-    {
-        head = other.head;
-        currentSeq = other.currentSeq.load();
-        return *this;
-    }
+    /// Blocks are owned by the queue and can not be shared with another queue
+    NonBlockingMonotonicSeqQueue(const NonBlockingMonotonicSeqQueue&) = delete;
+    NonBlockingMonotonicSeqQueue(NonBlockingMonotonicSeqQueue&&) = delete;
+    NonBlockingMonotonicSeqQueue& operator=(const NonBlockingMonotonicSeqQueue&) = delete;
+    NonBlockingMonotonicSeqQueue& operator=(NonBlockingMonotonicSeqQueue&&) = delete;
 
     void emplace(SequenceData sequenceData, T newValue)
     {
@@ -93,6 +155,7 @@ public:
                 "Invalid sequenceNumber: {} has already been seen. Current Sequence: {}",
                 sequenceNumber,
                 currentSeq);
+            const EpochGuard guard(*this);
             /// First emplace the value to the specific block of the sequenceNumber.
             /// After this call it is safe to assume that a block, which contains the sequenceNumber exists.
             emplaceValueInBlock(sequenceNumber.getRawValue(), value.getRawValue());
@@ -106,7 +169,8 @@ public:
     /// @return T value
     auto getCurrentValue() const
     {
-        auto currentBlock = std::atomic_load(&head);
+        const EpochGuard guard(*this);
+        auto* currentBlock = head.load();
         /// get the current sequence number and access the associated block
         auto currentSequenceNumber = currentSeq.load();
         auto targetBlockIndex = currentSequenceNumber / BlockSize;
@@ -133,16 +197,20 @@ private:
         /// Calculate the target block index, which contains the sequence number
         auto targetBlockIndex = seq / BlockSize;
         /// Lookup the current block
-        auto currentBlock = std::atomic_load(&head);
+        auto* currentBlock = head.load();
         /// if the blockIndex is smaller the target block index we travers the next block
         while (currentBlock->blockIndex < targetBlockIndex)
         {
             /// append new block if the next block is a nullptr
-            auto nextBlock = std::atomic_load(&currentBlock->next);
+            auto* nextBlock = currentBlock->next.load();
             if (nextBlock == nullptr)
             {
-                auto newBlock = std::make_shared<Block>(currentBlock->blockIndex + 1);
-                std::atomic_compare_exchange_weak(&currentBlock->next, &nextBlock, newBlock);
+                auto* newBlock = allocateBlock(currentBlock->blockIndex + 1);
+                if (not currentBlock->next.compare_exchange_strong(nextBlock, newBlock))
+                {
+                    /// Another thread has appended a block. As no other thread has seen our block, it can be reused without waiting.
+                    releaseUnusedBlock(newBlock);
+                }
                 /// we don't care if this or another thread succeeds, as we just start over again in the loop
                 /// and use what ever is now stored in currentBlock.next
             }
@@ -165,24 +233,23 @@ private:
             ((currentBlock->blockIndex * BlockSize) + BlockSize));
 
         /// Emplace value in block
-        /// It is safe to perform this operation without atomics as no other thread can't have the same sequence number,
-        /// and thus can't modify this value.
-        /// Concurrent can also not happen yet as the currentSeq is only modified in shiftCurrent.
+        /// No other thread can have the same sequence number, and thus can't modify this value.
+        /// The sequence number gets published after the value, as other threads read the value once they have seen the sequence number.
         auto seqIndexInBlock = seq % BlockSize;
-        currentBlock->log[seqIndexInBlock].seq.store(seq, std::memory_order::relaxed);
         currentBlock->log[seqIndexInBlock].value.store(value, std::memory_order::relaxed);
+        currentBlock->log[seqIndexInBlock].seq.store(seq, std::memory_order::release);
     }
 
     /// @brief This method shifts tries to shift the current value.
     /// To this end, it checks if the next expected sequence number (currentSeq + 1) is already inserted.
     /// If the next sequence number is available it replaces the currentSeq with the next one.
-    /// If the next sequence number is in a new block this method also replaces the pointer to the next block.
+    /// If the next sequence number is in a new block this method also moves the head to the next block.
     void shiftCurrentValue()
     {
         auto checkForUpdate = true;
         while (checkForUpdate)
         {
-            auto currentBlock = std::atomic_load(&head);
+            auto* currentBlock = head.load();
             /// we are looking for the next sequence number
             auto currentSequenceNumber = currentSeq.load();
             /// find the correct block, that contains the current sequence number.
@@ -195,17 +262,17 @@ private:
             if (nextSeqNumber % BlockSize == 0)
             {
                 /// the next sequence number is the first element in the next block.
-                auto nextBlock = std::atomic_load(&currentBlock->next);
+                auto* nextBlock = currentBlock->next.load();
                 if (nextBlock != nullptr)
                 {
                     /// this will always be the first element
                     auto& value = nextBlock->log[0];
-                    if (value.seq.load(std::memory_order::relaxed) == nextSeqNumber)
+                    if (value.seq.load(std::memory_order::acquire) == nextSeqNumber)
                     {
-                        /// Modify currentSeq and head
-                        if (std::atomic_compare_exchange_weak(&currentSeq, &currentSequenceNumber, nextSeqNumber))
+                        /// Modify currentSeq and move the head to the block of the new currentSeq
+                        if (currentSeq.compare_exchange_weak(currentSequenceNumber, nextSeqNumber))
                         {
-                            std::atomic_compare_exchange_weak(&head, &currentBlock, nextBlock);
+                            advanceHead();
                         }
                         continue;
                     }
@@ -215,10 +282,10 @@ private:
             {
                 auto seqIndexInBlock = nextSeqNumber % BlockSize;
                 auto& value = currentBlock->log[seqIndexInBlock];
-                if (value.seq == nextSeqNumber)
+                if (value.seq.load(std::memory_order::acquire) == nextSeqNumber)
                 {
                     /// the next sequence number is still in the current block thus we only have to exchange the currentSeq.
-                    std::atomic_compare_exchange_weak(&currentSeq, &currentSequenceNumber, nextSeqNumber);
+                    currentSeq.compare_exchange_weak(currentSequenceNumber, nextSeqNumber);
                     continue;
                 }
             }
@@ -226,17 +293,35 @@ private:
         }
     }
 
+    /// @brief Moves the head to the block of the current sequence number and retires all blocks in front of it.
+    /// Threads that crossed a block boundary concurrently might call this out of order. Thus, every thread moves the head as far as
+    /// required, and the thread that unlinks a block is the only one to retire it.
+    void advanceHead()
+    {
+        auto* currentHead = head.load();
+        while (currentHead->blockIndex < currentSeq.load() / BlockSize)
+        {
+            auto* nextBlock = currentHead->next.load();
+            INVARIANT(nextBlock != nullptr, "Block {} must exist, as it contains the current sequence number", currentHead->blockIndex + 1);
+            if (head.compare_exchange_strong(currentHead, nextBlock))
+            {
+                retireBlock(currentHead);
+                currentHead = nextBlock;
+            }
+        }
+    }
+
     /// @brief This function traverses the linked list of blocks, till the target block index is found.
     /// It assumes, that the target block index exists. If not, the function throws an Invariant.
     /// @param currentBlock the start block, usually the head.
     /// @param targetBlockIndex the target address
     /// @return the found block, which contains the target block index.
-    std::shared_ptr<Block> getTargetBlock(std::shared_ptr<Block> currentBlock, uint64_t targetBlockIndex) const
+    Block* getTargetBlock(Block* currentBlock, uint64_t targetBlockIndex) const
     {
         while (currentBlock->blockIndex < targetBlockIndex)
         {
             /// append new block if the next block is a nullptr
-            auto nextBlock = std::atomic_load(&currentBlock->next);
+            auto* nextBlock = currentBlock->next.load();
             PRECONDITION(nextBlock, "Number of blocks in queue is smaller than targetBlockIndex: {}", targetBlockIndex);
             /// move to the next block
             currentBlock = nextBlock;
@@ -244,8 +329,61 @@ private:
         return currentBlock;
     }
 
+    /// @brief Returns a block for the block index. Reuses a retired block, if no operation can observe it anymore.
+    Block* allocateBlock(size_t blockIndex)
+    {
+        tryAdvanceEpoch();
+        auto lockedPool = pool.wlock();
+        if (not lockedPool->unusedBlocks.empty())
+        {
+            auto* block = lockedPool->unusedBlocks.back();
+            lockedPool->unusedBlocks.pop_back();
+            block->blockIndex = blockIndex;
+            return block;
+        }
+        const auto epoch = globalEpoch.load();
+        /// Operations of the epoch, in which a block was retired, and of all prior epochs have finished after two epoch advances
+        const auto reusableBlock = std::ranges::find_if(
+            lockedPool->retiredBlocks, [epoch](const RetiredBlock& retiredBlock) { return retiredBlock.retiredInEpoch + 2 <= epoch; });
+        if (reusableBlock != lockedPool->retiredBlocks.end())
+        {
+            auto* block = reusableBlock->block;
+            *reusableBlock = lockedPool->retiredBlocks.back();
+            lockedPool->retiredBlocks.pop_back();
+            block->blockIndex = blockIndex;
+            block->next.store(nullptr, std::memory_order::relaxed);
+            return block;
+        }
+        return lockedPool->blocks.emplace_back(std::make_unique<Block>(blockIndex)).get();
+    }
+
+    /// @brief Retires a block, which has been unlinked from the list of blocks.
+    void retireBlock(Block* block)
+    {
+        pool.wlock()->retiredBlocks.emplace_back(block, globalEpoch.load());
+        tryAdvanceEpoch();
+    }
+
+    /// @brief Returns a block, which has never been linked into the list of blocks, to the pool.
+    void releaseUnusedBlock(Block* block) { pool.wlock()->unusedBlocks.emplace_back(block); }
+
+    /// @brief Advances the epoch, if no operation of the previous epoch is active anymore.
+    void tryAdvanceEpoch()
+    {
+        auto epoch = globalEpoch.load();
+        if (activeOperations[(epoch + 1) % 2].counter.load() == 0)
+        {
+            globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+        }
+    }
+
+    /// Owns all blocks. The pool and the epoch are declared before the head, as they provide the initial head block.
+    folly::Synchronized<BlockPool> pool;
+    /// Epoch for the reclamation of blocks and the number of active operations per parity of the epoch
+    std::atomic<uint64_t> globalEpoch = 0;
+    mutable std::array<ActiveOperations, 2> activeOperations;
     /// Stores a reference to the current block
-    std::shared_ptr<Block> head;
+    std::atomic<Block*> head;
     /// Stores the current sequence number
     std::atomic<SequenceNumber::Underlying> currentSeq;
     ChunkCollector<BlockSize> chunks;
@@ -0,0 +1,34 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace NES
+{
+/// Layout of the hash maps that store the aggregation states of a slice of a windowed aggregation
+enum class AggregationSliceLayout : uint8_t
+{
+    /// Each worker thread aggregates into its own hash map. Workers never synchronize, but each group is stored once per worker thread
+    /// and the trigger has to combine all copies of a group.
+    PER_WORKER,
+    /// All worker threads aggregate into hash maps that they share. The hash maps partition the groups by their hash and are locked
+    /// during an update. Thus, each group is stored once per slice, which pays off for many distinct keys.
+    SHARED,
+    /// Chooses the layout of each aggregation during lowering based on the estimated number of distinct keys.
+    OPTIMIZER_CHOOSES
+};
+}
@@ -0,0 +1,39 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <ostream>
+#include <Util/Logger/Formatter.hpp>
+
+namespace NES
+{
+/// Options of the JIT compiler that is used in the compiler execution mode.
+/// They are recorded in the compiled query plan, so that the generated code of a query can be reproduced.
+struct CompilationOptions
+{
+    /// Recompiles a pipeline in the background after a warm-up, so that the recompiled pipeline is specialized for the runtime
+    /// statistics of the operators, e.g., the selectivity of an adaptive selection.
+    bool profileGuidedRecompilation = false;
+
+    friend bool operator==(const CompilationOptions&, const CompilationOptions&) = default;
+
+    friend std::ostream& operator<<(std::ostream& os, const CompilationOptions& options)
+    {
+        return os << "CompilationOptions(profileGuidedRecompilation: " << options.profileGuidedRecompilation << ")";
+    }
+};
+}
+
+FMT_OSTREAM(NES::CompilationOptions);
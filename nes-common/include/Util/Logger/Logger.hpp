@@ -59,7 +59,7 @@ struct LogCaller<LogLevel::LOG_INFO>
     template <typename... arguments>
     constexpr static void do_call(spdlog::source_loc&& loc, fmt::format_string<arguments...> format, arguments&&... args)
     {
-        if (auto instance = Logger::getInstance())
+        if (const auto instance = Logger::getInstance())
         {
             instance->info(std::move(loc), std::move(format), std::forward<arguments>(args)...);
         }
@@ -72,7 +72,7 @@ struct LogCaller<LogLevel::LOG_TRACE>
     template <typename... arguments>
     constexpr static void do_call(spdlog::source_loc&& loc, fmt::format_string<arguments...> format, arguments&&... args)
     {
-        if (auto instance = Logger::getInstance())
+        if (const auto instance = Logger::getInstance())
         {
             instance->trace(std::move(loc), std::move(format), std::forward<arguments>(args)...);
         }
@@ -85,7 +85,7 @@ struct LogCaller<LogLevel::LOG_DEBUG>
     template <typename... arguments>
     constexpr static void do_call(spdlog::source_loc&& loc, fmt::format_string<arguments...> format, arguments&&... args)
     {
-        if (auto instance = Logger::getInstance())
+        if (const auto instance = Logger::getInstance())
         {
             instance->debug(std::move(loc), std::move(format), std::forward<arguments>(args)...);
         }
@@ -98,7 +98,7 @@ struct LogCaller<LogLevel::LOG_ERROR>
     template <typename... arguments>
     constexpr static void do_call(spdlog::source_loc&& loc, fmt::format_string<arguments...> format, arguments&&... args)
     {
-        if (auto instance = Logger::getInstance())
+        if (const auto instance = Logger::getInstance())
         {
             instance->error(std::move(loc), std::move(format), std::forward<arguments>(args)...);
         }
@@ -111,7 +111,7 @@ struct LogCaller<LogLevel::LOG_WARNING>
     template <typename... arguments>
     constexpr static void do_call(spdlog::source_loc&& loc, fmt::format_string<arguments...> format, arguments&&... args)
     {
-        if (auto instance = Logger::getInstance())
+        if (const auto instance = Logger::getInstance())
         {
             instance->warn(std::move(loc), std::move(format), std::forward<arguments>(args)...);
         }
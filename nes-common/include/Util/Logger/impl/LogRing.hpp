@@ -0,0 +1,157 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <Identifiers/NESStrongType.hpp>
+#include <fmt/core.h>
+#include <spdlog/common.h>
+
+namespace NES::detail
+{
+
+/// Types whose values are copied into a log record and formatted later by the background thread of the logger.
+/// Other types, e.g., string views, pointers, or objects that refer to shared state, might have changed or be gone by then.
+/// Messages with such arguments are formatted on the calling thread.
+template <typename T>
+concept DeferredFormattable = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::same_as<T, std::string> || NESIdentifier<T>;
+
+/// A log message in the ring of the thread that logged it
+struct LogRecord
+{
+    /// Bytes for the worker id, the thread name, and the log context of the calling thread. Longer contexts are truncated.
+    static constexpr size_t THREAD_CONTEXT_CAPACITY = 96;
+    /// Bytes for the captured arguments. Messages with larger arguments are formatted on the calling thread.
+    static constexpr size_t ARGUMENTS_CAPACITY = 128;
+
+    /// Formats the captured arguments into the buffer and destroys them afterward
+    using FormatFunction = void (*)(std::byte* arguments, fmt::string_view format, spdlog::memory_buf_t& buffer);
+
+    spdlog::log_clock::time_point time;
+    spdlog::source_loc location;
+    spdlog::level::level_enum level = spdlog::level::off;
+    /// Set if the arguments were captured. The format string is a literal of a log macro, thus it outlives the record.
+    FormatFunction formatArguments = nullptr;
+    fmt::string_view format;
+    /// Holds the message, if it was formatted on the calling thread
+    std::string message;
+    size_t threadContextSize = 0;
+    std::array<char, THREAD_CONTEXT_CAPACITY> threadContext{};
+    alignas(std::max_align_t) std::array<std::byte, ARGUMENTS_CAPACITY> arguments{};
+};
+
+template <typename... Arguments>
+using CapturedArguments = std::tuple<std::decay_t<Arguments>...>;
+
+/// Whether the arguments of a log call are copied into the log record, instead of formatting the message on the calling thread
+template <typename... Arguments>
+constexpr bool CAN_CAPTURE_ARGUMENTS = (DeferredFormattable<std::decay_t<Arguments>> && ...)
+    && sizeof(CapturedArguments<Arguments...>) <= LogRecord::ARGUMENTS_CAPACITY
+    && alignof(CapturedArguments<Arguments...>) <= alignof(std::max_align_t);
+
+template <typename Arguments>
+void formatCapturedArguments(std::byte* arguments, const fmt::string_view format, spdlog::memory_buf_t& buffer)
+{
+    auto* captured = std::launder(reinterpret_cast<Arguments*>(arguments));
+    try
+    {
+        std::apply(
+            [&](auto&... values) { fmt::vformat_to(std::back_inserter(buffer), format, fmt::make_format_args(values...)); }, *captured);
+    }
+    catch (...)
+    {
+        std::destroy_at(captured);
+        throw;
+    }
+    std::destroy_at(captured);
+}
+
+/// Copies the arguments into the record, so that the background thread formats the message
+template <typename... Arguments>
+requires(CAN_CAPTURE_ARGUMENTS<Arguments...>)
+void captureArguments(LogRecord& record, const fmt::string_view format, Arguments&&... arguments)
+{
+    new (record.arguments.data()) CapturedArguments<Arguments...>(std::forward<Arguments>(arguments)...);
+    record.format = format;
+    record.formatArguments = &formatCapturedArguments<CapturedArguments<Arguments...>>;
+}
+
+/// Single-producer single-consumer ring of the log records of a thread. The thread that logs is the only producer and the background thread
+/// of the logger is the only consumer, thus reserving and publishing a record only takes an atomic load and store, but no lock.
+class LogRing
+{
+public:
+    static constexpr size_t CAPACITY = 512;
+
+    /// Returns a free record or nullptr, if the ring is full. The record becomes visible to the consumer with publish().
+    LogRecord* tryReserve()
+    {
+        const auto produced = producedRecords.load(std::memory_order::relaxed);
+        if (produced - cachedConsumedRecords == CAPACITY)
+        {
+            cachedConsumedRecords = consumedRecords.load(std::memory_order::acquire);
+            if (produced - cachedConsumedRecords == CAPACITY)
+            {
+                return nullptr;
+            }
+        }
+        return &records[produced % CAPACITY];
+    }
+
+    void publish() { producedRecords.store(producedRecords.load(std::memory_order::relaxed) + 1, std::memory_order::release); }
+
+    /// Returns the oldest published record or nullptr, if the ring is empty. Only called by the consumer.
+    LogRecord* front()
+    {
+        const auto consumed = consumedRecords.load(std::memory_order::relaxed);
+        if (consumed == producedRecords.load(std::memory_order::acquire))
+        {
+            return nullptr;
+        }
+        return &records[consumed % CAPACITY];
+    }
+
+    /// Hands the oldest record back to the producer, after the consumer wrote it
+    void pop() { consumedRecords.store(consumedRecords.load(std::memory_order::relaxed) + 1, std::memory_order::release); }
+
+    [[nodiscard]] uint64_t getNumberOfProducedRecords() const { return producedRecords.load(std::memory_order::acquire); }
+
+    [[nodiscard]] uint64_t getNumberOfConsumedRecords() const { return consumedRecords.load(std::memory_order::acquire); }
+
+    /// Counts the records that the producer discarded, as the ring was full
+    std::atomic<uint64_t> droppedRecords{0};
+    /// Set by the producer when its thread exits. The consumer removes the ring once it wrote all remaining records.
+    std::atomic<bool> abandoned{false};
+
+private:
+    std::unique_ptr<LogRecord[]> records = std::make_unique<LogRecord[]>(CAPACITY);
+    /// Producer and consumer counters are on different cache lines, as they are written by different threads
+    alignas(std::hardware_destructive_interference_size) std::atomic<uint64_t> producedRecords{0};
+    uint64_t cachedConsumedRecords = 0;
+    alignas(std::hardware_destructive_interference_size) std::atomic<uint64_t> consumedRecords{0};
+};
+
+}
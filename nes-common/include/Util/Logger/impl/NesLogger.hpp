@@ -14,33 +14,49 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 #include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/impl/LogRing.hpp>
 #include <fmt/core.h>
-#include <spdlog/fwd.h>
-#include <spdlog/logger.h>
+#include <spdlog/common.h>
 #include <spdlog/mdc.h>
 
-namespace spdlog::details
-{
-class periodic_worker;
-}
-
 namespace NES
 {
 
-namespace detail
+/// Determines what happens to a log message if the log ring of the calling thread is full.
+enum class LogOverflowPolicy : uint8_t
 {
-/// Creates an empty logger that writes to /dev/null
-std::shared_ptr<spdlog::logger> createEmptyLogger();
-}
+    /// The logging thread waits until the background thread has written enough messages. No message gets lost.
+    BLOCK,
+    /// The message is discarded. Logging never stalls the calling thread, e.g., a worker thread.
+    DROP
+};
 
 namespace detail
 {
+/// The logger is asynchronous: every thread that logs owns a lock-free single-producer single-consumer ring of log records (c.f. LogRing).
+/// The calling thread only captures the thread context and copies the arguments into the record, if they are DeferredFormattable.
+/// The background thread of the logger formats the messages, applies the pattern, and writes to the sinks, thus the calling thread neither
+/// formats such messages, nor takes a lock, nor performs I/O. Messages of a thread keep their order, messages of different threads might
+/// interleave differently than they were logged.
 class Logger
 {
 public:
-    explicit Logger(const std::string& logFileName, LogLevel level, bool useStdout = true);
+    explicit Logger(
+        const std::string& logFileName, LogLevel level, bool useStdout = true, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::BLOCK);
     ~Logger();
+    /// Creates a logger that discards all messages
     Logger();
 
     Logger(const Logger&) = delete;
@@ -52,41 +68,41 @@ public:
     template <typename... arguments>
     constexpr inline void trace(spdlog::source_loc&& loc, fmt::format_string<arguments...>&& format, arguments&&... args)
     {
-        impl->log(std::move(loc), spdlog::level::trace, std::move(format), std::forward<arguments>(args)...);
+        log(loc, spdlog::level::trace, std::move(format), std::forward<arguments>(args)...);
     }
 
     /// Logs a warning message using a format, a source location, and a set of arguments to display
     template <typename... arguments>
     constexpr inline void warn(spdlog::source_loc&& loc, fmt::format_string<arguments...> format, arguments&&... args)
     {
-        impl->log(std::move(loc), spdlog::level::warn, std::move(format), std::forward<arguments>(args)...);
+        log(loc, spdlog::level::warn, std::move(format), std::forward<arguments>(args)...);
     }
 
     /// Logs an info message using a format, a source location, and a set of arguments to display
     template <typename... arguments>
     constexpr inline void info(spdlog::source_loc&& loc, fmt::format_string<arguments...> format, arguments&&... args)
     {
-        impl->log(std::move(loc), spdlog::level::info, std::move(format), std::forward<arguments>(args)...);
+        log(loc, spdlog::level::info, std::move(format), std::forward<arguments>(args)...);
     }
 
     /// Logs a debug message using a format, a source location, and a set of arguments to display
     template <typename... arguments>
     constexpr inline void debug(spdlog::source_loc&& loc, fmt::format_string<arguments...> format, arguments&&... args)
     {
-        impl->log(std::move(loc), spdlog::level::debug, std::move(format), std::forward<arguments>(args)...);
+        log(loc, spdlog::level::debug, std::move(format), std::forward<arguments>(args)...);
     }
 
     /// Logs an error message using a format, a source location, and a set of arguments to display
     template <typename... arguments>
     constexpr inline void error(spdlog::source_loc&& loc, fmt::format_string<arguments...> format, arguments&&... args)
     {
-        impl->log(std::move(loc), spdlog::level::err, std::move(format), std::forward<arguments>(args)...);
+        log(loc, spdlog::level::err, std::move(format), std::forward<arguments>(args)...);
     }
 
-    /// flushes the current log to filesystem
-    void flush() { impl->flush(); }
+    /// flushes the current log to filesystem asynchronously
+    void flush() { flushRequested.store(true, std::memory_order::relaxed); }
 
-    /// forcefully flushes the current log to filesystem
+    /// forcefully flushes the current log to filesystem and blocks until all previously logged messages are written
     void forceFlush();
 
     inline LogLevel getCurrentLogLevel() const noexcept { return currentLogLevel; }
@@ -94,17 +110,79 @@ public:
     void changeLogLevel(LogLevel newLevel);
 
 private:
-    std::shared_ptr<spdlog::logger> impl{nullptr};
+    template <typename... arguments>
+    void log(const spdlog::source_loc& loc, spdlog::level::level_enum level, fmt::format_string<arguments...> format, arguments&&... args)
+    {
+        if (level < currentSpdlogLevel.load(std::memory_order::relaxed) || isShutdown.load(std::memory_order::relaxed))
+        {
+            return;
+        }
+        auto& ring = getThreadRing();
+        auto* record = reserveRecord(ring);
+        if (record == nullptr)
+        {
+            return;
+        }
+        record->time = spdlog::log_clock::now();
+        record->location = loc;
+        record->level = level;
+        /// The worker id, the thread name, and the log context belong to the calling thread, thus they have to be captured here
+        captureThreadContext(*record);
+
+        if constexpr (CAN_CAPTURE_ARGUMENTS<arguments...>)
+        {
+            captureArguments(*record, fmt::string_view(format), std::forward<arguments>(args)...);
+        }
+        else
+        {
+            record->message.clear();
+            fmt::format_to(std::back_inserter(record->message), std::move(format), std::forward<arguments>(args)...);
+            record->formatArguments = nullptr;
+        }
+        ring.publish();
+    }
+
+    /// Returns the ring of the calling thread, which gets registered with this logger on the first message of the thread
+    LogRing& getThreadRing();
+
+    /// Returns a free record of the ring. If the ring is full, waits for the background thread or returns nullptr, depending on the policy.
+    LogRecord* reserveRecord(LogRing& ring) const;
+
+    /// Writes the context of the calling thread in the format of our log pattern into the record
+    static void captureThreadContext(LogRecord& record);
+
+    /// Body of the background thread, which writes the records of all rings until a stop is requested and the rings are drained
+    void writeRecords(const std::stop_token& stopToken);
+    /// Writes all published records of the ring and returns their number
+    size_t writeRecordsOf(LogRing& ring);
+    void writeRecord(LogRecord& record);
+    void flushSinks();
+
+    /// Identifies the logger in the thread-local ring registration, as setupLogging() might replace the logger
+    const uint64_t loggerId;
+    std::vector<spdlog::sink_ptr> sinks;
     LogLevel currentLogLevel = LogLevel::LOG_INFO;
+    std::atomic<spdlog::level::level_enum> currentSpdlogLevel{spdlog::level::off};
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::BLOCK;
+
+    /// Only taken when a thread logs its first message, or when the background thread picks up new rings
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<LogRing>> rings;
+    std::atomic<uint64_t> ringsVersion{0};
+
+    std::atomic<bool> flushRequested{false};
     std::atomic<bool> isShutdown{false};
-    std::unique_ptr<spdlog::details::periodic_worker> flusher{nullptr};
+    /// Declared last, as the background thread accesses all other members
+    std::jthread writer;
 };
 }
 
 namespace Logger
 {
-void setupLogging(const std::string& logFileName, LogLevel level, bool useStdout = true);
+void setupLogging(
+    const std::string& logFileName, LogLevel level, bool useStdout = true, LogOverflowPolicy overflowPolicy = LogOverflowPolicy::BLOCK);
 
+/// Returns a copy, as setupLogging() might replace the logger while the caller is still logging
 std::shared_ptr<detail::Logger> getInstance();
 }
 
@@ -0,0 +1,30 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+namespace NES
+{
+enum class SelectionStrategy : uint8_t
+{
+    /// Evaluates the predicate per record and branches around the child operator.
+    BRANCHING,
+    /// Evaluates the predicate for a block of records into a selection vector without branches and executes the child only on selected records.
+    PREDICATED,
+    /// Chooses between branching and predicated evaluation for each buffer based on the observed selectivity.
+    ADAPTIVE
+};
+}
@@ -13,47 +13,33 @@
 */
 #include <Util/Logger/impl/NesLogger.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <stop_token>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <Identifiers/NESStrongTypeFormat.hpp>
 #include <Util/Logger/LogLevel.hpp>
-#include <spdlog/async.h>
+#include <Util/Logger/impl/LogRing.hpp>
+#include <fmt/format.h>
 #include <spdlog/common.h>
-#include <spdlog/details/periodic_worker.h>
-#include <spdlog/logger.h>
+#include <spdlog/details/log_msg.h>
+#include <spdlog/mdc.h>
 #include <spdlog/pattern_formatter.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <Thread.hpp>
 
-/// Custom formatter flags that render the worker and thread id
-class WorkerIdFlag final : public spdlog::custom_flag_formatter
-{
-public:
-    void format(const spdlog::details::log_msg&, const std::tm&, spdlog::memory_buf_t& dest) override
-    {
-        const auto id = NES::Thread::getThisWorkerNodeId().view();
-        dest.append(id.data(), id.data() + id.size());
-    }
-
-    std::unique_ptr<custom_flag_formatter> clone() const override { return spdlog::details::make_unique<WorkerIdFlag>(); }
-};
-
-class ThreadNameFlag final : public spdlog::custom_flag_formatter
-{
-public:
-    void format(const spdlog::details::log_msg&, const std::tm&, spdlog::memory_buf_t& dest) override
-    {
-        const auto id = NES::Thread::getThisThreadName();
-        dest.append(id.data(), id.data() + id.size());
-    }
-
-    std::unique_ptr<custom_flag_formatter> clone() const override { return spdlog::details::make_unique<ThreadNameFlag>(); }
-};
-
 namespace NES
 {
 
@@ -61,8 +47,15 @@ namespace detail
 {
 
 static constexpr auto SPDLOG_NES_LOGGER_NAME = "nes_logger";
-static constexpr auto DEV_NULL = "/dev/null";
-static constexpr auto SPDLOG_PATTERN = "%^[%H:%M:%S.%f] [%L] [%*] [%G] [%&] [%s:%#] [%!] %v%$";
+/// The worker id, thread name, log context, and source location are part of the payload (c.f. Logger::captureThreadContext), as the pattern
+/// is applied by the background thread of the logger.
+static constexpr auto SPDLOG_PATTERN = "%^[%H:%M:%S.%f] [%L] %v%$";
+/// The background thread sleeps for this long, if it found no record in any ring
+static constexpr auto IDLE_INTERVAL = std::chrono::milliseconds(1);
+static constexpr auto FLUSH_INTERVAL = std::chrono::seconds(1);
+
+/// Distinguishes the loggers in the thread-local ring registration
+static std::atomic<uint64_t> nextLoggerId{0};
 
 auto toSpdlogLevel(const LogLevel level)
 {
@@ -100,49 +93,55 @@ auto toSpdlogLevel(const LogLevel level)
     return spdlogLevel;
 }
 
-auto createEmptyLogger() -> std::shared_ptr<spdlog::logger>
+namespace
+{
+/// The ring of the calling thread. Marks the ring as abandoned when the thread exits, so that the logger removes it once it is drained.
+struct ThreadRing
 {
-    return std::make_shared<spdlog::logger>("null", std::make_shared<spdlog::sinks::basic_file_sink_st>(DEV_NULL));
+    uint64_t loggerId = UINT64_MAX;
+    std::shared_ptr<LogRing> ring;
+
+    ~ThreadRing()
+    {
+        if (ring)
+        {
+            ring->abandoned.store(true, std::memory_order::release);
+        }
+    }
+};
+
+void append(spdlog::memory_buf_t& buffer, const std::string_view value)
+{
+    buffer.append(value.data(), value.data() + value.size());
+}
 }
 
-Logger::Logger(const std::string& logFileName, const LogLevel level, const bool useStdout)
+Logger::Logger(const std::string& logFileName, const LogLevel level, const bool useStdout, const LogOverflowPolicy overflowPolicy)
+    : loggerId(nextLoggerId.fetch_add(1)), overflowPolicy(overflowPolicy)
 {
     auto spdlogLevel = toSpdlogLevel(level);
 
-    std::vector<spdlog::sink_ptr> sinks;
     if (useStdout)
     {
         auto consoleSink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
         consoleSink->set_level(spdlogLevel);
         consoleSink->set_color_mode(spdlog::color_mode::always);
-
-        auto formatter = std::make_unique<spdlog::pattern_formatter>();
-        formatter->add_flag<WorkerIdFlag>('*');
-        formatter->add_flag<ThreadNameFlag>('G');
-        formatter->set_pattern(SPDLOG_PATTERN);
-        consoleSink->set_formatter(std::move(formatter));
+        consoleSink->set_formatter(std::make_unique<spdlog::pattern_formatter>(SPDLOG_PATTERN));
         sinks.push_back(consoleSink);
     }
 
     auto fileSink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(logFileName, true);
     fileSink->set_level(spdlogLevel);
-    auto formatter = std::make_unique<spdlog::pattern_formatter>();
-    formatter->add_flag<WorkerIdFlag>('*');
-    formatter->add_flag<ThreadNameFlag>('G');
-    formatter->set_pattern(SPDLOG_PATTERN);
-    fileSink->set_formatter(std::move(formatter));
+    fileSink->set_formatter(std::make_unique<spdlog::pattern_formatter>(SPDLOG_PATTERN));
     sinks.push_back(fileSink);
 
-    impl = std::make_shared<spdlog::logger>(SPDLOG_NES_LOGGER_NAME, sinks.begin(), sinks.end());
-
-    impl->flush_on(spdlog::level::err);
-
     changeLogLevel(level);
 
-    flusher = std::make_unique<spdlog::details::periodic_worker>([this]() { impl->flush(); }, std::chrono::seconds(1));
+    /// A single background thread keeps the order of the messages of each thread intact
+    writer = std::jthread([this](const std::stop_token& stopToken) { writeRecords(stopToken); });
 }
 
-Logger::Logger() : impl(detail::createEmptyLogger())
+Logger::Logger() : loggerId(nextLoggerId.fetch_add(1))
 {
 }
 
@@ -151,18 +150,231 @@ Logger::~Logger()
     shutdown();
 }
 
-/// As we are using the async logger, this flushes async and does not block!
-/// shutdown the logger to ensure all msgs are sent before calling e.g. abort()
+LogRing& Logger::getThreadRing()
+{
+    thread_local ThreadRing threadRing;
+    if (threadRing.loggerId != loggerId)
+    {
+        if (threadRing.ring)
+        {
+            threadRing.ring->abandoned.store(true, std::memory_order::release);
+        }
+        threadRing.ring = std::make_shared<LogRing>();
+        threadRing.loggerId = loggerId;
+        const std::scoped_lock lock(ringsMutex);
+        rings.push_back(threadRing.ring);
+        ringsVersion.fetch_add(1, std::memory_order::release);
+    }
+    return *threadRing.ring;
+}
+
+LogRecord* Logger::reserveRecord(LogRing& ring) const
+{
+    auto* record = ring.tryReserve();
+    if (record != nullptr)
+    {
+        return record;
+    }
+    if (overflowPolicy == LogOverflowPolicy::DROP)
+    {
+        ring.droppedRecords.fetch_add(1, std::memory_order::relaxed);
+        return nullptr;
+    }
+    while (record == nullptr && not isShutdown.load(std::memory_order::relaxed))
+    {
+        std::this_thread::yield();
+        record = ring.tryReserve();
+    }
+    return record;
+}
+
+void Logger::captureThreadContext(LogRecord& record)
+{
+    auto* const begin = record.threadContext.data();
+    auto* const end = begin + record.threadContext.size();
+    auto* position = begin;
+    const auto append = [&position, end](const std::string_view value)
+    { position = std::copy_n(value.data(), std::min(value.size(), static_cast<size_t>(end - position)), position); };
+
+    append("[");
+    append(Thread::getThisWorkerNodeId().view());
+    append("] [");
+    append(Thread::getThisThreadName());
+    append("] [");
+    bool firstContext = true;
+    for (const auto& [key, value] : spdlog::mdc::get_context())
+    {
+        if (not firstContext)
+        {
+            append(" ");
+        }
+        firstContext = false;
+        append(key);
+        append(":");
+        append(value);
+    }
+    append("] [");
+    record.threadContextSize = position - begin;
+}
+
+void Logger::writeRecords(const std::stop_token& stopToken)
+{
+    std::vector<std::shared_ptr<LogRing>> knownRings;
+    uint64_t knownRingsVersion = UINT64_MAX;
+    auto lastFlush = std::chrono::steady_clock::now();
+    while (true)
+    {
+        /// Checked before draining the rings, so that all records that were published before the stop request are written
+        const bool stopRequested = stopToken.stop_requested();
+        if (const auto currentRingsVersion = ringsVersion.load(std::memory_order::acquire); currentRingsVersion != knownRingsVersion)
+        {
+            const std::scoped_lock lock(ringsMutex);
+            knownRings = rings;
+            knownRingsVersion = ringsVersion.load(std::memory_order::relaxed);
+        }
+
+        size_t numberOfWrittenRecords = 0;
+        for (const auto& ring : knownRings)
+        {
+            /// Read before draining, as the thread might publish its last records right before it exits
+            const bool abandoned = ring->abandoned.load(std::memory_order::acquire);
+            numberOfWrittenRecords += writeRecordsOf(*ring);
+            if (abandoned)
+            {
+                const std::scoped_lock lock(ringsMutex);
+                std::erase(rings, ring);
+                ringsVersion.fetch_add(1, std::memory_order::release);
+            }
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (flushRequested.exchange(false, std::memory_order::relaxed) || now - lastFlush >= FLUSH_INTERVAL)
+        {
+            flushSinks();
+            lastFlush = now;
+        }
+        if (stopRequested)
+        {
+            break;
+        }
+        if (numberOfWrittenRecords == 0)
+        {
+            std::this_thread::sleep_for(IDLE_INTERVAL);
+        }
+    }
+    flushSinks();
+}
+
+size_t Logger::writeRecordsOf(LogRing& ring)
+{
+    if (const auto droppedRecords = ring.droppedRecords.exchange(0, std::memory_order::relaxed); droppedRecords > 0)
+    {
+        LogRecord droppedWarning;
+        droppedWarning.time = spdlog::log_clock::now();
+        droppedWarning.level = spdlog::level::warn;
+        droppedWarning.message = fmt::format("Dropped {} log messages, as the log ring of the thread was full", droppedRecords);
+        writeRecord(droppedWarning);
+    }
+
+    size_t numberOfWrittenRecords = 0;
+    for (auto* record = ring.front(); record != nullptr; record = ring.front())
+    {
+        writeRecord(*record);
+        ring.pop();
+        ++numberOfWrittenRecords;
+    }
+    return numberOfWrittenRecords;
+}
+
+void Logger::writeRecord(LogRecord& record)
+{
+    spdlog::memory_buf_t payload;
+    append(payload, std::string_view(record.threadContext.data(), record.threadContextSize));
+    if (record.location.filename != nullptr)
+    {
+        /// Equivalent to the %s flag, which only prints the base name of the file
+        const std::string_view filename{record.location.filename};
+        const auto lastSeparator = filename.find_last_of('/');
+        append(payload, lastSeparator == std::string_view::npos ? filename : filename.substr(lastSeparator + 1));
+        fmt::format_to(std::back_inserter(payload), ":{}", record.location.line);
+    }
+    append(payload, "] [");
+    if (record.location.funcname != nullptr)
+    {
+        append(payload, record.location.funcname);
+    }
+    append(payload, "] ");
+
+    if (record.formatArguments != nullptr)
+    {
+        try
+        {
+            /// The captured arguments are destroyed by the format function, thus the record does not own them anymore afterward
+            record.formatArguments(record.arguments.data(), record.format, payload);
+        }
+        catch (const std::exception& exception)
+        {
+            append(payload, "<failed to format message: ");
+            append(payload, exception.what());
+            append(payload, ">");
+        }
+    }
+    else
+    {
+        append(payload, record.message);
+    }
+
+    const spdlog::details::log_msg message(
+        record.time, record.location, SPDLOG_NES_LOGGER_NAME, record.level, spdlog::string_view_t(payload.data(), payload.size()));
+    for (const auto& sink : sinks)
+    {
+        if (sink->should_log(record.level))
+        {
+            sink->log(message);
+        }
+    }
+    if (record.level >= spdlog::level::err)
+    {
+        flushSinks();
+    }
+}
+
+void Logger::flushSinks()
+{
+    for (const auto& sink : sinks)
+    {
+        sink->flush();
+    }
+}
+
+/// Blocks until the background thread has written and flushed all messages that were logged before this call.
+/// Call shutdown() to ensure all msgs are sent before calling e.g. abort()
 void Logger::forceFlush()
 {
-    if (impl)
+    if (not writer.joinable())
+    {
+        flushSinks();
+        return;
+    }
+
+    /// A ring only hands a record back to its thread after the background thread wrote it, thus all records that were published before
+    /// this call are written, once the consumed records of each ring reach the produced records at the time of the call.
+    std::vector<std::pair<std::shared_ptr<LogRing>, uint64_t>> producedRecords;
+    {
+        const std::scoped_lock lock(ringsMutex);
+        for (const auto& ring : rings)
+        {
+            producedRecords.emplace_back(ring, ring->getNumberOfProducedRecords());
+        }
+    }
+    for (const auto& [ring, numberOfProducedRecords] : producedRecords)
     {
-        for (auto& sink : impl->sinks())
+        while (ring->getNumberOfConsumedRecords() < numberOfProducedRecords && not isShutdown.load(std::memory_order::relaxed))
         {
-            sink->flush();
+            std::this_thread::sleep_for(IDLE_INTERVAL);
         }
-        impl->flush();
     }
+    flushSinks();
 }
 
 void Logger::shutdown()
@@ -170,19 +382,27 @@ void Logger::shutdown()
     bool expected = false;
     if (isShutdown.compare_exchange_strong(expected, true))
     {
-        flusher.reset();
-        impl.reset();
+        /// Joining the background thread writes all remaining messages
+        if (writer.joinable())
+        {
+            writer.request_stop();
+            writer.join();
+        }
     }
 }
 
 void Logger::changeLogLevel(LogLevel newLevel)
 {
     auto spdNewLogLevel = detail::toSpdlogLevel(newLevel);
-    for (auto& sink : impl->sinks())
+    for (auto& sink : sinks)
     {
         sink->set_level(spdNewLogLevel);
     }
-    impl->set_level(spdNewLogLevel);
+    /// A logger without sinks has no background thread that would drain the rings, thus it keeps discarding all messages
+    if (not sinks.empty())
+    {
+        currentSpdlogLevel.store(spdNewLogLevel, std::memory_order::relaxed);
+    }
     std::swap(newLevel, currentLogLevel);
 }
 
@@ -209,9 +429,9 @@ namespace Logger
 
 static detail::LoggerHolder helper;
 
-void setupLogging(const std::string& logFileName, LogLevel level, bool useStdout)
+void setupLogging(const std::string& logFileName, LogLevel level, bool useStdout, LogOverflowPolicy overflowPolicy)
 {
-    auto newLogger = std::make_shared<detail::Logger>(logFileName, level, useStdout);
+    auto newLogger = std::make_shared<detail::Logger>(logFileName, level, useStdout, overflowPolicy);
     std::swap(detail::LoggerHolder::singleton, newLogger);
 }
 
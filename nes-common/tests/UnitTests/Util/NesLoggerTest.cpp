@@ -0,0 +1,168 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/impl/LogRing.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <spdlog/common.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+/// Checks that the asynchronous logger writes the messages of all threads, formats captured arguments with their values at the time of
+/// the log call, and keeps the order of the messages of each thread.
+class NesLoggerTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr size_t NUMBER_OF_THREADS = 4;
+    /// More messages per thread than a log ring can hold, so that the threads have to wait for the background thread
+    static constexpr size_t NUMBER_OF_MESSAGES_PER_THREAD = 4 * detail::LogRing::CAPACITY;
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        logFile = std::filesystem::temp_directory_path() / "NesLoggerTest.log";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(logFile);
+        BaseUnitTest::TearDown();
+    }
+
+    [[nodiscard]] std::vector<std::string> readLines() const
+    {
+        std::ifstream file(logFile);
+        std::vector<std::string> lines;
+        for (std::string line; std::getline(file, line);)
+        {
+            lines.emplace_back(std::move(line));
+        }
+        return lines;
+    }
+
+    static spdlog::source_loc location() { return spdlog::source_loc{__FILE__, __LINE__, SPDLOG_FUNCTION}; }
+
+    std::filesystem::path logFile;
+};
+
+TEST_F(NesLoggerTest, formatsCapturedArgumentsWithTheirValuesAtTheLogCall)
+{
+    detail::Logger logger(logFile.string(), LogLevel::LOG_DEBUG, false);
+    std::string text = "captured";
+    uint64_t number = 42;
+    /// Captured by value, thus changing the variables afterward does not change the message
+    logger.info(location(), "{} {} {:>4}", text, number, 7);
+    text = "changed";
+    number = 0;
+    /// A string view might be gone before the background thread writes the message, thus it is formatted on the calling thread
+    const std::string_view view = text;
+    logger.info(location(), "{}", view);
+    logger.debug(location(), "without arguments {{}}");
+    logger.forceFlush();
+
+    const auto lines = readLines();
+    ASSERT_EQ(lines.size(), 3);
+    EXPECT_TRUE(lines[0].ends_with("] captured 42    7")) << lines[0];
+    EXPECT_TRUE(lines[1].ends_with("] changed")) << lines[1];
+    EXPECT_TRUE(lines[2].ends_with("] without arguments {}")) << lines[2];
+    EXPECT_NE(lines[0].find("NesLoggerTest.cpp:"), std::string::npos) << lines[0];
+}
+
+TEST_F(NesLoggerTest, discardsMessagesBelowTheLogLevel)
+{
+    detail::Logger logger(logFile.string(), LogLevel::LOG_WARNING, false);
+    logger.info(location(), "discarded {}", 1);
+    logger.warn(location(), "written {}", 2);
+    logger.forceFlush();
+
+    const auto lines = readLines();
+    ASSERT_EQ(lines.size(), 1);
+    EXPECT_TRUE(lines[0].ends_with("] written 2")) << lines[0];
+}
+
+TEST_F(NesLoggerTest, writesAllMessagesOfAllThreadsInTheirOrder)
+{
+    detail::Logger logger(logFile.string(), LogLevel::LOG_INFO, false, LogOverflowPolicy::BLOCK);
+    std::vector<std::jthread> threads;
+    for (size_t threadIdx = 0; threadIdx < NUMBER_OF_THREADS; ++threadIdx)
+    {
+        threads.emplace_back(
+            [&logger, threadIdx]
+            {
+                for (size_t messageIdx = 0; messageIdx < NUMBER_OF_MESSAGES_PER_THREAD; ++messageIdx)
+                {
+                    logger.info(location(), "thread {} message {}", threadIdx, messageIdx);
+                }
+            });
+    }
+    threads.clear();
+    logger.forceFlush();
+
+    std::vector<size_t> nextMessageOfThread(NUMBER_OF_THREADS, 0);
+    for (const auto& line : readLines())
+    {
+        size_t threadIdx = 0;
+        size_t messageIdx = 0;
+        ASSERT_EQ(std::sscanf(line.substr(line.rfind("thread ")).c_str(), "thread %zu message %zu", &threadIdx, &messageIdx), 2) << line;
+        ASSERT_LT(threadIdx, NUMBER_OF_THREADS);
+        EXPECT_EQ(messageIdx, nextMessageOfThread[threadIdx]) << line;
+        nextMessageOfThread[threadIdx] = messageIdx + 1;
+    }
+    for (const auto numberOfMessages : nextMessageOfThread)
+    {
+        EXPECT_EQ(numberOfMessages, NUMBER_OF_MESSAGES_PER_THREAD);
+    }
+}
+
+TEST_F(NesLoggerTest, dropPolicyCountsTheDiscardedMessages)
+{
+    detail::Logger logger(logFile.string(), LogLevel::LOG_INFO, false, LogOverflowPolicy::DROP);
+    for (size_t messageIdx = 0; messageIdx < NUMBER_OF_MESSAGES_PER_THREAD; ++messageIdx)
+    {
+        logger.info(location(), "message {}", messageIdx);
+    }
+    /// Shutting down writes all remaining messages and the number of discarded messages
+    logger.shutdown();
+
+    size_t numberOfMessages = 0;
+    for (const auto& line : readLines())
+    {
+        constexpr std::string_view dropped = "Dropped ";
+        if (const auto droppedPosition = line.find(dropped); droppedPosition != std::string::npos)
+        {
+            numberOfMessages += std::stoul(line.substr(droppedPosition + dropped.size()));
+        }
+        else
+        {
+            ++numberOfMessages;
+        }
+    }
+    EXPECT_EQ(numberOfMessages, NUMBER_OF_MESSAGES_PER_THREAD);
+}
+
+}
@@ -22,7 +22,8 @@ namespace NES
 
 bool NonZeroValidation::isValid(const std::string& parameter) const
 {
-    std::regex numberRegex("^0.?0?$");
+    /// Any number of leading zeros and an optional fraction of zeros, e.g., 0, 000, or 0.00
+    const std::regex numberRegex(R"(^0+(\.0*)?$)");
     if (std::regex_match(parameter, numberRegex))
     {
         return false;
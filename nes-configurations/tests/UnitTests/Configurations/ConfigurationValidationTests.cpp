@@ -0,0 +1,77 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <Configurations/ScalarOption.hpp>
+#include <Configurations/Validation/ConfigurationValidation.hpp>
+#include <Configurations/Validation/NonZeroValidation.hpp>
+#include <Configurations/Validation/NumberValidation.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+class ConfigurationValidationTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("ConfigurationValidationTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup Configuration Validation test class.");
+    }
+
+    /// Validators of an option that must be a positive integer, e.g., window_trigger_batch_size
+    static std::vector<std::shared_ptr<ConfigurationValidation>> positiveNumberValidators()
+    {
+        return {std::make_shared<NumberValidation>(), std::make_shared<NonZeroValidation>()};
+    }
+};
+
+TEST_F(ConfigurationValidationTest, NonZeroValidationRejectsAllSpellingsOfZero)
+{
+    const NonZeroValidation validation;
+    for (const std::string zero : {"0", "00", "000", "0.", "0.0", "0.000"})
+    {
+        EXPECT_FALSE(validation.isValid(zero)) << zero;
+    }
+    for (const std::string nonZero : {"1", "10", "100", "0.5", "01"})
+    {
+        EXPECT_TRUE(validation.isValid(nonZero)) << nonZero;
+    }
+}
+
+TEST_F(ConfigurationValidationTest, PositiveNumberOptionRejectsValuesBelowOne)
+{
+    ASSERT_EXCEPTION_ERRORCODE(
+        (UIntOption{"positive_option", "0", "An option that must be at least 1", positiveNumberValidators()}),
+        ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        (UIntOption{"positive_option", "000", "An option that must be at least 1", positiveNumberValidators()}),
+        ErrorCode::InvalidConfigParameter);
+    ASSERT_EXCEPTION_ERRORCODE(
+        (UIntOption{"positive_option", "-1", "An option that must be at least 1", positiveNumberValidators()}),
+        ErrorCode::InvalidConfigParameter);
+
+    const UIntOption option{"positive_option", "4", "An option that must be at least 1", positiveNumberValidators()};
+    EXPECT_EQ(option.getValue(), 4);
+}
+
+}
@@ -20,6 +20,7 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Sinks/SinkDescriptor.hpp>
 #include <Sources/SourceDescriptor.hpp>
+#include <Util/CompilationOptions.hpp>
 #include <ExecutablePipelineStage.hpp>
 
 namespace NES
@@ -61,11 +62,17 @@ struct CompiledQueryPlan
     };
 
     static std::unique_ptr<CompiledQueryPlan> create(
-        QueryId queryId, std::vector<std::shared_ptr<ExecutablePipeline>> pipelines, std::vector<Sink> sinks, std::vector<Source> sources);
+        QueryId queryId,
+        std::vector<std::shared_ptr<ExecutablePipeline>> pipelines,
+        std::vector<Sink> sinks,
+        std::vector<Source> sources,
+        CompilationOptions compilationOptions);
 
     QueryId queryId;
     std::vector<std::shared_ptr<ExecutablePipeline>> pipelines;
     std::vector<Sink> sinks;
     std::vector<Source> sources;
+    /// The options that the pipelines have been compiled with, so that the generated code can be reproduced
+    CompilationOptions compilationOptions;
 };
 }
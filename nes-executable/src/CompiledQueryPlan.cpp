@@ -19,6 +19,7 @@
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Util/CompilationOptions.hpp>
 #include <Util/Ranges.hpp>
 #include <ExecutablePipelineStage.hpp>
 
@@ -34,8 +35,13 @@ std::shared_ptr<ExecutablePipeline> ExecutablePipeline::create(
 }
 
 std::unique_ptr<CompiledQueryPlan> CompiledQueryPlan::create(
-    QueryId queryId, std::vector<std::shared_ptr<ExecutablePipeline>> pipelines, std::vector<Sink> sinks, std::vector<Source> sources)
+    QueryId queryId,
+    std::vector<std::shared_ptr<ExecutablePipeline>> pipelines,
+    std::vector<Sink> sinks,
+    std::vector<Source> sources,
+    CompilationOptions compilationOptions)
 {
-    return std::make_unique<CompiledQueryPlan>(queryId, std::move(pipelines), std::move(sinks), std::move(sources));
+    return std::make_unique<CompiledQueryPlan>(
+        queryId, std::move(pipelines), std::move(sinks), std::move(sources), compilationOptions);
 }
 }
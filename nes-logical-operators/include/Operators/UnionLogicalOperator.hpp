@@ -21,6 +21,7 @@
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Operators/LogicalOperator.hpp>
+#include <Operators/OriginIdAssigner.hpp>
 #include <Traits/Trait.hpp>
 #include <Traits/TraitSet.hpp>
 #include <Util/PlanRenderer.hpp>
@@ -29,7 +30,9 @@
 namespace NES
 {
 
-class UnionLogicalOperator
+/// The union assigns a new origin id, as the physical union merges the origins of all of its children into a single output origin.
+/// Thus, downstream operators track a single origin regardless of the number of unioned inputs.
+class UnionLogicalOperator : public OriginIdAssigner
 {
 public:
     explicit UnionLogicalOperator();
@@ -139,7 +139,19 @@ SourceDescriptor OperatorSerializationUtil::deserializeSourceDescriptor(const Se
         sourceDescriptorConfig[key] = protoToDescriptorConfigType(value);
     }
 
-    return SourceDescriptor{physicalSourceId, logicalSource, sourceType, std::move(sourceDescriptorConfig), deserializedParserConfig};
+    std::vector<SourceDescriptor> groupedSources;
+    for (const auto& groupedSource : sourceDescriptor.groupedsources())
+    {
+        groupedSources.emplace_back(deserializeSourceDescriptor(groupedSource));
+    }
+
+    return SourceDescriptor{
+        physicalSourceId,
+        logicalSource,
+        sourceType,
+        std::move(sourceDescriptorConfig),
+        deserializedParserConfig,
+        std::move(groupedSources)};
 }
 
 SinkDescriptor OperatorSerializationUtil::deserializeSinkDescriptor(const SerializableSinkDescriptor& serializableSinkDescriptor)
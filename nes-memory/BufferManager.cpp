@@ -63,6 +63,8 @@ BufferManager::~BufferManager()
 {
     bool expected = false;
     NES_DEBUG("Calling BufferManager::destroy()");
+    /// Buffers that were released by other threads are only recycled once their owner gave up the ownership
+    releaseBufferOwnership();
     if (isDestroyed.compare_exchange_strong(expected, true))
     {
         bool success = true;
@@ -176,7 +178,12 @@ std::optional<TupleBuffer> BufferManager::getBufferNoBlocking()
     detail::MemorySegment* memSegment = nullptr;
     if (!availableBuffers.read(memSegment))
     {
-        return std::nullopt;
+        /// The calling thread might own buffers that were already released by other threads
+        releaseBufferOwnership();
+        if (!availableBuffers.read(memSegment))
+        {
+            return std::nullopt;
+        }
     }
     if (memSegment->controlBlock->prepare(shared_from_this()))
     {
@@ -188,10 +195,15 @@ std::optional<TupleBuffer> BufferManager::getBufferNoBlocking()
 std::optional<TupleBuffer> BufferManager::getBufferWithTimeout(const std::chrono::milliseconds timeoutMs)
 {
     detail::MemorySegment* memSegment = nullptr;
-    const auto deadline = std::chrono::steady_clock::now() + timeoutMs;
-    if (!availableBuffers.tryReadUntil(deadline, memSegment))
+    if (!availableBuffers.read(memSegment))
     {
-        return std::nullopt;
+        /// Before blocking, the calling thread gives up the ownership of its buffers, as they might have been released by other threads
+        releaseBufferOwnership();
+        const auto deadline = std::chrono::steady_clock::now() + timeoutMs;
+        if (!availableBuffers.tryReadUntil(deadline, memSegment))
+        {
+            return std::nullopt;
+        }
     }
     if (memSegment->controlBlock->prepare(shared_from_this()))
     {
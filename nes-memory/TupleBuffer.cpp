@@ -14,9 +14,11 @@
 
 #include <Runtime/TupleBuffer.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <ostream>
+#include <span>
 #include <string>
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
@@ -192,6 +194,11 @@ TupleBuffer TupleBuffer::loadChildBuffer(VariableSizedAccess::Index bufferIndex)
     return childBuffer;
 }
 
+std::span<std::byte> TupleBuffer::loadChildBufferMemoryArea(VariableSizedAccess::Index bufferIndex) const noexcept
+{
+    return std::as_writable_bytes(controlBlock->loadChildBufferMemoryArea(bufferIndex));
+}
+
 bool recycleTupleBuffer(void* bufferPointer)
 {
     PRECONDITION(bufferPointer, "invalid bufferPointer");
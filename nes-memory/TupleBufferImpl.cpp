@@ -14,9 +14,15 @@
 
 #include <TupleBufferImpl.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <span>
+#include <thread>
 #include <utility>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/TupleBuffer.hpp>
@@ -28,7 +34,6 @@
 
 #ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
     #include <mutex>
-    #include <thread>
     #include <cpptrace.hpp>
 #endif
 
@@ -42,6 +47,95 @@ namespace detail
 /// ------------------ Core Mechanism for Buffer recycling ----------------------
 /// -----------------------------------------------------------------------------
 
+namespace
+{
+/// Identifies the calling thread. Threads merge all their owned control blocks on exit, thus, it is safe if the thread-local storage
+/// of an exited thread is reused by another thread.
+const void* getCallingThreadToken() noexcept
+{
+    thread_local const char token = 0;
+    return &token;
+}
+
+/// Marks a control block whose owner is merging or has merged its biased references, until the buffer is recycled
+const void* getMergingToken() noexcept
+{
+    static const char token = 0;
+    return &token;
+}
+}
+
+/// Tracks the control blocks that are owned by the calling thread. The number of owned control blocks is bounded, so that buffers which
+/// were released by other threads do not pile up if the owner keeps obtaining buffers without giving up its ownership.
+class OwnedBufferControlBlocks
+{
+public:
+    static constexpr size_t MAX_NUMBER_OF_OWNED_CONTROL_BLOCKS = 16;
+
+    OwnedBufferControlBlocks() = default;
+    OwnedBufferControlBlocks(const OwnedBufferControlBlocks&) = delete;
+    OwnedBufferControlBlocks(OwnedBufferControlBlocks&&) = delete;
+    OwnedBufferControlBlocks& operator=(const OwnedBufferControlBlocks&) = delete;
+    OwnedBufferControlBlocks& operator=(OwnedBufferControlBlocks&&) = delete;
+
+    ~OwnedBufferControlBlocks() { mergeAll(); }
+
+    static OwnedBufferControlBlocks& ofCallingThread()
+    {
+        thread_local OwnedBufferControlBlocks ownedControlBlocks;
+        return ownedControlBlocks;
+    }
+
+    void add(BufferControlBlock* controlBlock)
+    {
+        /// A negative shared counter indicates that other threads released references, which the owner created, e.g., the owner
+        /// emitted the buffer. Such buffers are unlikely to be used by the owner again and can only be recycled after merging.
+        mergeIf([](const BufferControlBlock* owned) { return owned->sharedReferenceCounter.load(std::memory_order_relaxed) < 0; });
+        if (numberOfOwned == MAX_NUMBER_OF_OWNED_CONTROL_BLOCKS)
+        {
+            mergeIf([oldest = controlBlocks.front()](const BufferControlBlock* owned) { return owned == oldest; });
+        }
+        controlBlocks[numberOfOwned++] = controlBlock;
+    }
+
+    void remove(const BufferControlBlock* controlBlock)
+    {
+        const auto owned = std::ranges::find(controlBlocks.begin(), controlBlocks.begin() + numberOfOwned, controlBlock);
+        INVARIANT(owned != controlBlocks.begin() + numberOfOwned, "control block is not owned by the calling thread");
+        std::shift_left(owned, controlBlocks.begin() + numberOfOwned, 1);
+        --numberOfOwned;
+    }
+
+    void mergeAll()
+    {
+        mergeIf([](const BufferControlBlock*) { return true; });
+    }
+
+private:
+    /// Merging might recycle the buffer and release its children, which in turn removes them from the owned control blocks.
+    /// Thus, we restart the scan after every merge.
+    template <typename Predicate>
+    void mergeIf(const Predicate& predicate)
+    {
+        size_t index = 0;
+        while (index < numberOfOwned)
+        {
+            auto* controlBlock = controlBlocks[index];
+            if (!predicate(controlBlock))
+            {
+                ++index;
+                continue;
+            }
+            remove(controlBlock);
+            controlBlock->mergeBiasedReferences();
+            index = 0;
+        }
+    }
+
+    std::array<BufferControlBlock*, MAX_NUMBER_OF_OWNED_CONTROL_BLOCKS> controlBlocks{};
+    size_t numberOfOwned = 0;
+};
+
 MemorySegment::MemorySegment(const MemorySegment& other) = default;
 
 MemorySegment& MemorySegment::operator=(const MemorySegment& other) = default;
@@ -121,9 +215,14 @@ void fillThreadOwnershipInfo(std::string& threadName, cpptrace::raw_trace& calls
     callstack = cpptrace::raw_trace::current(1);
 }
 #endif
+bool BufferControlBlock::isOwnedByCallingThread() const noexcept
+{
+    /// Only the owner sets or resets its own token, thus, a relaxed load never wrongly observes the token of the calling thread
+    return owningThread.load(std::memory_order_relaxed) == getCallingThreadToken();
+}
+
 bool BufferControlBlock::prepare(const std::shared_ptr<BufferRecycler>& recycler)
 {
-    int32_t expected = 0;
 #ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
     /// store the current thread that owns the buffer and track which function obtained the buffer
     std::unique_lock lock(owningThreadsMutex);
@@ -131,14 +230,18 @@ bool BufferControlBlock::prepare(const std::shared_ptr<BufferRecycler>& recycler
     fillThreadOwnershipInfo(info.threadName, info.callstack);
     owningThreads[std::this_thread::get_id()].emplace_back(info);
 #endif
-    if (referenceCounter.compare_exchange_strong(expected, 1))
+    if (const auto referenceCount = getReferenceCount(); referenceCount != 0 || owningThread.load() != nullptr)
     {
-        const auto previousOwner = std::exchange(this->owningBufferRecycler, recycler);
-        INVARIANT(previousOwner == nullptr, "Buffer should not retain a reference to its owner while unused");
-        return true;
+        NES_ERROR("Invalid reference counter: {}", referenceCount);
+        return false;
     }
-    NES_ERROR("Invalid reference counter: {}", expected);
-    return false;
+    /// The calling thread becomes the owner of the buffer and holds the first reference
+    biasedReferenceCounter.store(1, std::memory_order_relaxed);
+    owningThread.store(getCallingThreadToken(), std::memory_order_relaxed);
+    const auto previousOwner = std::exchange(this->owningBufferRecycler, recycler);
+    INVARIANT(previousOwner == nullptr, "Buffer should not retain a reference to its owner while unused");
+    OwnedBufferControlBlocks::ofCallingThread().add(this);
+    return true;
 }
 
 BufferControlBlock* BufferControlBlock::retain()
@@ -150,7 +253,14 @@ BufferControlBlock* BufferControlBlock::retain()
     fillThreadOwnershipInfo(info.threadName, info.callstack);
     owningThreads[std::this_thread::get_id()].emplace_back(info);
 #endif
-    ++referenceCounter;
+    if PLACEHOLDER_LIKELY (isOwnedByCallingThread())
+    {
+        biasedReferenceCounter.store(biasedReferenceCounter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    else
+    {
+        sharedReferenceCounter.fetch_add(SHARED_REFERENCE, std::memory_order_relaxed);
+    }
     return this;
 }
 
@@ -158,7 +268,7 @@ BufferControlBlock* BufferControlBlock::retain()
 void BufferControlBlock::dumpOwningThreadInfo()
 {
     std::unique_lock lock(owningThreadsMutex);
-    throw UnknownException("Buffer {} has {} live references", fmt::ptr(getOwner()), referenceCounter.load());
+    throw UnknownException("Buffer {} has {} live references", fmt::ptr(getOwner()), getReferenceCount());
     for (auto& item : owningThreads)
     {
         for (auto& v : item.second)
@@ -175,7 +285,35 @@ void BufferControlBlock::dumpOwningThreadInfo()
 
 int32_t BufferControlBlock::getReferenceCount() const noexcept
 {
-    return referenceCounter.load();
+    const auto toReferences = [](const int64_t sharedCounter)
+    { return (sharedCounter - (sharedCounter & MERGED_FLAG)) / SHARED_REFERENCE; };
+    if (isOwnedByCallingThread())
+    {
+        return static_cast<int32_t>(biasedReferenceCounter.load(std::memory_order_relaxed) + toReferences(sharedReferenceCounter.load()));
+    }
+
+    /// Other threads must not combine a biased counter from before a merge with a shared counter from after it (or vice versa), as the
+    /// sum might then be zero or negative while they hold a reference. Thus, they retry until both counters stem from the same state.
+    while (true)
+    {
+        const auto sharedCounter = sharedReferenceCounter.load();
+        if (sharedCounter & MERGED_FLAG)
+        {
+            /// After merging, the shared counter holds all references
+            return static_cast<int32_t>(toReferences(sharedCounter));
+        }
+        const auto owner = owningThread.load();
+        if (owner == getMergingToken())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto biasedCounter = biasedReferenceCounter.load();
+        if (owningThread.load() == owner && sharedReferenceCounter.load() == sharedCounter)
+        {
+            return static_cast<int32_t>(biasedCounter + toReferences(sharedCounter));
+        }
+    }
 }
 
 bool BufferControlBlock::release()
@@ -190,31 +328,65 @@ bool BufferControlBlock::release()
         }
     }
 #endif
-    if (const uint32_t prevRefCnt = referenceCounter.fetch_sub(1); prevRefCnt == 1)
+    if PLACEHOLDER_LIKELY (isOwnedByCallingThread())
     {
-        for (auto&& child : children)
+        const auto prevBiasedRefCnt = biasedReferenceCounter.load(std::memory_order_relaxed);
+        INVARIANT(prevBiasedRefCnt > 0, "releasing an already released buffer");
+        if (prevBiasedRefCnt != 1)
         {
-            child->controlBlock->release();
+            biasedReferenceCounter.store(prevBiasedRefCnt - 1, std::memory_order_relaxed);
+            return false;
         }
-        children.clear();
-#ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
-        {
-            std::unique_lock lock(owningThreadsMutex);
-            owningThreads.clear();
-        }
-#endif
-        const auto recycler = std::move(owningBufferRecycler);
-        numberOfTuples = 0;
-        recycleCallback(owner, recycler.get());
+        /// The owner released its last reference. Other threads might still hold references, thus, it merges its counter.
+        OwnedBufferControlBlocks::ofCallingThread().remove(this);
+        return mergeBiasedReferences(1);
+    }
+
+    const auto prevSharedRefCnt = sharedReferenceCounter.fetch_sub(SHARED_REFERENCE, std::memory_order_acq_rel);
+    if (prevSharedRefCnt == SHARED_REFERENCE + MERGED_FLAG)
+    {
+        recycle();
         return true;
     }
-    else
+    INVARIANT(prevSharedRefCnt != MERGED_FLAG, "releasing an already released buffer");
+    return false;
+}
+
+bool BufferControlBlock::mergeBiasedReferences(const int32_t releasedReferences)
+{
+    /// Announce the merge before moving the biased references, so that getReferenceCount() of other threads waits for its completion
+    owningThread.store(getMergingToken());
+    const auto mergedReferences = ((biasedReferenceCounter.exchange(0) - releasedReferences) * SHARED_REFERENCE) + MERGED_FLAG;
+    /// The acq_rel ordering publishes all previous modifications of the owner to the thread that recycles the buffer
+    if (sharedReferenceCounter.fetch_add(mergedReferences, std::memory_order_acq_rel) + mergedReferences == MERGED_FLAG)
     {
-        INVARIANT(prevRefCnt != 0, "releasing an already released buffer");
+        recycle();
+        return true;
     }
     return false;
 }
 
+void BufferControlBlock::recycle()
+{
+    for (auto&& child : children)
+    {
+        child->controlBlock->release();
+    }
+    children.clear();
+#ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
+    {
+        std::unique_lock lock(owningThreadsMutex);
+        owningThreads.clear();
+    }
+#endif
+    /// Reset the merged flag and the owner, so that the next owner can prepare the buffer
+    sharedReferenceCounter.store(0, std::memory_order_relaxed);
+    owningThread.store(nullptr, std::memory_order_relaxed);
+    const auto recycler = std::move(owningBufferRecycler);
+    numberOfTuples = 0;
+    recycleCallback(owner, recycler.get());
+}
+
 #ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
 BufferControlBlock::ThreadOwnershipInfo::ThreadOwnershipInfo(std::string&& threadName, cpptrace::raw_trace&& callstack)
     : threadName(threadName), callstack(callstack)
@@ -325,5 +497,18 @@ bool BufferControlBlock::loadChildBuffer(
 
     return true;
 }
+
+std::span<uint8_t> BufferControlBlock::loadChildBufferMemoryArea(const VariableSizedAccess::Index index) const
+{
+    PRECONDITION(index.index < children.size(), "Index={} is out of range={}", index, children.size());
+
+    const auto* child = children[index.index];
+    return {child->ptr, child->size};
+}
+}
+
+void releaseBufferOwnership()
+{
+    detail::OwnedBufferControlBlocks::ofCallingThread().mergeAll();
 }
 }
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Time/Timestamp.hpp>
@@ -69,12 +70,21 @@ class MemorySegment;
 #define PLACEHOLDER_LIKELY(cond) (cond) [[likely]]
 #define PLACEHOLDER_UNLIKELY(cond) (cond) [[unlikely]]
 
+class OwnedBufferControlBlocks;
+
 /**
  * @brief This class provides a convenient way to track the reference counter as well metadata for its owning
- * MemorySegment/TupleBuffer. In particular, it stores the atomic reference counter that tracks how many
+ * MemorySegment/TupleBuffer. In particular, it stores the reference counter that tracks how many
  * live reference exists of the owning MemorySegment/TupleBuffer and it also stores the callback to execute
  * when the reference counter reaches 0.
  *
+ * The reference counter is biased towards the thread that prepared the buffer (the owner). Most buffers are obtained, copied,
+ * and released by a single worker thread, thus, the owner modifies a biased counter without atomic read-modify-write operations.
+ * All other threads modify the shared counter atomically, which may become negative if they release references that the owner
+ * created. The owner merges its biased counter into the shared counter and sets the merged flag if its biased counter drops to
+ * zero, if it obtains further buffers and the shared counter became negative, or if it explicitly gives up the ownership via
+ * releaseBufferOwnership. Afterward, all threads use the shared counter and the buffer is recycled once it reaches zero.
+ *
  * Reminder: this class should be header-only to help inlining
  */
 class alignas(64) BufferControlBlock
@@ -113,6 +123,8 @@ public:
     [[nodiscard]] Timestamp getCreationTimestamp() const noexcept;
     [[nodiscard]] VariableSizedAccess::Index storeChildBuffer(BufferControlBlock* control);
     [[nodiscard]] bool loadChildBuffer(VariableSizedAccess::Index index, BufferControlBlock*& control, uint8_t*& ptr, uint32_t& size) const;
+    /// Same as loadChildBuffer() but without retaining the child, as the child is kept alive by this control block
+    [[nodiscard]] std::span<uint8_t> loadChildBufferMemoryArea(VariableSizedAccess::Index index) const;
 
     [[nodiscard]] uint32_t getNumberOfChildBuffers() const noexcept { return children.size(); }
 #ifdef NES_DEBUG_TUPLE_BUFFER_LEAKS
@@ -120,7 +132,24 @@ public:
 #endif
 
 private:
-    std::atomic<int32_t> referenceCounter = 0;
+    friend class OwnedBufferControlBlocks;
+
+    /// The lowest bit of the shared counter is the merged flag, the remaining bits count the shared references.
+    static constexpr int64_t MERGED_FLAG = 1;
+    static constexpr int64_t SHARED_REFERENCE = 2;
+
+    [[nodiscard]] bool isOwnedByCallingThread() const noexcept;
+    /// Moves the biased references into the shared counter and gives up the ownership. Must only be called by the owner.
+    /// The released references are subtracted from the biased references, if the owner releases its last reference while merging.
+    /// Returns true if the shared counter reached zero and the buffer is recycled
+    bool mergeBiasedReferences(int32_t releasedReferences = 0);
+    void recycle();
+
+    /// Only the owner modifies the biased counter. It is atomic solely to allow other threads to read the reference count.
+    /// Between merging and recycling, the owning thread holds a merging token that matches no thread.
+    std::atomic<const void*> owningThread = nullptr;
+    std::atomic<int32_t> biasedReferenceCounter = 0;
+    std::atomic<int64_t> sharedReferenceCounter = 0;
     uint32_t numberOfTuples = 0;
     Timestamp watermark = Timestamp(Timestamp::INITIAL_VALUE);
     SequenceNumber sequenceNumber = INVALID_SEQ_NUMBER;
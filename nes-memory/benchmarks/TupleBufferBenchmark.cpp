@@ -0,0 +1,116 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Runtime/VariableSizedAccess.hpp>
+#include <benchmark/benchmark.h>
+
+/// These Benchmarks measure the reference counting overhead of TupleBuffers. The owner of a buffer, i.e., the thread that obtained it from
+/// the buffer manager, uses the biased reference counter. All other threads fall back to the atomic shared reference counter.
+
+/// Obtains a buffer on a separate thread, so that the calling thread is not the owner of the buffer
+static NES::TupleBuffer getBufferOwnedByOtherThread(NES::BufferManager& bufferManager)
+{
+    NES::TupleBuffer buffer;
+    std::jthread([&] { buffer = bufferManager.getBufferBlocking(); }).join();
+    return buffer;
+}
+
+/// Copying and destroying a buffer by its owner
+static void BM_CopyOwnedBuffer(benchmark::State& state)
+{
+    const auto bufferManager = NES::BufferManager::create(4096, 16);
+    const auto buffer = bufferManager->getBufferBlocking();
+    for (auto _ : state)
+    {
+        NES::TupleBuffer copy(buffer);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+/// Copying and destroying a buffer by a thread that is not the owner
+static void BM_CopySharedBuffer(benchmark::State& state)
+{
+    const auto bufferManager = NES::BufferManager::create(4096, 16);
+    const auto buffer = getBufferOwnedByOtherThread(*bufferManager);
+    for (auto _ : state)
+    {
+        NES::TupleBuffer copy(buffer);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+/// Moving a buffer back and forth does not touch the reference counter at all and serves as a baseline
+static void BM_MoveBuffer(benchmark::State& state)
+{
+    const auto bufferManager = NES::BufferManager::create(4096, 16);
+    auto buffer = bufferManager->getBufferBlocking();
+    for (auto _ : state)
+    {
+        NES::TupleBuffer moved(std::move(buffer));
+        buffer = std::move(moved);
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+
+/// Loading child buffers, as done by every access to a variable-sized field
+static void BM_LoadChildBuffers(benchmark::State& state)
+{
+    const auto numberOfChildren = static_cast<size_t>(state.range(0));
+    const auto bufferManager = NES::BufferManager::create(4096, numberOfChildren + 1);
+    auto parent = bufferManager->getBufferBlocking();
+    std::vector<NES::VariableSizedAccess::Index> childIndexes;
+    for (size_t i = 0; i < numberOfChildren; ++i)
+    {
+        auto child = bufferManager->getBufferBlocking();
+        childIndexes.emplace_back(parent.storeChildBuffer(child));
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto& childIndex : childIndexes)
+        {
+            auto child = parent.loadChildBuffer(childIndex);
+            benchmark::DoNotOptimize(child);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * numberOfChildren));
+}
+
+/// Obtaining a buffer, attaching a child, and releasing both, as done for every buffer of a pipeline with variable-sized data
+static void BM_GetBufferWithChildAndRelease(benchmark::State& state)
+{
+    const auto bufferManager = NES::BufferManager::create(4096, 16);
+    for (auto _ : state)
+    {
+        auto parent = bufferManager->getBufferBlocking();
+        auto child = bufferManager->getBufferBlocking();
+        benchmark::DoNotOptimize(parent.storeChildBuffer(child));
+    }
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_CopyOwnedBuffer);
+BENCHMARK(BM_CopySharedBuffer);
+BENCHMARK(BM_MoveBuffer);
+BENCHMARK(BM_LoadChildBuffers)->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK(BM_GetBufferWithChildAndRelease);
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -33,6 +33,7 @@
 namespace NES
 {
 class UnpooledChunksManager;
+class RecordBuffer;
 }
 
 namespace NES
@@ -73,6 +74,8 @@ class TupleBuffer
     friend class FixedSizeBufferPool;
     friend class LocalBufferPool;
     friend class detail::MemorySegment;
+    /// Reads the memory area directly in the traced code instead of calling a proxy function
+    friend class RecordBuffer;
 
     [[nodiscard]] explicit TupleBuffer(detail::BufferControlBlock* controlBlock, uint8_t* ptr, uint32_t size) noexcept
         : controlBlock(controlBlock), ptr(ptr), size(size)
@@ -179,6 +182,10 @@ public:
     ///@brief retrieve a child tuple buffer via its NestedTupleBufferKey
     [[nodiscard]] TupleBuffer loadChildBuffer(VariableSizedAccess::Index bufferIndex) const noexcept;
 
+    ///@brief retrieve the memory area of a child tuple buffer without retaining it. The memory area stays valid as long as this buffer
+    /// is alive, as the parent holds a reference to all of its children.
+    [[nodiscard]] std::span<std::byte> loadChildBufferMemoryArea(VariableSizedAccess::Index bufferIndex) const noexcept;
+
     [[nodiscard]] uint32_t getNumberOfChildBuffers() const noexcept;
 
 private:
@@ -197,4 +204,9 @@ private:
  * @param bufferPointer pointer to the data region of an buffer.
  */
 [[maybe_unused]] bool recycleTupleBuffer(void* bufferPointer);
+
+/// The thread that obtains a buffer from a buffer provider owns its reference counter and modifies it without atomic operations until
+/// it gives up the ownership. A buffer that was released by other threads is only recycled once its owner gave up the ownership.
+/// Therefore, threads must call this before they become idle or block for a long time, e.g., after each task or while waiting for buffers.
+void releaseBufferOwnership();
 }
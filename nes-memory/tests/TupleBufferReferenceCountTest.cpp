@@ -0,0 +1,163 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <gtest/gtest.h>
+
+namespace NES
+{
+
+TEST(TupleBufferReferenceCountTest, OwnerCopiesAndReleases)
+{
+    const auto bufferManager = BufferManager::create(1024, 1);
+    {
+        const auto buffer = bufferManager->getBufferBlocking();
+        EXPECT_EQ(buffer.getReferenceCounter(), 1);
+        {
+            const auto copy = buffer; /// NOLINT(performance-unnecessary-copy-initialization)
+            EXPECT_EQ(buffer.getReferenceCounter(), 2);
+        }
+        EXPECT_EQ(buffer.getReferenceCounter(), 1);
+        EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 0);
+    }
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 1);
+}
+
+/// The owner releases its last reference first and merges its counter, thus, the other thread releasing the last reference recycles it
+TEST(TupleBufferReferenceCountTest, OtherThreadReleasesLastReference)
+{
+    const auto bufferManager = BufferManager::create(1024, 1);
+    auto buffer = bufferManager->getBufferBlocking();
+    TupleBuffer sharedCopy;
+    std::jthread([&buffer, &sharedCopy] { sharedCopy = buffer; }).join();
+    EXPECT_EQ(buffer.getReferenceCounter(), 2);
+
+    buffer.release();
+    EXPECT_EQ(sharedCopy.getReferenceCounter(), 1);
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 0);
+    std::jthread([&sharedCopy] { sharedCopy.release(); }).join();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 1);
+
+    /// The recycled buffer can be obtained again
+    const auto recycledBuffer = bufferManager->getBufferBlocking();
+    EXPECT_EQ(recycledBuffer.getReferenceCounter(), 1);
+}
+
+/// The owner keeps references, which other threads released. Thus, the buffer is only recycled once the owner gives up the ownership.
+TEST(TupleBufferReferenceCountTest, OwnerGivesUpOwnership)
+{
+    const auto bufferManager = BufferManager::create(1024, 1);
+    auto buffer = bufferManager->getBufferBlocking();
+    std::jthread([buffer = std::move(buffer)]() mutable { buffer.release(); }).join();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 0);
+
+    releaseBufferOwnership();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 1);
+}
+
+/// Other threads release references that were retained by the owner, thus, the shared counter becomes negative
+TEST(TupleBufferReferenceCountTest, ConcurrentCopiesAndReleases)
+{
+    constexpr size_t numberOfThreads = 8;
+    constexpr size_t numberOfCopies = 10000;
+    const auto bufferManager = BufferManager::create(1024, 1);
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        std::vector<std::vector<TupleBuffer>> copiesPerThread(numberOfThreads, std::vector<TupleBuffer>(numberOfCopies, buffer));
+        {
+            std::vector<std::jthread> threads;
+            for (auto& copies : copiesPerThread)
+            {
+                threads.emplace_back(
+                    [&copies, &buffer]
+                    {
+                        for (auto& copy : copies)
+                        {
+                            TupleBuffer anotherCopy = copy;
+                            copy.release();
+                            anotherCopy = buffer;
+                        }
+                    });
+            }
+        }
+        EXPECT_EQ(buffer.getReferenceCounter(), 1);
+    }
+    releaseBufferOwnership();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 1);
+}
+
+/// Another thread holding a reference never observes a count below one, even while the owner retains, releases, and merges its counter
+TEST(TupleBufferReferenceCountTest, OtherThreadObservesPositiveCountWhileOwnerMerges)
+{
+    constexpr size_t numberOfRounds = 1000;
+    const auto bufferManager = BufferManager::create(1024, 1);
+    for (size_t round = 0; round < numberOfRounds; ++round)
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        std::atomic<bool> merged = false;
+        std::jthread reader(
+            [sharedCopy = buffer, &merged]
+            {
+                do
+                {
+                    ASSERT_GE(sharedCopy.getReferenceCounter(), 1);
+                } while (!merged.load());
+                EXPECT_EQ(sharedCopy.getReferenceCounter(), 1);
+            });
+        {
+            const auto copy = buffer; /// NOLINT(performance-unnecessary-copy-initialization)
+        }
+        buffer.release();
+        releaseBufferOwnership();
+        merged.store(true);
+    }
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 1);
+}
+
+/// Child buffers are released when the parent, which was released by another thread, is recycled after its owner gave up the ownership
+TEST(TupleBufferReferenceCountTest, ChildBuffersAreReleasedByOtherThread)
+{
+    const auto bufferManager = BufferManager::create(1024, 2);
+    auto parent = bufferManager->getBufferBlocking();
+    auto child = bufferManager->getBufferBlocking();
+    const auto childIndex = parent.storeChildBuffer(child);
+    EXPECT_EQ(parent.loadChildBuffer(childIndex).getReferenceCounter(), 2);
+
+    std::jthread([parent = std::move(parent)]() mutable { parent.release(); }).join();
+    releaseBufferOwnership();
+    EXPECT_EQ(bufferManager->getNumberOfAvailableBuffers(), 2);
+}
+
+/// Loading the memory area of a child buffer does not retain the child, as the parent keeps it alive
+TEST(TupleBufferReferenceCountTest, LoadingChildMemoryAreaDoesNotRetain)
+{
+    const auto bufferManager = BufferManager::create(1024, 2);
+    auto parent = bufferManager->getBufferBlocking();
+    auto child = bufferManager->getBufferBlocking();
+    const auto* childMemory = child.getAvailableMemoryArea().data();
+    const auto childIndex = parent.storeChildBuffer(child);
+
+    const auto childMemoryArea = parent.loadChildBufferMemoryArea(childIndex);
+    EXPECT_EQ(childMemoryArea.data(), childMemory);
+    EXPECT_EQ(childMemoryArea.size(), 1024);
+    EXPECT_EQ(parent.loadChildBuffer(childIndex).getReferenceCounter(), 2);
+}
+
+}
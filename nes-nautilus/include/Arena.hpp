@@ -17,6 +17,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <span>
 #include <utility>
 #include <vector>
@@ -41,11 +42,20 @@ struct Arena
     /// 3. The required size is smaller than the last buffer size. In this case, we return the pointer to the address in the last buffer.
     std::span<std::byte> allocateMemory(size_t sizeInBytes);
 
+    /// Allocates at least the required size and hands out all remaining memory of the last buffer in one chunk.
+    /// The ArenaRef carves subsequent allocations from this chunk in the traced code, without calling into the arena for every tuple.
+    /// The size of the returned chunk is stored in lastChunkSize, so that it can be read from the traced code.
+    std::span<std::byte> allocateRemainingMemory(size_t minimumSizeInBytes);
+
     std::shared_ptr<AbstractBufferProvider> bufferProvider;
     std::vector<TupleBuffer> fixedSizeBuffers;
     std::vector<TupleBuffer> unpooledBuffers;
     size_t lastAllocationSize{0};
     size_t currentOffset{0};
+    size_t lastChunkSize{0};
+    /// Locks that the traced code acquired via proxy functions and has not released yet. If the pipeline invocation fails while holding
+    /// them, e.g., as no memory can be allocated, destroying the arena releases them. Thus, other worker threads do not wait forever.
+    std::vector<std::unique_lock<std::mutex>> heldLocks;
 };
 
 /// Nautilus Wrapper for the Arena
@@ -53,7 +63,9 @@ struct ArenaRef
 {
     explicit ArenaRef(const nautilus::val<Arena*>& arenaRef) : arenaRef(arenaRef), availableSpaceForPointer(0), spacePointer(nullptr) { }
 
-    /// Allocates memory from the arena. If the available space for the pointer is smaller than the required size, we allocate a new buffer from the arena.
+    /// Allocates memory from the arena. If the available space for the pointer is smaller than the required size, we allocate a new chunk
+    /// from the arena. Otherwise, the memory is taken from the current chunk by bumping the space pointer without leaving the traced code.
+    /// As the ArenaRef owns its current chunk, copies of an ArenaRef must not allocate memory concurrently to the original.
     nautilus::val<int8_t*> allocateMemory(const nautilus::val<size_t>& sizeInBytes);
 
     VariableSizedData allocateVariableSizedData(const nautilus::val<uint32_t>& sizeInBytes);
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <Nautilus/Interface/NESStrongTypeRef.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <nautilus/std/sstream.h>
 #include <nautilus/val.hpp>
 
@@ -35,6 +36,12 @@ public:
     /// @param bufferBacked: If set to true the VariableSizedData object is backed by a tuple buffer.
     explicit VariableSizedData(const nautilus::val<int8_t*>& reference, const nautilus::val<uint32_t>& size);
     explicit VariableSizedData(const nautilus::val<int8_t*>& pointerToVarSizedData);
+    /// Creates a VariableSizedData that has been read from a child buffer of backingBuffer via the combined index backingAccess.
+    /// As long as the VariableSizedData is not replaced by a newly created one, e.g., by a function, it still refers to this child buffer.
+    explicit VariableSizedData(
+        const nautilus::val<int8_t*>& pointerToVarSizedData,
+        const nautilus::val<TupleBuffer*>& backingBuffer,
+        const nautilus::val<uint64_t>& backingAccess);
     VariableSizedData(const VariableSizedData& other);
     VariableSizedData& operator=(const VariableSizedData& other) noexcept;
     VariableSizedData(VariableSizedData&& other) noexcept;
@@ -53,6 +60,12 @@ public:
     /// Returns the pointer to the variable sized data, this means the pointer to the size + data
     [[nodiscard]] nautilus::val<int8_t*> getReference() const;
 
+    /// Returns the tuple buffer, in whose child buffer the variable sized data is stored, or a nullptr, if it is not stored in one
+    [[nodiscard]] nautilus::val<TupleBuffer*> getBackingBuffer() const;
+
+    /// Returns the VariableSizedAccess::CombinedIndex of the variable sized data in its backing buffer
+    [[nodiscard]] nautilus::val<uint64_t> getBackingAccess() const;
+
     /// Declaring friend for it, so that we can access the members in it and do not have to declare getters for it
     friend nautilus::val<std::ostream>& operator<<(nautilus::val<std::ostream>& oss, const VariableSizedData& variableSizedData);
     friend nautilus::val<bool> operator==(const VariableSizedData& varSizedData, const nautilus::val<bool>& other);
@@ -68,6 +81,9 @@ public:
 private:
     nautilus::val<uint32_t> size;
     nautilus::val<int8_t*> ptrToVarSized;
+    /// Lets operators, e.g., the emit, refer to the child buffer instead of copying the variable sized data
+    nautilus::val<TupleBuffer*> backingBuffer;
+    nautilus::val<uint64_t> backingAccess;
 };
 
 
@@ -62,11 +62,29 @@ public:
         const RecordBuffer& recordBuffer,
         nautilus::val<uint64_t>& recordIndex) const override;
 
+    Record readRecordLazily(
+        const std::vector<Record::RecordFieldIdentifier>& projections,
+        const RecordBuffer& recordBuffer,
+        nautilus::val<uint64_t>& recordIndex) const override;
+
     void writeRecord(
         nautilus::val<uint64_t>& recordIndex,
         const RecordBuffer& recordBuffer,
         const Record& rec,
         const nautilus::val<AbstractBufferProvider*>& bufferProvider) const override;
+
+    [[nodiscard]] RecordCursor createCursor(const RecordBuffer& recordBuffer, const nautilus::val<uint64_t>& recordIndex) const override;
+
+    Record readRecordLazilyAtCursor(
+        const std::vector<Record::RecordFieldIdentifier>& projections,
+        const RecordBuffer& recordBuffer,
+        const RecordCursor& cursor) const override;
+
+    void writeRecordAtCursor(
+        RecordCursor& cursor,
+        const RecordBuffer& recordBuffer,
+        const Record& rec,
+        const nautilus::val<AbstractBufferProvider*>& bufferProvider) const override;
 };
 
 }
@@ -17,7 +17,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <span>
+#include <vector>
 
 #include <DataTypes/DataType.hpp>
 #include <DataTypes/Schema.hpp>
@@ -27,12 +29,12 @@
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Runtime/VariableSizedAccess.hpp>
+#include <val.hpp>
 #include <val_ptr.hpp>
 
 namespace NES
 {
 
-
 /// This class takes care of reading and writing data from/to a TupleBuffer.
 /// A TupleBufferRef is closely coupled with a memory layout, and we support row and column layouts, currently.
 /// We store multiple variable sized datas in one pooled buffer. If the pooled buffer is not large enough or there are no pooled buffer
@@ -48,6 +50,54 @@ public:
     TupleBufferRef(uint64_t capacity, uint64_t bufferSize, uint64_t tupleSize);
     virtual ~TupleBufferRef();
 
+    /// Position in the last child buffer of a record buffer, to which the next variable sized value gets appended.
+    /// Appending a value that fits into the child buffer is an inline bounds check and copy. Only if the value does not fit, we call
+    /// writeVarSized() to acquire a new child buffer. As the inline path does not update the used bytes of the child buffer, they get
+    /// published before a new child buffer is acquired and via flushCursor() before the record buffer is handed over.
+    /// Values that have been read unmodified from a child buffer of forwardingBuffer are not copied. Instead, the child buffer gets
+    /// attached to the record buffer and only the child index of the VariableSizedAccess is rewritten. An attached child buffer is shared
+    /// with forwardingBuffer, thus, the cursor never appends to it and always acquires its own child buffers.
+    struct VarSizedWriteCursor
+    {
+        /// Index of the child buffer, already shifted to the upper half of a VariableSizedAccess::CombinedIndex
+        nautilus::val<uint64_t> childIndexBits;
+        nautilus::val<int8_t*> childAddress;
+        nautilus::val<uint64_t> usedBytes;
+        /// Is zero as long as the cursor does not point to a child buffer
+        nautilus::val<uint64_t> childBufferSize;
+        /// Buffer whose child buffers may be attached instead of copying their values, forwarding is disabled for a nullptr
+        nautilus::val<TupleBuffer*> forwardingBuffer;
+        /// Child index bits of the child buffer of forwardingBuffer that has been attached last and its child index bits in the record
+        /// buffer. NO_FORWARDED_CHILD, if no child buffer has been attached to the record buffer yet.
+        nautilus::val<uint64_t> forwardedChildIndexBits;
+        nautilus::val<uint64_t> attachedChildIndexBits;
+
+        static constexpr uint64_t NO_FORWARDED_CHILD = ~uint64_t{0};
+    };
+
+    /// Position of a record in a tuple buffer, which gets advanced record by record, e.g., by scans and emits.
+    /// Instead of computing bufferAddress + offset + recordIndex * size for every field of every record, a cursor keeps running addresses
+    /// that advance by a constant stride. The layout decides what an address points to, e.g., a record or a field of a column.
+    struct RecordCursor
+    {
+        nautilus::val<uint64_t> recordIndex;
+        std::vector<nautilus::val<int8_t*>> addresses;
+        std::vector<uint64_t> strides;
+        /// Only present for layouts with variable sized fields and solely used for writing records at the cursor
+        std::optional<VarSizedWriteCursor> varSizedWriteCursor;
+
+        /// Moves the cursor to the next record
+        void advance();
+
+        /// Moves the cursor to the position of the other cursor, e.g., of a new record buffer. Assigns the values one by one, as they
+        /// are loop-carried across the records that get written with this cursor. Keeps the forwardingBuffer, as it does not depend on
+        /// the record buffer that is written to.
+        void reset(const RecordCursor& other);
+
+        /// Lets the cursor attach child buffers of the forwardingBuffer instead of copying values that have been read from them
+        void setForwardingBuffer(const nautilus::val<TupleBuffer*>& forwardingBuffer);
+    };
+
     /// Used in letting the TupleBufferRef know, if the size of the variable sized data should be prepended or not.
     enum PrependMode : uint8_t
     {
@@ -74,6 +124,14 @@ public:
         nautilus::val<uint64_t>& recordIndex) const
         = 0;
 
+    /// Reads a record like readRecord(), but only stores the field addresses in the record. The load of a field gets traced whenever the
+    /// field is read, e.g., only after a selection has qualified the record. Defaults to readRecord() for TupleBufferRefs that can not
+    /// provide lazy fields.
+    virtual Record readRecordLazily(
+        const std::vector<Record::RecordFieldIdentifier>& projections,
+        const RecordBuffer& recordBuffer,
+        nautilus::val<uint64_t>& recordIndex) const;
+
     /// Writes a record from the given bufferAddress and recordIndex.
     /// @param recordBuffer: Stores the memRef to the memory segment of a tuplebuffer, e.g., tuplebuffer.getMemArea()
     /// @param recordIndex: Index of the record to be stored to
@@ -85,6 +143,25 @@ public:
         const nautilus::val<AbstractBufferProvider*>& bufferProvider) const
         = 0;
 
+    /// Creates a cursor pointing to the record at recordIndex. The cursor must only be used with the recordBuffer it was created for.
+    /// Defaults to a cursor that only stores the record index for TupleBufferRefs without running addresses.
+    [[nodiscard]] virtual RecordCursor createCursor(const RecordBuffer& recordBuffer, const nautilus::val<uint64_t>& recordIndex) const;
+
+    /// Reads the record at the position of the cursor like readRecordLazily(), without recomputing the field addresses
+    virtual Record readRecordLazilyAtCursor(
+        const std::vector<Record::RecordFieldIdentifier>& projections, const RecordBuffer& recordBuffer, const RecordCursor& cursor) const;
+
+    /// Writes the record to the position of the cursor like writeRecord(), without recomputing the field addresses.
+    /// Variable sized values get appended via the VarSizedWriteCursor of the cursor, if the cursor has one.
+    virtual void writeRecordAtCursor(
+        RecordCursor& cursor,
+        const RecordBuffer& recordBuffer,
+        const Record& rec,
+        const nautilus::val<AbstractBufferProvider*>& bufferProvider) const;
+
+    /// Publishes the bytes that the cursor has appended to the current child buffer. Must be called before the record buffer is emitted.
+    static void flushCursor(const RecordCursor& cursor, const RecordBuffer& recordBuffer);
+
     [[nodiscard]] uint64_t getCapacity() const;
     [[nodiscard]] uint64_t getBufferSize() const;
     [[nodiscard]] uint64_t getTupleSize() const;
@@ -97,6 +174,11 @@ protected:
     /// to the buffer if the type is of variable sized
     static VarVal loadValue(const DataType& type, const RecordBuffer& recordBuffer, const nautilus::val<int8_t*>& fieldReference);
 
+    /// Creates the loader of a lazy field that loads the value via loadValue() on the first read and returns the loaded value afterward.
+    /// Must be called where the record gets created, as the loaded value and a flag, whether it has been loaded, are declared here.
+    static Record::LazyFieldLoader
+    createLazyFieldLoader(const DataType& type, const RecordBuffer& recordBuffer, const nautilus::val<int8_t*>& fieldReference);
+
     /// Currently, this method does not support Null handling. It stores an VarVal of type to the fieldReference
     /// We require the recordBuffer, as we store variable sized data in a childbuffer and therefore, we need access
     /// to the buffer if the type is of variable sized
@@ -107,6 +189,19 @@ protected:
         VarVal value,
         const nautilus::val<AbstractBufferProvider*>& bufferProvider);
 
+    /// Stores the value like storeValue(), but appends a variable sized value inline via the varSizedWriteCursor
+    static VarVal storeValue(
+        const DataType& type,
+        const RecordBuffer& recordBuffer,
+        const nautilus::val<int8_t*>& fieldReference,
+        VarVal value,
+        const nautilus::val<AbstractBufferProvider*>& bufferProvider,
+        std::optional<VarSizedWriteCursor>& varSizedWriteCursor);
+
+    /// Creates a VarSizedWriteCursor that does not point to a child buffer yet, if any of the given data types is variable sized
+    static std::optional<VarSizedWriteCursor>
+    createVarSizedWriteCursor(const RecordBuffer& recordBuffer, const std::vector<DataType>& dataTypes);
+
     [[nodiscard]] static bool
     includesField(const std::vector<Record::RecordFieldIdentifier>& projections, const Record::RecordFieldIdentifier& fieldIndex);
 };
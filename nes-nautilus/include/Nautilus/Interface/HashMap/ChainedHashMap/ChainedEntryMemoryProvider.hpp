@@ -37,11 +37,21 @@ struct FieldOffsets
 };
 
 /// ChainedHashMapEntry uses for reading and writing either the keys or values
+/// A variable sized field takes VAR_SIZED_FIELD_SIZE bytes in the entry and starts with the uint32_t size of its content. Contents of up to
+/// MAX_INLINED_VAR_SIZED_CONTENT_SIZE bytes are stored inline after the size, so that comparing them does not require a pointer chase.
+/// Larger contents are stored in the var sized space of the hash map and the field stores the pointer to them at VAR_SIZED_POINTER_OFFSET.
 class ChainedEntryMemoryProvider
 {
 public:
+    static constexpr uint64_t VAR_SIZED_FIELD_SIZE = 16;
+    static constexpr uint64_t MAX_INLINED_VAR_SIZED_CONTENT_SIZE = VAR_SIZED_FIELD_SIZE - sizeof(uint32_t);
+    static constexpr uint64_t VAR_SIZED_POINTER_OFFSET = VAR_SIZED_FIELD_SIZE - sizeof(int8_t*);
+
     explicit ChainedEntryMemoryProvider(std::vector<FieldOffsets> fields) : fields(std::move(fields)) { }
 
+    /// Returns the number of bytes that a field of the given type takes in a ChainedHashMapEntry
+    static uint64_t getFieldSizeInEntry(const DataType& type);
+
     /// We need to create the fields for the keys and values here, as we know here how the fields and the values are stored in the ChainedHashMapEntry.
     /// We can use here "normal" C++ values, as only the C++ runtime MUST call this method
     static std::pair<std::vector<FieldOffsets>, std::vector<FieldOffsets>> createFieldOffsets(
@@ -58,6 +58,11 @@ public:
 /// The storage space contains individual key-value pairs. It does not support variable length keys or values for now.
 /// For keys, one could project them beforehand to a fixed length representation, e.g., uin64_t, and then use the newly mapped key.
 ///
+/// Tagged Bucket Heads:
+/// Pointers only use the lower 48 bits on the platforms that we support. Thus, each pointer in the entry space stores a 16-bit bloom
+/// filter of the hashes in its chain in the upper 16 bits, similar to the salt of DuckDB or the tagged pointers of Umbra. A lookup skips
+/// the chain, if the tag of its hash is not set, and only compares the keys of entries whose stored hash is equal to its hash.
+///
 /// IMPORTANT:
 /// 1. This hash map is *NOT* thread save and allows for no concurrent accesses, as it does not use any locking, atomics or synchronization primitives.
 /// 2. This hash map does not clear the content of the entry. So it is up to the user to initialize values correctly.
@@ -74,9 +79,27 @@ public:
         uint64_t numberOfEntries{0};
     };
 
+    static constexpr uint64_t NUMBER_OF_POINTER_BITS = 48;
+    static constexpr uint64_t TAG_MASK = ~((uint64_t{1} << NUMBER_OF_POINTER_BITS) - 1);
+    /// The tag bit of a hash is chosen by its upper bits, as its lower bits are already used for choosing the bucket
+    static constexpr uint64_t TAG_HASH_SHIFT = 60;
+
+    /// Returns the bit that the hash sets in the tag of its bucket head
+    static constexpr uint64_t getTag(const HashFunction::HashValue::raw_type hash)
+    {
+        return uint64_t{1} << (NUMBER_OF_POINTER_BITS + (hash >> TAG_HASH_SHIFT));
+    }
+
     ChainedHashMap(uint64_t entrySize, uint64_t numberOfBuckets, uint64_t pageSize);
     ChainedHashMap(uint64_t keySize, uint64_t valueSize, uint64_t numberOfBuckets, uint64_t pageSize);
     ~ChainedHashMap() override;
+
+    /// entries and pageStartsData point into the entry space and pageStarts of this hash map, which a copy would not fix up
+    ChainedHashMap(const ChainedHashMap&) = delete;
+    ChainedHashMap& operator=(const ChainedHashMap&) = delete;
+    ChainedHashMap(ChainedHashMap&&) = delete;
+    ChainedHashMap& operator=(ChainedHashMap&&) = delete;
+
     [[nodiscard]] ChainedHashMapEntry* findChain(HashFunction::HashValue::raw_type hash) const;
     std::span<std::byte> allocateSpaceForVarSized(AbstractBufferProvider* bufferProvider, size_t neededSize);
     AbstractHashMapEntry* insertEntry(HashFunction::HashValue::raw_type hash, AbstractBufferProvider* bufferProvider) override;
@@ -89,6 +112,13 @@ public:
     /// Clears and deletes all entries in the hash map. It also releases the memory of any allocated buffers or other memory.
     void clear() noexcept;
 
+    /// Deletes all entries in the hash map, but retains the entry space and up to maxNumberOfRetainedPages pages of the storage space.
+    /// Thus, the hash map can be reused for new entries without allocating memory again.
+    void reset(uint64_t maxNumberOfRetainedPages) noexcept;
+
+    /// Returns true, if this hash map has the same layout as a new hash map with the passed configuration would have
+    [[nodiscard]] bool hasConfiguration(uint64_t keySize, uint64_t valueSize, uint64_t numberOfBuckets, uint64_t pageSize) const;
+
     /// The passed method is being executed, once the destructor is called. This is necessary as the value type of this hash map
     /// might allocate its own memory. Thus, the destructor of the value type should be called to release the memory.
     void setDestructorCallback(const std::function<void(ChainedHashMapEntry*)>& callback);
@@ -99,17 +129,29 @@ public:
 private:
     friend class ChainedHashMapRef;
 
+    /// Removes the tag from a pointer of the entry space
+    static ChainedHashMapEntry* untag(ChainedHashMapEntry* taggedEntry);
+
+    /// Calls the destructor callback for every entry in the hash map
+    void destroyEntries() noexcept;
+
     /// Specifies the number of pre-allocated var sized
     static constexpr auto NUMBER_OF_PRE_ALLOCATED_VAR_SIZED_ITEMS = 100;
     TupleBuffer entrySpace;
     std::vector<TupleBuffer> storageSpace;
+    std::vector<TupleBuffer> retainedPages; /// Pages of the storage space that have been retained by reset() and are used for new entries
     std::vector<TupleBuffer> varSizedSpace;
+    /// Start addresses of all pages in the storage space, followed by a nullptr. As we fill one page after another, all pages except for
+    /// the last one contain entriesPerPage entries. Thus, the EntryIterator reads this contiguous array from traced code and does not
+    /// need to call into the hash map for every page.
+    std::vector<int8_t*> pageStarts;
+    int8_t** pageStartsData; /// Points to the data of pageStarts, as traced code can not access the vector
     uint64_t numberOfTuples; /// Number of entries in the hash map
     uint64_t pageSize; /// Size of one storage page in bytes
     uint64_t entrySize; /// Size of one entry: sizeof(ChainedHashMapEntry) + keySize + valueSize
     uint64_t entriesPerPage; /// Number of entries per page
     uint64_t numberOfChains; /// Number of buckets in the hash map
-    ChainedHashMapEntry** entries; /// Stores the pointers to the first entry in each chain
+    ChainedHashMapEntry** entries; /// Stores the tagged pointers to the first entry in each chain
     HashFunction::HashValue::raw_type mask; /// Mask to calculate the bucket position from the hash value. Always a (power of 2)-1
     std::function<void(ChainedHashMapEntry*)> destructorCallBack; /// Callback function to be executed, once the destructor is called
 };
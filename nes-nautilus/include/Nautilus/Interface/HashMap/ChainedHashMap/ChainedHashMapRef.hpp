@@ -77,34 +77,33 @@ public:
     };
 
     /// Iterator for iterating over all entries in the hash map.
-    /// The idea is that we are starting at each chain until we reach the end of the chain.
-    /// Then, we are moving to the next chain until we reach the end of the hash map.
+    /// The idea is that we are iterating over the entries of one page after another, as they are stored in the storage space.
+    /// All pages except for the last one are full. Thus, we only read the start of the next page from the contiguous page starts of
+    /// the hash map, once we have seen entriesPerPage entries, without calling into the hash map.
     class EntryIterator
     {
     public:
         EntryIterator(
-            const nautilus::val<HashMap*>& hashMapRef,
+            const nautilus::val<int8_t*>& pageStarts,
             const nautilus::val<ChainedHashMapEntry*>& currentEntry,
             const nautilus::val<uint64_t>& entrySize,
+            const nautilus::val<uint64_t>& entriesPerPage,
             const nautilus::val<uint64_t>& tupleIndex,
             const nautilus::val<uint64_t>& indexOnPage,
-            const nautilus::val<uint64_t>& numberOfTuplesInCurrentPage,
-            const nautilus::val<uint64_t>& pageIndex,
-            const nautilus::val<uint64_t>& numberOfPages);
+            const nautilus::val<uint64_t>& pageIndex);
         EntryIterator& operator++();
         nautilus::val<bool> operator==(const EntryIterator& other) const;
         nautilus::val<bool> operator!=(const EntryIterator& other) const;
         nautilus::val<ChainedHashMapEntry*> operator*() const;
 
     private:
-        nautilus::val<HashMap*> hashMapRef;
+        nautilus::val<int8_t*> pageStarts;
         nautilus::val<ChainedHashMapEntry*> currentEntry;
         nautilus::val<uint64_t> entrySize;
+        nautilus::val<uint64_t> entriesPerPage;
         nautilus::val<uint64_t> tupleIndex;
         nautilus::val<uint64_t> indexOnPage;
-        nautilus::val<uint64_t> numberOfTuplesInCurrentPage;
         nautilus::val<uint64_t> pageIndex;
-        nautilus::val<uint64_t> numberOfPages;
     };
 
     ChainedHashMapRef(
@@ -122,6 +121,12 @@ public:
         const HashFunction& hashFunction,
         const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onInsert,
         const nautilus::val<AbstractBufferProvider*>& bufferProvider) override;
+    /// Same as findOrCreateEntry() above, but takes the hash of the keys of recordKey, if the caller has already calculated it
+    nautilus::val<AbstractHashMapEntry*> findOrCreateEntry(
+        const Record& recordKey,
+        const HashFunction::HashValue& hashValue,
+        const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onInsert,
+        const nautilus::val<AbstractBufferProvider*>& bufferProvider);
     void insertOrUpdateEntry(
         const nautilus::val<AbstractHashMapEntry*>& otherEntry,
         const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onUpdate,
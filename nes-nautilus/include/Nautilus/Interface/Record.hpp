@@ -14,7 +14,10 @@
 
 #pragma once
 
+#include <functional>
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include <Nautilus/DataTypes/VarVal.hpp>
 
 namespace NES
@@ -22,18 +25,24 @@ namespace NES
 
 /// A record is the primitive abstraction of a single entry/tuple in a data set.
 /// Operators receiving records can read and write fields of the record.
+/// A field can either be materialized or lazy. A lazy field stores how to load the field, e.g., from a tuple buffer, and traces the load
+/// when the field is read. Thus, the load is placed at its use, e.g., after a selection, instead of at the creation of the record.
+/// The loader decides whether it loads the field again on later reads, see TupleBufferRef::createLazyFieldLoader().
 class Record
 {
 public:
     using RecordFieldIdentifier = std::string;
+    using LazyFieldLoader = std::function<VarVal()>;
     explicit Record() = default;
     explicit Record(std::unordered_map<RecordFieldIdentifier, VarVal>&& recordFields);
     ~Record() = default;
 
     /// Adds all fields from the other record to this record. This will overwrite existing fields.
     void reassignFields(const Record& other);
-    const VarVal& read(const RecordFieldIdentifier& recordFieldIdentifier) const;
+    VarVal read(const RecordFieldIdentifier& recordFieldIdentifier) const;
     void write(const RecordFieldIdentifier& recordFieldIdentifier, const VarVal& varVal);
+    /// Adds a lazy field, whose loader gets called on every read. This will overwrite an existing field.
+    void writeLazy(const RecordFieldIdentifier& recordFieldIdentifier, LazyFieldLoader loader);
     nautilus::val<uint64_t> getNumberOfFields() const;
     [[nodiscard]] bool hasField(const RecordFieldIdentifier& fieldName) const;
 
@@ -43,7 +52,10 @@ public:
     friend nautilus::val<bool> operator!=(const Record& lhs, const Record& rhs) { return !(lhs == rhs); }
 
 private:
+    [[nodiscard]] std::vector<RecordFieldIdentifier> getAllFieldIdentifiers() const;
+
     std::unordered_map<RecordFieldIdentifier, VarVal> recordFields;
+    std::unordered_map<RecordFieldIdentifier, LazyFieldLoader> lazyFields;
 };
 
 }
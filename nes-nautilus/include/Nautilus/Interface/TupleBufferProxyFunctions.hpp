@@ -21,11 +21,6 @@
 
 namespace NES::ProxyFunctions
 {
-inline int8_t* NES_Memory_TupleBuffer_getMemArea(TupleBuffer* tupleBuffer)
-{
-    return reinterpret_cast<int8_t*>(tupleBuffer->getAvailableMemoryArea().data());
-};
-
 inline uint64_t NES_Memory_TupleBuffer_getBufferSize(const TupleBuffer* tupleBuffer)
 {
     return tupleBuffer->getBufferSize();
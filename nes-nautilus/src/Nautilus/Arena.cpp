@@ -14,6 +14,7 @@
 
 #include <Arena.hpp>
 
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
 #include <ErrorHandling.hpp>
 #include <function.hpp>
@@ -66,19 +67,53 @@ std::span<std::byte> Arena::allocateMemory(const size_t sizeInBytes)
     return result;
 }
 
+std::span<std::byte> Arena::allocateRemainingMemory(const size_t minimumSizeInBytes)
+{
+    /// The required size does not fit into a pooled buffer. Thus, there is no remaining memory to hand out.
+    if (bufferProvider->getBufferSize() < minimumSizeInBytes)
+    {
+        const auto result = allocateMemory(minimumSizeInBytes);
+        lastChunkSize = result.size();
+        return result;
+    }
+
+    if (fixedSizeBuffers.empty() or fixedSizeBuffers.back().getBufferSize() < currentOffset + minimumSizeInBytes)
+    {
+        fixedSizeBuffers.emplace_back(bufferProvider->getBufferBlocking());
+        currentOffset = 0;
+    }
+
+    /// We hand out everything up to the end of the last buffer. Subsequent calls to allocateMemory() will thus start a new buffer.
+    auto& lastBuffer = fixedSizeBuffers.back();
+    lastAllocationSize = lastBuffer.getBufferSize();
+    const auto result = lastBuffer.getAvailableMemoryArea().subspan(currentOffset, lastAllocationSize - currentOffset);
+    currentOffset = lastAllocationSize;
+    lastChunkSize = result.size();
+    return result;
+}
+
 nautilus::val<int8_t*> ArenaRef::allocateMemory(const nautilus::val<size_t>& sizeInBytes)
 {
-    /// If the available space for the pointer is smaller than the required size, we allocate a new buffer from the arena.
-    /// We use the arena's allocateMemory function to allocate a new buffer and set the available space for the pointer to the last allocation size.
-    /// Further, we set the space pointer to the beginning of the new buffer.
-    const auto currentArenaPtr = nautilus::invoke(
-        +[](Arena* arena, const size_t sizeInBytesVal) -> int8_t*
-        {
-            return reinterpret_cast<int8_t*>( ///NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-                arena->allocateMemory(sizeInBytesVal).data());
-        },
-        arenaRef,
-        sizeInBytes);
+    /// If the available space for the pointer is smaller than the required size, we allocate a new chunk from the arena.
+    /// We use the arena's allocateRemainingMemory function and set the available space for the pointer to the size of the chunk.
+    /// Further, we set the space pointer to the beginning of the new chunk.
+    if (availableSpaceForPointer < sizeInBytes)
+    {
+        spacePointer = nautilus::invoke(
+            +[](Arena* arena, const size_t sizeInBytesVal) -> int8_t*
+            {
+                return reinterpret_cast<int8_t*>( ///NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                    arena->allocateRemainingMemory(sizeInBytesVal).data());
+            },
+            arenaRef,
+            sizeInBytes);
+        availableSpaceForPointer = readValueFromMemRef<size_t>(getMemberRef(arenaRef, &Arena::lastChunkSize));
+    }
+
+    /// Bumping the space pointer is all that is left to do for allocations that fit into the current chunk
+    const auto currentArenaPtr = spacePointer;
+    spacePointer = spacePointer + sizeInBytes;
+    availableSpaceForPointer = availableSpaceForPointer - sizeInBytes;
     return currentArenaPtr;
 }
 
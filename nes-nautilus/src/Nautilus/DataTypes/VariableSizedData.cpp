@@ -18,6 +18,7 @@
 #include <ostream>
 #include <utility>
 #include <Nautilus/DataTypes/DataTypesUtil.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <nautilus/std/cstring.h>
 #include <nautilus/std/ostream.h>
 #include <nautilus/val.hpp>
@@ -28,7 +29,7 @@ namespace NES
 {
 
 VariableSizedData::VariableSizedData(const nautilus::val<int8_t*>& reference, const nautilus::val<uint32_t>& size)
-    : size(size), ptrToVarSized(reference)
+    : size(size), ptrToVarSized(reference), backingBuffer(nullptr), backingAccess(0)
 {
 }
 
@@ -37,7 +38,19 @@ VariableSizedData::VariableSizedData(const nautilus::val<int8_t*>& pointerToVarS
 {
 }
 
-VariableSizedData::VariableSizedData(const VariableSizedData& other) : size(other.size), ptrToVarSized(other.ptrToVarSized)
+VariableSizedData::VariableSizedData(
+    const nautilus::val<int8_t*>& pointerToVarSizedData,
+    const nautilus::val<TupleBuffer*>& backingBuffer,
+    const nautilus::val<uint64_t>& backingAccess)
+    : size(readValueFromMemRef<uint32_t>(pointerToVarSizedData))
+    , ptrToVarSized(pointerToVarSizedData)
+    , backingBuffer(backingBuffer)
+    , backingAccess(backingAccess)
+{
+}
+
+VariableSizedData::VariableSizedData(const VariableSizedData& other)
+    : size(other.size), ptrToVarSized(other.ptrToVarSized), backingBuffer(other.backingBuffer), backingAccess(other.backingAccess)
 {
 }
 
@@ -50,11 +63,16 @@ VariableSizedData& VariableSizedData::operator=(const VariableSizedData& other)
 
     size = other.size;
     ptrToVarSized = other.ptrToVarSized;
+    backingBuffer = other.backingBuffer;
+    backingAccess = other.backingAccess;
     return *this;
 }
 
 VariableSizedData::VariableSizedData(VariableSizedData&& other) noexcept
-    : size(std::move(other.size)), ptrToVarSized(std::move(other.ptrToVarSized))
+    : size(std::move(other.size))
+    , ptrToVarSized(std::move(other.ptrToVarSized))
+    , backingBuffer(std::move(other.backingBuffer))
+    , backingAccess(std::move(other.backingAccess))
 {
 }
 
@@ -67,6 +85,8 @@ VariableSizedData& VariableSizedData::operator=(VariableSizedData&& other) noexc
 
     size = std::move(other.size);
     ptrToVarSized = std::move(other.ptrToVarSized);
+    backingBuffer = std::move(other.backingBuffer);
+    backingAccess = std::move(other.backingAccess);
     return *this;
 }
 
@@ -129,6 +149,16 @@ nautilus::val<uint32_t> VariableSizedData::getTotalSize() const
     return ptrToVarSized;
 }
 
+[[nodiscard]] nautilus::val<TupleBuffer*> VariableSizedData::getBackingBuffer() const
+{
+    return backingBuffer;
+}
+
+[[nodiscard]] nautilus::val<uint64_t> VariableSizedData::getBackingAccess() const
+{
+    return backingAccess;
+}
+
 [[nodiscard]] nautilus::val<std::ostream>& operator<<(nautilus::val<std::ostream>& oss, const VariableSizedData& variableSizedData)
 {
     oss << "Size(" << variableSizedData.size << "): ";
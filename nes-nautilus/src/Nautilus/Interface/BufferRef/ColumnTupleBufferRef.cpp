@@ -70,6 +70,27 @@ Record ColumnTupleBufferRef::readRecord(
     return record;
 }
 
+Record ColumnTupleBufferRef::readRecordLazily(
+    const std::vector<Record::RecordFieldIdentifier>& projections,
+    const RecordBuffer& recordBuffer,
+    nautilus::val<uint64_t>& recordIndex) const
+{
+    Record record;
+    const auto bufferAddress = recordBuffer.getMemArea();
+    for (nautilus::static_val<uint64_t> i = 0; i < fields.size(); ++i)
+    {
+        const auto& [name, type, columnOffset] = fields.at(i);
+        if (not includesField(projections, name))
+        {
+            continue;
+        }
+        /// The address gets computed here, as the recordIndex might change until the field is read
+        auto fieldAddress = calculateFieldAddress(bufferAddress, recordIndex, type.getSizeInBytes(), columnOffset);
+        record.writeLazy(name, createLazyFieldLoader(type, recordBuffer, fieldAddress));
+    }
+    return record;
+}
+
 void ColumnTupleBufferRef::writeRecord(
     nautilus::val<uint64_t>& recordIndex,
     const RecordBuffer& recordBuffer,
@@ -91,6 +112,63 @@ void ColumnTupleBufferRef::writeRecord(
     }
 }
 
+TupleBufferRef::RecordCursor
+ColumnTupleBufferRef::createCursor(const RecordBuffer& recordBuffer, const nautilus::val<uint64_t>& recordIndex) const
+{
+    /// The cursor keeps one running address per column, which advances by the size of the column's field
+    RecordCursor cursor{
+        .recordIndex = recordIndex,
+        .addresses = {},
+        .strides = {},
+        .varSizedWriteCursor = createVarSizedWriteCursor(recordBuffer, getAllDataTypes())};
+    const auto bufferAddress = recordBuffer.getMemArea();
+    for (nautilus::static_val<uint64_t> i = 0; i < fields.size(); ++i)
+    {
+        const auto& [name, type, columnOffset] = fields.at(i);
+        nautilus::val<uint64_t> index = recordIndex;
+        cursor.addresses.emplace_back(calculateFieldAddress(bufferAddress, index, type.getSizeInBytes(), columnOffset));
+        cursor.strides.emplace_back(type.getSizeInBytes());
+    }
+    return cursor;
+}
+
+Record ColumnTupleBufferRef::readRecordLazilyAtCursor(
+    const std::vector<Record::RecordFieldIdentifier>& projections, const RecordBuffer& recordBuffer, const RecordCursor& cursor) const
+{
+    Record record;
+    for (nautilus::static_val<uint64_t> i = 0; i < fields.size(); ++i)
+    {
+        const auto& [name, type, columnOffset] = fields.at(i);
+        if (not includesField(projections, name))
+        {
+            continue;
+        }
+        /// Copying the address, as the cursor advances until the field is read
+        const nautilus::val<int8_t*> fieldAddress = cursor.addresses[i];
+        record.writeLazy(name, createLazyFieldLoader(type, recordBuffer, fieldAddress));
+    }
+    return record;
+}
+
+void ColumnTupleBufferRef::writeRecordAtCursor(
+    RecordCursor& cursor,
+    const RecordBuffer& recordBuffer,
+    const Record& rec,
+    const nautilus::val<AbstractBufferProvider*>& bufferProvider) const
+{
+    for (nautilus::static_val<uint64_t> i = 0; i < fields.size(); ++i)
+    {
+        const auto& [name, type, columnOffset] = fields.at(i);
+        if (not rec.hasField(name))
+        {
+            /// Skipping any fields that are not part of the record
+            continue;
+        }
+        const auto& value = rec.read(name);
+        storeValue(type, recordBuffer, cursor.addresses[i], value, bufferProvider, cursor.varSizedWriteCursor);
+    }
+}
+
 std::vector<Record::RecordFieldIdentifier> ColumnTupleBufferRef::getAllFieldNames() const
 {
     return fields | std::views::transform([](const Field& field) { return field.name; }) | std::ranges::to<std::vector>();
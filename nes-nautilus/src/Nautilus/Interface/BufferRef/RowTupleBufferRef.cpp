@@ -66,6 +66,28 @@ Record RowTupleBufferRef::readRecord(
     return record;
 }
 
+Record RowTupleBufferRef::readRecordLazily(
+    const std::vector<Record::RecordFieldIdentifier>& projections,
+    const RecordBuffer& recordBuffer,
+    nautilus::val<uint64_t>& recordIndex) const
+{
+    Record record;
+    const auto bufferAddress = recordBuffer.getMemArea();
+    const auto recordOffset = bufferAddress + (tupleSize * recordIndex);
+    for (nautilus::static_val<uint64_t> i = 0; i < fields.size(); ++i)
+    {
+        const auto& [name, type, fieldOffset] = fields.at(i);
+        if (not includesField(projections, name))
+        {
+            continue;
+        }
+        /// The address gets computed here, as the recordIndex might change until the field is read
+        auto fieldAddress = calculateFieldAddress(recordOffset, fieldOffset);
+        record.writeLazy(name, createLazyFieldLoader(type, recordBuffer, fieldAddress));
+    }
+    return record;
+}
+
 void RowTupleBufferRef::writeRecord(
     nautilus::val<uint64_t>& recordIndex,
     const RecordBuffer& recordBuffer,
@@ -88,6 +110,58 @@ void RowTupleBufferRef::writeRecord(
     }
 }
 
+TupleBufferRef::RecordCursor
+RowTupleBufferRef::createCursor(const RecordBuffer& recordBuffer, const nautilus::val<uint64_t>& recordIndex) const
+{
+    /// The cursor keeps a single running address to the start of the record, which advances by the tuple size
+    const auto bufferAddress = recordBuffer.getMemArea();
+    const auto recordOffset = bufferAddress + (tupleSize * recordIndex);
+    return RecordCursor{
+        .recordIndex = recordIndex,
+        .addresses = {recordOffset},
+        .strides = {tupleSize},
+        .varSizedWriteCursor = createVarSizedWriteCursor(recordBuffer, getAllDataTypes())};
+}
+
+Record RowTupleBufferRef::readRecordLazilyAtCursor(
+    const std::vector<Record::RecordFieldIdentifier>& projections, const RecordBuffer& recordBuffer, const RecordCursor& cursor) const
+{
+    Record record;
+    const nautilus::val<int8_t*> recordOffset = cursor.addresses[0];
+    for (nautilus::static_val<uint64_t> i = 0; i < fields.size(); ++i)
+    {
+        const auto& [name, type, fieldOffset] = fields.at(i);
+        if (not includesField(projections, name))
+        {
+            continue;
+        }
+        auto fieldAddress = calculateFieldAddress(recordOffset, fieldOffset);
+        record.writeLazy(name, createLazyFieldLoader(type, recordBuffer, fieldAddress));
+    }
+    return record;
+}
+
+void RowTupleBufferRef::writeRecordAtCursor(
+    RecordCursor& cursor,
+    const RecordBuffer& recordBuffer,
+    const Record& rec,
+    const nautilus::val<AbstractBufferProvider*>& bufferProvider) const
+{
+    const auto& recordOffset = cursor.addresses[0];
+    for (nautilus::static_val<uint64_t> i = 0; i < fields.size(); ++i)
+    {
+        const auto& [name, type, fieldOffset] = fields.at(i);
+        if (not rec.hasField(name))
+        {
+            /// Skipping any fields that are not part of the record
+            continue;
+        }
+        auto fieldAddress = calculateFieldAddress(recordOffset, fieldOffset);
+        const auto& value = rec.read(name);
+        storeValue(type, recordBuffer, fieldAddress, value, bufferProvider, cursor.varSizedWriteCursor);
+    }
+}
+
 std::vector<Record::RecordFieldIdentifier> RowTupleBufferRef::getAllFieldNames() const
 {
     return fields | std::views::transform([](const Field& field) { return field.name; }) | std::ranges::to<std::vector>();
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <utility>
@@ -37,8 +38,10 @@
 #include <Runtime/TupleBuffer.hpp>
 #include <Runtime/VariableSizedAccess.hpp>
 #include <magic_enum/magic_enum.hpp>
+#include <nautilus/std/cstring.h>
 #include <ErrorHandling.hpp>
 #include <function.hpp>
+#include <static.hpp>
 #include <val.hpp>
 #include <val_ptr.hpp>
 
@@ -95,6 +98,38 @@ void copyVarSizedAndIncrementMetaData(
     /// We plan on getting rid of this "mis"-use in the near future.
     childBuffer.setNumberOfTuples(childBuffer.getNumberOfTuples() + varSizedValue.size() + prependSize);
 }
+
+/// Copies the varSizedValue into a new child buffer of the tupleBuffer
+template <TupleBufferRef::PrependMode PrependMode>
+VariableSizedAccess writeVarSizedToNewChildBuffer(
+    TupleBuffer& tupleBuffer, AbstractBufferProvider& bufferProvider, const std::span<const std::byte> varSizedValue)
+{
+    constexpr uint32_t prependSize = (PrependMode == TupleBufferRef::PREPEND_LENGTH_AS_UINT32) ? sizeof(uint32_t) : 0;
+    auto newChildBuffer = getNewBufferForVarSized(bufferProvider, varSizedValue.size() + prependSize);
+    copyVarSizedAndIncrementMetaData<PrependMode>(newChildBuffer, VariableSizedAccess::Offset{0}, varSizedValue);
+    const VariableSizedAccess::Index childBufferIndex{tupleBuffer.storeChildBuffer(newChildBuffer)};
+    return VariableSizedAccess{childBufferIndex};
+}
+
+/// Masks the child index of a VariableSizedAccess::CombinedIndex, which is stored in the upper bits
+constexpr VariableSizedAccess::CombinedIndex CHILD_INDEX_MASK = ~VariableSizedAccess::CombinedIndex{0}
+    << VariableSizedAccess::Offset::UnderlyingBits;
+
+/// Child buffer that a VarSizedWriteCursor has been moved to. The proxy that acquires it returns it via thread-local storage, which the
+/// traced code reads before calling any other proxy.
+struct NewChildBuffer
+{
+    VariableSizedAccess::CombinedIndex combinedIndex;
+    int8_t* address;
+    uint64_t size;
+};
+
+/// Stores the bytes that a VarSizedWriteCursor has appended inline as the used bytes of the child buffer
+void publishUsedBytes(const TupleBuffer& tupleBuffer, const uint64_t childIndexBits, const uint64_t usedBytes)
+{
+    const auto childBuffer = tupleBuffer.loadChildBuffer(VariableSizedAccess(childIndexBits).getIndex());
+    childBuffer.setNumberOfTuples(usedBytes);
+}
 }
 
 template <TupleBufferRef::PrependMode PrependMode>
@@ -109,10 +144,7 @@ VariableSizedAccess TupleBufferRef::writeVarSized(
     const auto numberOfChildBuffers = tupleBuffer.getNumberOfChildBuffers();
     if (numberOfChildBuffers == 0)
     {
-        auto newChildBuffer = getNewBufferForVarSized(bufferProvider, totalVarSizedLength);
-        copyVarSizedAndIncrementMetaData<PrependMode>(newChildBuffer, VariableSizedAccess::Offset{0}, varSizedValue);
-        const auto childBufferIndex = tupleBuffer.storeChildBuffer(newChildBuffer);
-        return VariableSizedAccess{childBufferIndex};
+        return writeVarSizedToNewChildBuffer<PrependMode>(tupleBuffer, bufferProvider, varSizedValue);
     }
 
     /// If there is no space in the lastChildBuffer, we get a new buffer and copy the var sized into the newly acquired
@@ -122,10 +154,7 @@ VariableSizedAccess TupleBufferRef::writeVarSized(
     const auto usedMemorySize = lastChildBuffer.getNumberOfTuples();
     if (usedMemorySize + totalVarSizedLength >= lastChildBuffer.getBufferSize())
     {
-        auto newChildBuffer = getNewBufferForVarSized(bufferProvider, totalVarSizedLength);
-        copyVarSizedAndIncrementMetaData<PrependMode>(newChildBuffer, VariableSizedAccess::Offset{0}, varSizedValue);
-        const VariableSizedAccess::Index childBufferIndex{tupleBuffer.storeChildBuffer(newChildBuffer)};
-        return VariableSizedAccess{childBufferIndex};
+        return writeVarSizedToNewChildBuffer<PrependMode>(tupleBuffer, bufferProvider, varSizedValue);
     }
 
     /// There is enough space in the lastChildBuffer, thus, we copy the var sized into it
@@ -143,12 +172,13 @@ template VariableSizedAccess TupleBufferRef::writeVarSized<TupleBufferRef::Prepe
 std::span<std::byte>
 TupleBufferRef::loadAssociatedVarSizedValue(const TupleBuffer& tupleBuffer, const VariableSizedAccess variableSizedAccess)
 {
-    /// Loading the childbuffer containing the variable sized data.
-    auto childBuffer = tupleBuffer.loadChildBuffer(variableSizedAccess.getIndex());
+    /// Loading the memory area of the childbuffer containing the variable sized data. We do not need to retain the child buffer, as the
+    /// tupleBuffer keeps it alive. This saves two atomic reference count updates for every var sized value that is read.
+    const auto childMemoryArea = tupleBuffer.loadChildBufferMemoryArea(variableSizedAccess.getIndex());
 
     /// Creating a subspan that starts at the required offset. It still can contain multiple other var sized, as we have solely offset the
     /// lower bound but not the upper bound.
-    const auto varSized = childBuffer.getAvailableMemoryArea().subspan(variableSizedAccess.getOffset().getRawOffset());
+    const auto varSized = childMemoryArea.subspan(variableSizedAccess.getOffset().getRawOffset());
 
     /// Reading the first 32-bit (size of var sized) and then cutting the span to only contain the required var sized
     alignas(uint32_t) std::array<std::byte, sizeof(uint32_t)> varSizedLengthBuffer{};
@@ -164,7 +194,8 @@ TupleBufferRef::loadValue(const DataType& physicalType, const RecordBuffer& reco
     {
         return VarVal::readVarValFromMemory(fieldReference, physicalType.type);
     }
-    const nautilus::val<VariableSizedAccess> combinedIdxOffset{readValueFromMemRef<VariableSizedAccess::CombinedIndex>(fieldReference)};
+    const auto combinedIndex = readValueFromMemRef<VariableSizedAccess::CombinedIndex>(fieldReference);
+    const nautilus::val<VariableSizedAccess> combinedIdxOffset{combinedIndex};
     const auto varSizedPtr = invoke(
         +[](const TupleBuffer* tupleBuffer, const VariableSizedAccess variableSizedAccess)
         {
@@ -173,7 +204,37 @@ TupleBufferRef::loadValue(const DataType& physicalType, const RecordBuffer& reco
         },
         recordBuffer.getReference(),
         combinedIdxOffset);
-    return VariableSizedData(varSizedPtr);
+    /// Keeping track of the child buffer, so that the value can be forwarded without copying it, as long as it is not modified
+    return VariableSizedData(varSizedPtr, recordBuffer.getReference(), combinedIndex);
+}
+
+Record::LazyFieldLoader TupleBufferRef::createLazyFieldLoader(
+    const DataType& physicalType, const RecordBuffer& recordBuffer, const nautilus::val<int8_t*>& fieldReference)
+{
+    if (physicalType.type == DataType::Type::VARSIZED)
+    {
+        /// A variable sized value has no placeholder of its type, thus, it gets loaded on every read
+        return [physicalType, recordBuffer, fieldReference] { return loadValue(physicalType, recordBuffer, fieldReference); };
+    }
+
+    /// The first read might happen in a branch that does not dominate later reads. Thus, whether the value has been loaded gets checked
+    /// at runtime and the loaded value gets assigned to a variable that is declared before any read.
+    struct LoadedValue
+    {
+        nautilus::val<bool> loaded;
+        VarVal value;
+    };
+    auto loadedValue = std::make_shared<LoadedValue>(
+        nautilus::val<bool>(false), VarVal(nautilus::val<uint64_t>(0)).castToType(physicalType.type));
+    return [physicalType, recordBuffer, fieldReference, loadedValue]
+    {
+        if (not loadedValue->loaded)
+        {
+            loadedValue->value = loadValue(physicalType, recordBuffer, fieldReference);
+            loadedValue->loaded = true;
+        }
+        return loadedValue->value;
+    };
 }
 
 VarVal TupleBufferRef::storeValue(
@@ -212,6 +273,212 @@ VarVal TupleBufferRef::storeValue(
     return value;
 }
 
+VarVal TupleBufferRef::storeValue(
+    const DataType& physicalType,
+    const RecordBuffer& recordBuffer,
+    const nautilus::val<int8_t*>& fieldReference,
+    VarVal value,
+    const nautilus::val<AbstractBufferProvider*>& bufferProvider,
+    std::optional<VarSizedWriteCursor>& varSizedWriteCursor)
+{
+    if (physicalType.type != DataType::Type::VARSIZED or not varSizedWriteCursor.has_value())
+    {
+        return storeValue(physicalType, recordBuffer, fieldReference, std::move(value), bufferProvider);
+    }
+
+    auto& [childIndexBits, childAddress, usedBytes, childBufferSize, forwardingBuffer, forwardedChildIndexBits, attachedChildIndexBits]
+        = varSizedWriteCursor.value();
+    const auto varSizedValue = value.cast<VariableSizedData>();
+    const auto varSizedValueLength = static_cast<nautilus::val<uint64_t>>(varSizedValue.getTotalSize());
+    auto fieldReferenceCastedU64 = static_cast<nautilus::val<uint64_t*>>(fieldReference);
+
+    /// The value has been read unmodified from the forwarding buffer. Thus, we attach its child buffer once and rewrite the child index.
+    if (forwardingBuffer != nullptr and varSizedValue.getBackingBuffer() == forwardingBuffer)
+    {
+        const auto backingAccess = varSizedValue.getBackingAccess();
+        const auto backingChildIndexBits = backingAccess & CHILD_INDEX_MASK;
+        if (backingChildIndexBits != forwardedChildIndexBits)
+        {
+            attachedChildIndexBits = invoke(
+                +[](TupleBuffer* tupleBuffer, const TupleBuffer* forwardingBuffer, const uint64_t backingAccess)
+                {
+                    INVARIANT(tupleBuffer != nullptr, "Tuplebuffer MUST NOT be null at this point");
+                    INVARIANT(forwardingBuffer != nullptr, "Forwarding buffer MUST NOT be null at this point");
+                    auto childBuffer = forwardingBuffer->loadChildBuffer(VariableSizedAccess(backingAccess).getIndex());
+                    const VariableSizedAccess::Index childBufferIndex{tupleBuffer->storeChildBuffer(childBuffer)};
+                    return VariableSizedAccess{childBufferIndex}.getCombinedIdxOffset();
+                },
+                recordBuffer.getReference(),
+                forwardingBuffer,
+                backingAccess);
+            forwardedChildIndexBits = backingChildIndexBits;
+        }
+        *fieldReferenceCastedU64 = attachedChildIndexBits | (backingAccess & ~CHILD_INDEX_MASK);
+    }
+    /// Same bounds check as in writeVarSized(), so that both paths agree on when a new child buffer is required
+    else if (usedBytes + varSizedValueLength < childBufferSize)
+    {
+        nautilus::memcpy(childAddress + usedBytes, varSizedValue.getReference(), varSizedValueLength);
+        *fieldReferenceCastedU64 = childIndexBits | usedBytes;
+        usedBytes = usedBytes + varSizedValueLength;
+    }
+    else
+    {
+        /// Moving the cursor to the new child buffer that the value is written to. A single proxy call acquires the child buffer and
+        /// returns everything the cursor requires to append to it inline.
+        const auto newChildBufferRef = invoke(
+            +[](TupleBuffer* tupleBuffer,
+                AbstractBufferProvider* bufferProvider,
+                const int8_t* varSizedPtr,
+                const uint32_t varSizedValueLength,
+                const uint64_t childIndexBits,
+                const uint64_t usedBytes,
+                const uint64_t childBufferSize)
+            {
+                INVARIANT(tupleBuffer != nullptr, "Tuplebuffer MUST NOT be null at this point");
+                INVARIANT(bufferProvider != nullptr, "BufferProvider MUST NOT be null at this point");
+                if (childBufferSize > 0)
+                {
+                    publishUsedBytes(*tupleBuffer, childIndexBits, usedBytes);
+                }
+                /// The last child buffer might be an attached one, thus, we must not append to it like writeVarSized()
+                const std::span varSizedValueSpan{varSizedPtr, varSizedPtr + varSizedValueLength};
+                const auto variableSizedAccess
+                    = writeVarSizedToNewChildBuffer<PREPEND_NONE>(*tupleBuffer, *bufferProvider, std::as_bytes(varSizedValueSpan));
+                const auto childMemoryArea = tupleBuffer->loadChildBufferMemoryArea(variableSizedAccess.getIndex());
+                thread_local NewChildBuffer newChildBuffer;
+                newChildBuffer = NewChildBuffer{
+                    .combinedIndex = variableSizedAccess.getCombinedIdxOffset(),
+                    .address = reinterpret_cast<int8_t*>(childMemoryArea.data()),
+                    .size = childMemoryArea.size()};
+                return reinterpret_cast<int8_t*>(&newChildBuffer);
+            },
+            recordBuffer.getReference(),
+            bufferProvider,
+            varSizedValue.getReference(),
+            varSizedValue.getTotalSize(),
+            childIndexBits,
+            usedBytes,
+            childBufferSize);
+        const auto combinedIndex
+            = readValueFromMemRef<VariableSizedAccess::CombinedIndex>(getMemberRef(newChildBufferRef, &NewChildBuffer::combinedIndex));
+        *fieldReferenceCastedU64 = combinedIndex;
+        childIndexBits = combinedIndex & CHILD_INDEX_MASK;
+        usedBytes = varSizedValueLength;
+        childAddress = readValueFromMemRef<int8_t*>(getMemberRef(newChildBufferRef, &NewChildBuffer::address));
+        childBufferSize = readValueFromMemRef<uint64_t>(getMemberRef(newChildBufferRef, &NewChildBuffer::size));
+    }
+    return value;
+}
+
+std::optional<TupleBufferRef::VarSizedWriteCursor>
+TupleBufferRef::createVarSizedWriteCursor(const RecordBuffer& recordBuffer, const std::vector<DataType>& dataTypes)
+{
+    if (std::ranges::none_of(dataTypes, [](const DataType& dataType) { return dataType.type == DataType::Type::VARSIZED; }))
+    {
+        return std::nullopt;
+    }
+    /// The child address is never read before the first child buffer has been acquired, as the child buffer size is zero
+    return VarSizedWriteCursor{
+        .childIndexBits = nautilus::val<uint64_t>(0),
+        .childAddress = recordBuffer.getMemArea(),
+        .usedBytes = nautilus::val<uint64_t>(0),
+        .childBufferSize = nautilus::val<uint64_t>(0),
+        .forwardingBuffer = nautilus::val<TupleBuffer*>(nullptr),
+        .forwardedChildIndexBits = nautilus::val<uint64_t>(VarSizedWriteCursor::NO_FORWARDED_CHILD),
+        .attachedChildIndexBits = nautilus::val<uint64_t>(0)};
+}
+
+void TupleBufferRef::flushCursor(const RecordCursor& cursor, const RecordBuffer& recordBuffer)
+{
+    if (not cursor.varSizedWriteCursor.has_value())
+    {
+        return;
+    }
+    const auto& childIndexBits = cursor.varSizedWriteCursor->childIndexBits;
+    const auto& usedBytes = cursor.varSizedWriteCursor->usedBytes;
+    if (cursor.varSizedWriteCursor->childBufferSize > 0)
+    {
+        invoke(
+            +[](const TupleBuffer* tupleBuffer, const uint64_t childIndexBits, const uint64_t usedBytes)
+            {
+                INVARIANT(tupleBuffer != nullptr, "Tuplebuffer MUST NOT be null at this point");
+                publishUsedBytes(*tupleBuffer, childIndexBits, usedBytes);
+            },
+            recordBuffer.getReference(),
+            childIndexBits,
+            usedBytes);
+    }
+}
+
+Record TupleBufferRef::readRecordLazily(
+    const std::vector<Record::RecordFieldIdentifier>& projections,
+    const RecordBuffer& recordBuffer,
+    nautilus::val<uint64_t>& recordIndex) const
+{
+    return readRecord(projections, recordBuffer, recordIndex);
+}
+
+void TupleBufferRef::RecordCursor::advance()
+{
+    recordIndex = recordIndex + nautilus::val<uint64_t>(1);
+    for (nautilus::static_val<uint64_t> i = 0; i < addresses.size(); ++i)
+    {
+        addresses[i] = addresses[i] + nautilus::val<uint64_t>(strides[i]);
+    }
+}
+
+void TupleBufferRef::RecordCursor::reset(const RecordCursor& other)
+{
+    PRECONDITION(
+        addresses.size() == other.addresses.size() and varSizedWriteCursor.has_value() == other.varSizedWriteCursor.has_value(),
+        "Can only reset a cursor to a cursor of the same TupleBufferRef");
+    recordIndex = other.recordIndex;
+    for (nautilus::static_val<uint64_t> i = 0; i < addresses.size(); ++i)
+    {
+        addresses[i] = other.addresses[i];
+    }
+    if (varSizedWriteCursor.has_value())
+    {
+        varSizedWriteCursor->childIndexBits = other.varSizedWriteCursor->childIndexBits;
+        varSizedWriteCursor->childAddress = other.varSizedWriteCursor->childAddress;
+        varSizedWriteCursor->usedBytes = other.varSizedWriteCursor->usedBytes;
+        varSizedWriteCursor->childBufferSize = other.varSizedWriteCursor->childBufferSize;
+        varSizedWriteCursor->forwardedChildIndexBits = other.varSizedWriteCursor->forwardedChildIndexBits;
+        varSizedWriteCursor->attachedChildIndexBits = other.varSizedWriteCursor->attachedChildIndexBits;
+    }
+}
+
+void TupleBufferRef::RecordCursor::setForwardingBuffer(const nautilus::val<TupleBuffer*>& forwardingBuffer)
+{
+    if (varSizedWriteCursor.has_value())
+    {
+        varSizedWriteCursor->forwardingBuffer = forwardingBuffer;
+    }
+}
+
+TupleBufferRef::RecordCursor TupleBufferRef::createCursor(const RecordBuffer&, const nautilus::val<uint64_t>& recordIndex) const
+{
+    return RecordCursor{.recordIndex = recordIndex, .addresses = {}, .strides = {}, .varSizedWriteCursor = std::nullopt};
+}
+
+Record TupleBufferRef::readRecordLazilyAtCursor(
+    const std::vector<Record::RecordFieldIdentifier>& projections, const RecordBuffer& recordBuffer, const RecordCursor& cursor) const
+{
+    nautilus::val<uint64_t> recordIndex = cursor.recordIndex;
+    return readRecordLazily(projections, recordBuffer, recordIndex);
+}
+
+void TupleBufferRef::writeRecordAtCursor(
+    RecordCursor& cursor,
+    const RecordBuffer& recordBuffer,
+    const Record& rec,
+    const nautilus::val<AbstractBufferProvider*>& bufferProvider) const
+{
+    nautilus::val<uint64_t> recordIndex = cursor.recordIndex;
+    writeRecord(recordIndex, recordBuffer, rec, bufferProvider);
+}
+
 bool TupleBufferRef::includesField(
     const std::vector<Record::RecordFieldIdentifier>& projections, const Record::RecordFieldIdentifier& fieldIndex)
 {
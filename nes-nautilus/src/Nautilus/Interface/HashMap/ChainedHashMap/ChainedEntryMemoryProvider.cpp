@@ -20,11 +20,13 @@
 #include <utility>
 #include <vector>
 #include <DataTypes/Schema.hpp>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <nautilus/std/cstring.h>
 #include <nautilus/val_ptr.hpp>
 #include <ErrorHandling.hpp>
 #include <function.hpp>
@@ -34,6 +36,15 @@
 namespace NES
 {
 
+uint64_t ChainedEntryMemoryProvider::getFieldSizeInEntry(const DataType& type)
+{
+    if (type.isType(DataType::Type::VARSIZED_POINTER_REP))
+    {
+        return VAR_SIZED_FIELD_SIZE;
+    }
+    return type.getSizeInBytes();
+}
+
 std::pair<std::vector<FieldOffsets>, std::vector<FieldOffsets>> ChainedEntryMemoryProvider::createFieldOffsets(
     const Schema& schema,
     const std::vector<Record::RecordFieldIdentifier>& fieldNameKeys,
@@ -51,7 +62,7 @@ std::pair<std::vector<FieldOffsets>, std::vector<FieldOffsets>> ChainedEntryMemo
         INVARIANT(field.has_value(), "Field {} not found in schema", fieldName);
         const auto& fieldValue = field.value();
         fieldsKey.emplace_back(FieldOffsets{.fieldIdentifier = fieldValue.name, .type = fieldValue.dataType, .fieldOffset = offset});
-        offset += fieldValue.dataType.getSizeInBytes();
+        offset += getFieldSizeInEntry(fieldValue.dataType);
     }
 
     for (const auto& fieldName : fieldNameValues)
@@ -60,7 +71,7 @@ std::pair<std::vector<FieldOffsets>, std::vector<FieldOffsets>> ChainedEntryMemo
         INVARIANT(field.has_value(), "Field {} not found in schema", fieldName);
         const auto& fieldValue = field.value();
         fieldsValue.emplace_back(FieldOffsets{.fieldIdentifier = fieldValue.name, .type = fieldValue.dataType, .fieldOffset = offset});
-        offset += fieldValue.dataType.getSizeInBytes();
+        offset += getFieldSizeInEntry(fieldValue.dataType);
     }
     return {fieldsKey, fieldsValue};
 }
@@ -77,9 +88,16 @@ VarVal ChainedEntryMemoryProvider::readVarVal(
             const auto memoryAddress = castedEntryAddress + fieldOffset;
             if (type.isType(DataType::Type::VARSIZED_POINTER_REP))
             {
-                const auto varSizedDataPtr
-                    = nautilus::invoke(+[](const int8_t** memoryAddressInEntry) { return *memoryAddressInEntry; }, memoryAddress);
-                VariableSizedData varSizedData(varSizedDataPtr);
+                /// An inlined content is preceded by its size like any other variable sized data, thus, the field is its reference
+                const auto contentSize = readValueFromMemRef<uint32_t>(memoryAddress);
+                nautilus::val<int8_t*> varSizedDataPtr = memoryAddress;
+                if (contentSize > nautilus::val<uint32_t>(MAX_INLINED_VAR_SIZED_CONTENT_SIZE))
+                {
+                    varSizedDataPtr = nautilus::invoke(
+                        +[](const int8_t** memoryAddressInEntry) { return *memoryAddressInEntry; },
+                        memoryAddress + nautilus::val<uint64_t>(VAR_SIZED_POINTER_OFFSET));
+                }
+                VariableSizedData varSizedData(varSizedDataPtr, contentSize);
                 return varSizedData;
             }
 
@@ -110,23 +128,38 @@ void storeVarSized(
     const nautilus::val<int8_t*>& memoryAddress,
     const VariableSizedData& variableSizedData)
 {
-    nautilus::invoke(
-        +[](ChainedHashMap* hashMap,
-            AbstractBufferProvider* bufferProvider,
-            const int8_t** memoryAddressInEntry,
-            const int8_t* varSizedData,
-            const uint64_t varSizedDataSize)
-        {
-            auto spaceForVarSizedData = hashMap->allocateSpaceForVarSized(bufferProvider, varSizedDataSize);
-            const std::span<const int8_t> varSizedSpan{varSizedData, varSizedData + varSizedDataSize};
-            std::ranges::copy(std::as_bytes(varSizedSpan), spaceForVarSizedData.begin());
-            *memoryAddressInEntry = reinterpret_cast<const signed char*>(spaceForVarSizedData.data());
-        },
-        hashMapRef,
-        bufferProviderRef,
-        memoryAddress,
-        variableSizedData.getReference(),
-        variableSizedData.getTotalSize());
+    if (variableSizedData.getContentSize() <= nautilus::val<uint32_t>(ChainedEntryMemoryProvider::MAX_INLINED_VAR_SIZED_CONTENT_SIZE))
+    {
+        nautilus::memcpy(
+            memoryAddress, variableSizedData.getReference(), static_cast<nautilus::val<uint64_t>>(variableSizedData.getTotalSize()));
+    }
+    else
+    {
+        nautilus::invoke(
+            +[](ChainedHashMap* hashMap,
+                AbstractBufferProvider* bufferProvider,
+                int8_t* memoryAddressInEntry,
+                const int8_t* varSizedData,
+                const uint64_t varSizedDataSize)
+            {
+                auto spaceForVarSizedData = hashMap->allocateSpaceForVarSized(bufferProvider, varSizedDataSize);
+                const std::span<const int8_t> varSizedSpan{varSizedData, varSizedData + varSizedDataSize};
+                std::ranges::copy(std::as_bytes(varSizedSpan), spaceForVarSizedData.begin());
+
+                /// Storing the size in the entry, so that reading the field can tell whether its content is inlined or not
+                std::memcpy(memoryAddressInEntry, varSizedData, sizeof(uint32_t));
+                const auto* const varSizedDataInHashMap = reinterpret_cast<const signed char*>(spaceForVarSizedData.data());
+                std::memcpy(
+                    memoryAddressInEntry + ChainedEntryMemoryProvider::VAR_SIZED_POINTER_OFFSET,
+                    &varSizedDataInHashMap,
+                    sizeof(varSizedDataInHashMap));
+            },
+            hashMapRef,
+            bufferProviderRef,
+            memoryAddress,
+            variableSizedData.getReference(),
+            variableSizedData.getTotalSize());
+    }
 }
 }
 
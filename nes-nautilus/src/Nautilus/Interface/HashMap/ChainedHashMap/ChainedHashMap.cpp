@@ -20,8 +20,10 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
+#include <utility>
 #include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
@@ -57,7 +59,9 @@ uint64_t calcCapacity(const uint64_t numberOfKeys, const double loadFactor)
 }
 
 ChainedHashMap::ChainedHashMap(uint64_t entrySize, const uint64_t numberOfBuckets, uint64_t pageSize)
-    : numberOfTuples(0)
+    : pageStarts({nullptr})
+    , pageStartsData(pageStarts.data())
+    , numberOfTuples(0)
     , pageSize(pageSize)
     , entrySize(entrySize)
     , entriesPerPage(pageSize / entrySize)
@@ -83,7 +87,9 @@ ChainedHashMap::ChainedHashMap(uint64_t entrySize, const uint64_t numberOfBucket
 }
 
 ChainedHashMap::ChainedHashMap(const uint64_t keySize, const uint64_t valueSize, const uint64_t numberOfBuckets, const uint64_t pageSize)
-    : numberOfTuples(0)
+    : pageStarts({nullptr})
+    , pageStartsData(pageStarts.data())
+    , numberOfTuples(0)
     , pageSize(pageSize)
     , entrySize(sizeof(ChainedHashMapEntry) + keySize + valueSize)
     , entriesPerPage(pageSize / entrySize)
@@ -123,10 +129,19 @@ std::unique_ptr<ChainedHashMap> ChainedHashMap::createNewMapWithSameConfiguratio
     return std::make_unique<ChainedHashMap>(other.entrySize, other.numberOfChains, other.pageSize);
 }
 
+ChainedHashMapEntry* ChainedHashMap::untag(ChainedHashMapEntry* taggedEntry)
+{
+    return reinterpret_cast<ChainedHashMapEntry*>(reinterpret_cast<uintptr_t>(taggedEntry) & ~TAG_MASK);
+}
+
 ChainedHashMapEntry* ChainedHashMap::findChain(const HashFunction::HashValue::raw_type hash) const
 {
     const auto entryStartPos = hash & mask;
-    return entries[entryStartPos];
+    if ((reinterpret_cast<uintptr_t>(entries[entryStartPos]) & getTag(hash)) == 0)
+    {
+        return nullptr;
+    }
+    return untag(entries[entryStartPos]);
 }
 
 std::span<std::byte> ChainedHashMap::allocateSpaceForVarSized(AbstractBufferProvider* bufferProvider, const size_t neededSize)
@@ -174,16 +189,24 @@ AbstractHashMapEntry* ChainedHashMap::insertEntry(const HashFunction::HashValue:
         entries[numberOfChains] = reinterpret_cast<ChainedHashMapEntry*>(&entries[numberOfChains]);
     }
 
-    /// 1. Check if we need to allocate a new page
+    /// 1. Check if we need to allocate a new page. We prefer pages that have been retained by reset() over allocating new ones.
     if (numberOfTuples % entriesPerPage == 0)
     {
-        auto newPage = bufferProvider->getUnpooledBuffer(pageSize);
+        auto newPage = retainedPages.empty() ? bufferProvider->getUnpooledBuffer(pageSize) : std::optional(std::move(retainedPages.back()));
         if (not newPage)
         {
             throw CannotAllocateBuffer("Could not allocate memory for new page in ChainedHashMap of size {}", std::to_string(pageSize));
         }
+        if (not retainedPages.empty())
+        {
+            retainedPages.pop_back();
+            newPage.value().setNumberOfTuples(0);
+        }
         std::ranges::fill(newPage.value().getAvailableMemoryArea(), std::byte{0});
         storageSpace.emplace_back(newPage.value());
+        pageStarts.back() = reinterpret_cast<int8_t*>(storageSpace.back().getAvailableMemoryArea().data());
+        pageStarts.emplace_back(nullptr);
+        pageStartsData = pageStarts.data();
     }
 
     /// 2. Finding the new entry
@@ -203,10 +226,16 @@ AbstractHashMapEntry* ChainedHashMap::insertEntry(const HashFunction::HashValue:
     INVARIANT(entryPos < numberOfChains, "Invalid entry position as pos {} is greater than capacity {}", entryPos, numberOfChains);
     auto* const newEntry = new (bufferStorage.getAvailableMemoryArea().subspan(entryOffsetInBuffer).data()) ChainedHashMapEntry(hash);
 
-    /// 4. Updating the chain and the current size
+    /// 4. Updating the chain, its tag and the current size
+    INVARIANT(
+        (reinterpret_cast<uintptr_t>(newEntry) & TAG_MASK) == 0,
+        "Entry {} uses more than {} bits and can not be tagged",
+        fmt::ptr(newEntry),
+        NUMBER_OF_POINTER_BITS);
     auto* const oldValue = entries[entryPos];
-    newEntry->next = oldValue;
-    entries[entryPos] = newEntry;
+    const auto tag = (reinterpret_cast<uintptr_t>(oldValue) & TAG_MASK) | getTag(hash);
+    newEntry->next = untag(oldValue);
+    entries[entryPos] = reinterpret_cast<ChainedHashMapEntry*>(reinterpret_cast<uintptr_t>(newEntry) | tag);
     this->numberOfTuples++;
     return newEntry;
 }
@@ -225,7 +254,7 @@ uint64_t ChainedHashMap::getNumberOfPages() const
 ChainedHashMapEntry* ChainedHashMap::getStartOfChain(const uint64_t entryIdx) const
 {
     PRECONDITION(entryIdx <= numberOfChains, "Entry index {} is greater than the capacity {}", entryIdx, numberOfChains);
-    return entries[entryIdx];
+    return untag(entries[entryIdx]);
 }
 
 uint64_t ChainedHashMap::getNumberOfChains() const
@@ -233,16 +262,15 @@ uint64_t ChainedHashMap::getNumberOfChains() const
     return numberOfChains;
 }
 
-void ChainedHashMap::clear() noexcept
+void ChainedHashMap::destroyEntries() noexcept
 {
-    /// Deleting all entries in the hash map
     if (entries != nullptr and destructorCallBack != nullptr)
     {
         /// Calling for every value in the hash map the destructor callback
         /// We start here by iterating over all entries while starting in the entry space
         for (uint64_t entryIdx = 0; entryIdx < numberOfChains; ++entryIdx)
         {
-            auto* entry = entries[entryIdx];
+            auto* entry = untag(entries[entryIdx]);
             while (entry != nullptr)
             {
                 auto* next = entry->next;
@@ -251,11 +279,53 @@ void ChainedHashMap::clear() noexcept
             }
         }
     }
+}
+
+void ChainedHashMap::clear() noexcept
+{
+    /// Deleting all entries in the hash map
+    destroyEntries();
     entries = nullptr;
     numberOfTuples = 0;
 
     /// Releasing all memory
     storageSpace.clear();
+    retainedPages.clear();
+    pageStarts.clear();
+    pageStarts.emplace_back(nullptr);
+    pageStartsData = pageStarts.data();
+}
+
+void ChainedHashMap::reset(const uint64_t maxNumberOfRetainedPages) noexcept
+{
+    destroyEntries();
+    if (entries != nullptr)
+    {
+        /// Resetting all chains and their tags, while keeping the last entry that marks the end of the entry space
+        std::memset(static_cast<void*>(entries), 0, numberOfChains * sizeof(ChainedHashMapEntry*));
+    }
+    numberOfTuples = 0;
+
+    for (auto& page : storageSpace)
+    {
+        if (retainedPages.size() >= maxNumberOfRetainedPages)
+        {
+            break;
+        }
+        retainedPages.emplace_back(std::move(page));
+    }
+    storageSpace.clear();
+    varSizedSpace.clear();
+    pageStarts.clear();
+    pageStarts.emplace_back(nullptr);
+    pageStartsData = pageStarts.data();
+}
+
+bool ChainedHashMap::hasConfiguration(
+    const uint64_t keySize, const uint64_t valueSize, const uint64_t numberOfBuckets, const uint64_t pageSize) const
+{
+    return entrySize == sizeof(ChainedHashMapEntry) + keySize + valueSize and this->pageSize == pageSize
+        and numberOfChains == calcCapacity(numberOfBuckets, assumedLoadFactor);
 }
 
 }
@@ -24,6 +24,7 @@
 #include <Nautilus/DataTypes/DataTypesUtil.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Hash/HashFunction.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMapRef.hpp>
@@ -99,7 +100,7 @@ nautilus::val<int8_t*> ChainedHashMapRef::ChainedEntryRef::getValueMemArea() con
         for (const auto& field : nautilus::static_iterable(memoryProviderKeys.getAllFields()))
         {
             const auto offset = field.fieldOffset;
-            const auto fieldSize = field.type.getSizeInBytes();
+            const auto fieldSize = ChainedEntryMemoryProvider::getFieldSizeInEntry(field.type);
             if (valueMemAreaOffset < offset + fieldSize)
             {
                 valueMemAreaOffset = offset + fieldSize;
@@ -175,9 +176,13 @@ nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findKey(const Record& rec
     while (entry)
     {
         const ChainedEntryRef entryRef(entry, hashMapRef, fieldKeys, fieldValues);
-        if (compareKeys(entryRef, recordKey))
+        /// Entries with a different hash can not have the same keys, thus, we only compare the keys of entries with the same hash
+        if (entryRef.getHash() == hash)
         {
-            return entry;
+            if (compareKeys(entryRef, recordKey))
+            {
+                return entry;
+            }
         }
         entry = entryRef.getNext();
     }
@@ -214,8 +219,16 @@ nautilus::val<AbstractHashMapEntry*> ChainedHashMapRef::findOrCreateEntry(
         keyValues.emplace_back(keyValue);
     }
 
+    return findOrCreateEntry(recordKey, hashFunction.calculate(keyValues), onInsert, bufferProvider);
+}
+
+nautilus::val<AbstractHashMapEntry*> ChainedHashMapRef::findOrCreateEntry(
+    const Record& recordKey,
+    const HashFunction::HashValue& hashValue,
+    const std::function<void(nautilus::val<AbstractHashMapEntry*>&)>& onInsert,
+    const nautilus::val<AbstractBufferProvider*>& bufferProvider)
+{
     ///  If entry contains nullptr, there does not exist a key with the same values.
-    const auto hashValue = hashFunction.calculate(keyValues);
     if (const auto entryRef = findKey(recordKey, hashValue))
     {
         return static_cast<nautilus::val<AbstractHashMapEntry*>>(entryRef);
@@ -271,31 +284,18 @@ ChainedHashMapRef::EntryIterator ChainedHashMapRef::begin() const
     const nautilus::val<uint64_t> tupleIndex = 0;
     const nautilus::val<uint64_t> indexOnPage = 0;
     const nautilus::val<uint64_t> pageIndex = 0;
-    const auto currentEntry = nautilus::invoke(
-        +[](const HashMap* hashMap, const uint64_t pageIndexVal, const uint64_t indexOnPageVal)
-        {
-            const auto& page = dynamic_cast<const ChainedHashMap*>(hashMap)->getPage(pageIndexVal);
-            return page.getAvailableMemoryArea().subspan(indexOnPageVal * sizeof(ChainedHashMapEntry)).data();
-        },
-        hashMapRef,
-        pageIndex,
-        indexOnPage);
-    const auto numberOfTuplesInCurrentPage = nautilus::invoke(
-        +[](const HashMap* hashMap, const uint64_t pageIndexVal)
-        { return dynamic_cast<const ChainedHashMap*>(hashMap)->getPage(pageIndexVal).getNumberOfTuples(); },
-        hashMapRef,
-        pageIndex);
-    const auto numberOfPages = nautilus::invoke(
-        +[](const HashMap* hashMap) { return dynamic_cast<const ChainedHashMap*>(hashMap)->getNumberOfPages(); }, hashMapRef);
+    const auto pageStarts = readValueFromMemRef<int8_t*>(getMemberRef(hashMapRef, &ChainedHashMap::pageStartsData));
 
-    return {hashMapRef, currentEntry, entrySize, tupleIndex, indexOnPage, numberOfTuplesInCurrentPage, pageIndex, numberOfPages};
+    /// The page starts always contain at least the terminating nullptr. Thus, an empty hash map starts at the nullptr.
+    const auto currentEntry = static_cast<nautilus::val<ChainedHashMapEntry*>>(readValueFromMemRef<int8_t*>(pageStarts));
+    return {pageStarts, currentEntry, entrySize, entriesPerPage, tupleIndex, indexOnPage, pageIndex};
 }
 
 ChainedHashMapRef::EntryIterator ChainedHashMapRef::end() const
 {
     /// The iterator pointing to the end() should NEVER be advanced. Therefore, we do not need to set a lot of its members
     const auto numberOfTuples = readValueFromMemRef<uint64_t>(getMemberRef(hashMapRef, &ChainedHashMap::numberOfTuples));
-    return {hashMapRef, nullptr, entrySize, numberOfTuples, -1, -1, -1, -1};
+    return {nullptr, nullptr, entrySize, entriesPerPage, numberOfTuples, -1, -1};
 }
 
 nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findChain(const HashFunction::HashValue& hash) const
@@ -312,8 +312,23 @@ nautilus::val<ChainedHashMapEntry*> ChainedHashMapRef::findChain(const HashFunct
     const auto entryStartPos = hash & mask;
     const auto entriesRef = getMemberRef(hashMapRef, &ChainedHashMap::entries);
     auto entries = readValueFromMemRef<ChainedHashMapEntry**>(entriesRef);
-    const nautilus::val<ChainedHashMapEntry*> chainStart = entries[entryStartPos];
-    return chainStart;
+
+    /// Skipping the chain, if the tag of the bucket head does not contain the tag of the hash, see ChainedHashMap::getTag()
+    const auto bucketHeadRef
+        = static_cast<nautilus::val<int8_t*>>(entries) + entryStartPos * nautilus::val<uint64_t>(sizeof(ChainedHashMapEntry*));
+    const auto taggedChainStart = readValueFromMemRef<uint64_t>(bucketHeadRef);
+    const auto tagBit = (hash >> nautilus::val<uint64_t>(ChainedHashMap::TAG_HASH_SHIFT))
+        + nautilus::val<uint64_t>(ChainedHashMap::NUMBER_OF_POINTER_BITS);
+    const auto hashTag = nautilus::val<uint64_t>(1) << tagBit;
+    if ((taggedChainStart & hashTag) == 0)
+    {
+        return nullptr;
+    }
+
+    /// Removing the tag by adding its two's complement to the pointer, as we can not cast an integer to a pointer
+    const auto tag = taggedChainStart & nautilus::val<uint64_t>(ChainedHashMap::TAG_MASK);
+    const auto chainStart = readValueFromMemRef<int8_t*>(bucketHeadRef) + (nautilus::val<uint64_t>(0) - tag);
+    return static_cast<nautilus::val<ChainedHashMapEntry*>>(chainStart);
 }
 
 nautilus::val<ChainedHashMapEntry*>
@@ -321,7 +336,7 @@ ChainedHashMapRef::insert(const HashFunction::HashValue& hash, const nautilus::v
 {
     const auto newEntry = invoke(
         +[](HashMap* hashMap, const HashFunction::HashValue::raw_type hashValue, AbstractBufferProvider* bufferProviderVal)
-        { return dynamic_cast<ChainedHashMap*>(hashMap)->insertEntry(hashValue, bufferProviderVal); },
+        { return static_cast<ChainedHashMap*>(hashMap)->insertEntry(hashValue, bufferProviderVal); },
         hashMapRef,
         hash,
         bufferProvider);
@@ -370,22 +385,20 @@ ChainedHashMapRef& ChainedHashMapRef::operator=(const ChainedHashMapRef& other)
 }
 
 ChainedHashMapRef::EntryIterator::EntryIterator(
-    const nautilus::val<HashMap*>& hashMapRef,
+    const nautilus::val<int8_t*>& pageStarts,
     const nautilus::val<ChainedHashMapEntry*>& currentEntry,
     const nautilus::val<uint64_t>& entrySize,
+    const nautilus::val<uint64_t>& entriesPerPage,
     const nautilus::val<uint64_t>& tupleIndex,
     const nautilus::val<uint64_t>& indexOnPage,
-    const nautilus::val<uint64_t>& numberOfTuplesInCurrentPage,
-    const nautilus::val<uint64_t>& pageIndex,
-    const nautilus::val<uint64_t>& numberOfPages)
-    : hashMapRef(hashMapRef)
+    const nautilus::val<uint64_t>& pageIndex)
+    : pageStarts(pageStarts)
     , currentEntry(currentEntry)
     , entrySize(entrySize)
+    , entriesPerPage(entriesPerPage)
     , tupleIndex(tupleIndex)
     , indexOnPage(indexOnPage)
-    , numberOfTuplesInCurrentPage(numberOfTuplesInCurrentPage)
     , pageIndex(pageIndex)
-    , numberOfPages(numberOfPages)
 {
 }
 
@@ -394,33 +407,18 @@ ChainedHashMapRef::EntryIterator& ChainedHashMapRef::EntryIterator::operator++()
     /// We have to increment the tupleIndex, as we have seen a new tuple.
     ++tupleIndex;
     ++indexOnPage;
-    if (indexOnPage >= numberOfTuplesInCurrentPage)
+    if (indexOnPage >= entriesPerPage)
     {
+        /// Moving to the start of the next page. After the last page, we read the terminating nullptr of the page starts.
         indexOnPage = 0;
-        if (pageIndex + 1 >= numberOfPages)
-        {
-            return *this;
-        }
         ++pageIndex;
-        currentEntry = nautilus::invoke(
-            +[](const HashMap* hashMap, const uint64_t pageIndexVal, const uint64_t indexOnPageVal)
-            {
-                const auto& page = dynamic_cast<const ChainedHashMap*>(hashMap)->getPage(pageIndexVal);
-                return page.getAvailableMemoryArea().subspan(indexOnPageVal * sizeof(ChainedHashMapEntry)).data();
-            },
-            hashMapRef,
-            pageIndex,
-            indexOnPage);
-        numberOfTuplesInCurrentPage = nautilus::invoke(
-            +[](const HashMap* hashMap, const uint64_t pageIndexVal)
-            { return dynamic_cast<const ChainedHashMap*>(hashMap)->getPage(pageIndexVal).getNumberOfTuples(); },
-            hashMapRef,
-            pageIndex);
-
-        return *this;
+        const auto pageStartRef = pageStarts + pageIndex * nautilus::val<uint64_t>(sizeof(int8_t*));
+        currentEntry = static_cast<nautilus::val<ChainedHashMapEntry*>>(readValueFromMemRef<int8_t*>(pageStartRef));
+    }
+    else
+    {
+        currentEntry = static_cast<nautilus::val<int8_t*>>(currentEntry) + entrySize;
     }
-    currentEntry = static_cast<nautilus::val<int8_t*>>(currentEntry) + entrySize;
-
     return *this;
 }
 
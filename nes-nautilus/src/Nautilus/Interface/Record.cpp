@@ -18,6 +18,8 @@
 #include <ostream>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <std/ostream.h>
 #include <ErrorHandling.hpp>
@@ -30,15 +32,20 @@ Record::Record(std::unordered_map<RecordFieldIdentifier, VarVal>&& fields) : rec
 {
 }
 
-const VarVal& Record::read(const RecordFieldIdentifier& recordFieldIdentifier) const
+VarVal Record::read(const RecordFieldIdentifier& recordFieldIdentifier) const
 {
+    if (const auto lazyField = lazyFields.find(recordFieldIdentifier); lazyField != lazyFields.end())
+    {
+        return lazyField->second();
+    }
     if (not recordFields.contains(recordFieldIdentifier))
     {
+        const auto fieldIdentifiers = getAllFieldIdentifiers();
         const std::string allFields = std::accumulate(
-            recordFields.begin(),
-            recordFields.end(),
+            fieldIdentifiers.begin(),
+            fieldIdentifiers.end(),
             std::string{},
-            [](const std::string& acc, const auto& pair) { return acc + pair.first + ", "; });
+            [](const std::string& acc, const auto& fieldIdentifier) { return acc + fieldIdentifier + ", "; });
         throw FieldNotFound("Field {} not found in record {}.", recordFieldIdentifier, allFields);
     }
     return recordFields.at(recordFieldIdentifier);
@@ -46,6 +53,7 @@ const VarVal& Record::read(const RecordFieldIdentifier& recordFieldIdentifier) c
 
 void Record::write(const RecordFieldIdentifier& recordFieldIdentifier, const VarVal& varVal)
 {
+    lazyFields.erase(recordFieldIdentifier);
     /// We can not use the insert_or_assign method, as we otherwise run into a tracing exception, as this might result in incorrect code.
     if (const auto [hashMapIterator, inserted] = recordFields.insert({recordFieldIdentifier, varVal}); not inserted)
     {
@@ -56,43 +64,69 @@ void Record::write(const RecordFieldIdentifier& recordFieldIdentifier, const Var
     }
 }
 
+void Record::writeLazy(const RecordFieldIdentifier& recordFieldIdentifier, LazyFieldLoader loader)
+{
+    recordFields.erase(recordFieldIdentifier);
+    lazyFields.insert_or_assign(recordFieldIdentifier, std::move(loader));
+}
+
 void Record::reassignFields(const Record& other)
 {
     for (const auto& [fieldIdentifier, value] : nautilus::static_iterable(other.recordFields))
     {
         write(fieldIdentifier, value);
     }
+    /// Lazy fields stay lazy, so that reassigning fields does not trace any loads
+    for (const auto& [fieldIdentifier, loader] : other.lazyFields)
+    {
+        writeLazy(fieldIdentifier, loader);
+    }
+}
+
+std::vector<Record::RecordFieldIdentifier> Record::getAllFieldIdentifiers() const
+{
+    std::vector<RecordFieldIdentifier> fieldIdentifiers;
+    fieldIdentifiers.reserve(recordFields.size() + lazyFields.size());
+    for (const auto& [fieldIdentifier, _] : recordFields)
+    {
+        fieldIdentifiers.emplace_back(fieldIdentifier);
+    }
+    for (const auto& [fieldIdentifier, _] : lazyFields)
+    {
+        fieldIdentifiers.emplace_back(fieldIdentifier);
+    }
+    return fieldIdentifiers;
 }
 
 nautilus::val<std::ostream>& operator<<(nautilus::val<std::ostream>& os, const Record& record)
 {
-    for (const auto& [_, value] : nautilus::static_iterable(record.recordFields))
+    for (const auto& fieldIdentifier : nautilus::static_iterable(record.getAllFieldIdentifiers()))
     {
-        os << value << ", ";
+        os << record.read(fieldIdentifier) << ", ";
     }
     return os;
 }
 
 nautilus::val<uint64_t> Record::getNumberOfFields() const
 {
-    return recordFields.size();
+    return recordFields.size() + lazyFields.size();
 }
 
 bool Record::hasField(const RecordFieldIdentifier& fieldName) const
 {
-    return recordFields.contains(fieldName);
+    return recordFields.contains(fieldName) or lazyFields.contains(fieldName);
 }
 
 nautilus::val<bool> operator==(const Record& lhs, const Record& rhs)
 {
-    if (lhs.recordFields.size() != rhs.recordFields.size())
+    if (lhs.recordFields.size() + lhs.lazyFields.size() != rhs.recordFields.size() + rhs.lazyFields.size())
     {
         return false;
     }
 
-    for (const auto& [fieldName, value] : nautilus::static_iterable(lhs.recordFields))
+    for (const auto& fieldName : nautilus::static_iterable(lhs.getAllFieldIdentifiers()))
     {
-        if (not rhs.hasField(fieldName) or value != rhs.read(fieldName))
+        if (not rhs.hasField(fieldName) or lhs.read(fieldName) != rhs.read(fieldName))
         {
             return false;
         }
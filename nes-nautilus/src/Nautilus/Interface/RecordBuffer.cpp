@@ -15,6 +15,7 @@
 
 #include <cstdint>
 #include <Identifiers/Identifiers.hpp>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
 #include <Nautilus/Interface/NESStrongTypeRef.hpp>
 #include <Nautilus/Interface/TimestampRef.hpp>
 #include <Nautilus/Interface/TupleBufferProxyFunctions.hpp>
@@ -43,7 +44,8 @@ void RecordBuffer::setNumRecords(const nautilus::val<uint64_t>& numRecordsValue)
 
 nautilus::val<int8_t*> RecordBuffer::getMemArea() const
 {
-    return invoke(ProxyFunctions::NES_Memory_TupleBuffer_getMemArea, tupleBufferRef);
+    /// Reading the pointer to the memory area directly from the tuple buffer, as it is accessed for every buffer by every scan and emit
+    return readValueFromMemRef<int8_t*>(getMemberRef(tupleBufferRef, &TupleBuffer::ptr));
 }
 
 const nautilus::val<TupleBuffer*>& RecordBuffer::getReference() const
@@ -0,0 +1,118 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Arena.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+/// Checks that the ArenaRef bump-allocates from the chunk that it requested from the arena and requests a new chunk, once an allocation
+/// does not fit into the remaining chunk
+class ArenaTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t BUFFER_SIZE = 256;
+    static constexpr uint64_t NUMBER_OF_BUFFERS = 8;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("ArenaTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup ArenaTest class.");
+    }
+
+    static std::byte* allocate(ArenaRef& arenaRef, const size_t sizeInBytes)
+    {
+        const auto memory = arenaRef.allocateMemory(nautilus::val<size_t>(sizeInBytes));
+        return reinterpret_cast<std::byte*>(nautilus::details::RawValueResolver<int8_t*>::getRawValue(memory)); ///NOLINT
+    }
+
+    static bool isInBuffer(const TupleBuffer& buffer, const std::byte* memory, const size_t sizeInBytes)
+    {
+        const auto memoryArea = buffer.getAvailableMemoryArea();
+        return memory >= memoryArea.data() and memory + sizeInBytes <= memoryArea.data() + memoryArea.size();
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+};
+
+TEST_F(ArenaTest, bumpAllocatesFromOneChunk)
+{
+    Arena arena(bufferManager);
+    ArenaRef arenaRef(nautilus::val<Arena*>(&arena));
+    constexpr size_t allocationSize = 16;
+
+    auto* const first = allocate(arenaRef, allocationSize);
+    for (size_t allocation = 1; allocation < BUFFER_SIZE / allocationSize; ++allocation)
+    {
+        EXPECT_EQ(allocate(arenaRef, allocationSize), first + (allocation * allocationSize));
+    }
+    ASSERT_EQ(arena.fixedSizeBuffers.size(), 1);
+    EXPECT_EQ(first, arena.fixedSizeBuffers.front().getAvailableMemoryArea().data());
+}
+
+TEST_F(ArenaTest, refillsChunkOnceAllocationDoesNotFit)
+{
+    Arena arena(bufferManager);
+    ArenaRef arenaRef(nautilus::val<Arena*>(&arena));
+    constexpr size_t allocationSize = 100;
+
+    /// Two allocations fit into the first chunk, the third one gets the start of a new chunk
+    auto* const first = allocate(arenaRef, allocationSize);
+    auto* const second = allocate(arenaRef, allocationSize);
+    auto* const third = allocate(arenaRef, allocationSize);
+    ASSERT_EQ(arena.fixedSizeBuffers.size(), 2);
+    EXPECT_EQ(second, first + allocationSize);
+    EXPECT_TRUE(isInBuffer(arena.fixedSizeBuffers[0], first, 2 * allocationSize));
+    EXPECT_EQ(third, arena.fixedSizeBuffers[1].getAvailableMemoryArea().data());
+
+    /// Allocations of the arena itself do not overlap the chunk of the ArenaRef
+    const auto arenaAllocation = arena.allocateMemory(allocationSize);
+    ASSERT_EQ(arena.fixedSizeBuffers.size(), 3);
+    EXPECT_TRUE(isInBuffer(arena.fixedSizeBuffers[2], arenaAllocation.data(), allocationSize));
+}
+
+TEST_F(ArenaTest, allocationLargerThanChunkGetsUnpooledBuffer)
+{
+    Arena arena(bufferManager);
+    ArenaRef arenaRef(nautilus::val<Arena*>(&arena));
+    constexpr size_t smallAllocationSize = 16;
+    constexpr size_t largeAllocationSize = 4 * BUFFER_SIZE;
+
+    auto* const small = allocate(arenaRef, smallAllocationSize);
+    auto* const large = allocate(arenaRef, largeAllocationSize);
+    ASSERT_EQ(arena.unpooledBuffers.size(), 1);
+    EXPECT_TRUE(isInBuffer(arena.unpooledBuffers.front(), large, largeAllocationSize));
+    EXPECT_TRUE(isInBuffer(arena.fixedSizeBuffers.front(), small, smallAllocationSize));
+
+    /// The unpooled buffer is used up by the large allocation. Thus, the next allocation continues in a pooled buffer.
+    auto* const next = allocate(arenaRef, smallAllocationSize);
+    EXPECT_FALSE(isInBuffer(arena.unpooledBuffers.front(), next, smallAllocationSize));
+    EXPECT_TRUE(isInBuffer(arena.fixedSizeBuffers.back(), next, smallAllocationSize));
+    EXPECT_NE(next, small);
+}
+
+}
@@ -12,15 +12,25 @@
     limitations under the License.
 */
 
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <tuple>
 #include <vector>
 #include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
 
 #include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Runtime/BufferManager.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <Util/Logger/LogLevel.hpp>
 #include <Util/Logger/Logger.hpp>
@@ -31,6 +41,8 @@
 #include <BaseUnitTest.hpp>
 #include <ChainedHashMapTestUtils.hpp>
 #include <NautilusTestUtils.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -121,6 +133,215 @@ TEST_P(ChainedHashMapTest, fixedDataTypesUpdate)
     checkEntryIterator(hashMap, exactMap);
 }
 
+TEST(ChainedHashMapTagTest, findChainSkipsChainsWithoutTagOfHash)
+{
+    const auto bufferManager = BufferManager::create();
+    auto hashMap = ChainedHashMap(sizeof(uint64_t), sizeof(uint64_t), 1, 4096);
+
+    /// Both hashes belong to the first bucket but set different bits in its tag
+    constexpr uint64_t firstHash = 0;
+    constexpr uint64_t secondHash = uint64_t{1} << ChainedHashMap::TAG_HASH_SHIFT;
+    ASSERT_NE(ChainedHashMap::getTag(firstHash), ChainedHashMap::getTag(secondHash));
+
+    auto* const firstEntry = static_cast<ChainedHashMapEntry*>(hashMap.insertEntry(firstHash, bufferManager.get()));
+    EXPECT_EQ(hashMap.findChain(firstHash), firstEntry);
+    EXPECT_EQ(hashMap.findChain(secondHash), nullptr);
+
+    /// The bucket head carries the tags of all entries of the chain
+    auto* const secondEntry = static_cast<ChainedHashMapEntry*>(hashMap.insertEntry(secondHash, bufferManager.get()));
+    EXPECT_EQ(hashMap.findChain(firstHash), secondEntry);
+    EXPECT_EQ(hashMap.findChain(secondHash), secondEntry);
+    EXPECT_EQ(hashMap.getStartOfChain(0), secondEntry);
+    EXPECT_EQ(secondEntry->next, firstEntry);
+}
+
+TEST(ChainedHashMapResetTest, resetRetainsEntrySpaceAndPages)
+{
+    const auto bufferManager = BufferManager::create();
+    auto hashMap = ChainedHashMap(sizeof(uint64_t), sizeof(uint64_t), 1, 4096);
+    EXPECT_TRUE(hashMap.hasConfiguration(sizeof(uint64_t), sizeof(uint64_t), 1, 4096));
+    EXPECT_FALSE(hashMap.hasConfiguration(sizeof(uint64_t), sizeof(uint64_t), 1, 8192));
+
+    constexpr uint64_t hash = 0;
+    hashMap.insertEntry(hash, bufferManager.get());
+    const auto* const pageMemory = hashMap.getPage(0).getAvailableMemoryArea().data();
+
+    hashMap.reset(1);
+    EXPECT_EQ(hashMap.getNumberOfTuples(), 0);
+    EXPECT_EQ(hashMap.getNumberOfPages(), 0);
+    EXPECT_EQ(hashMap.findChain(hash), nullptr);
+
+    /// The new entry is stored on the retained page
+    auto* const newEntry = static_cast<ChainedHashMapEntry*>(hashMap.insertEntry(hash, bufferManager.get()));
+    EXPECT_EQ(hashMap.getNumberOfTuples(), 1);
+    EXPECT_EQ(hashMap.getPage(0).getAvailableMemoryArea().data(), pageMemory);
+    EXPECT_EQ(hashMap.findChain(hash), newEntry);
+    EXPECT_EQ(newEntry->next, nullptr);
+}
+
+/// Variable sized keys of up to MAX_INLINED_VAR_SIZED_CONTENT_SIZE bytes are stored inline in the entry, larger ones in the var sized space
+class ChainedHashMapVarSizedKeyTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_BUCKETS = 16;
+    static constexpr uint64_t PAGE_SIZE = 4096;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("ChainedHashMapVarSizedKeyTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup ChainedHashMapVarSizedKeyTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        const auto schema = Schema{}.addField("key", DataType::Type::VARSIZED_POINTER_REP).addField("value", DataType::Type::UINT64);
+        std::tie(fieldKeys, fieldValues) = ChainedEntryMemoryProvider::createFieldOffsets(schema, {"key"}, {"value"});
+        entrySize = sizeof(ChainedHashMapEntry) + KEY_SIZE + VALUE_SIZE;
+    }
+
+    [[nodiscard]] std::unique_ptr<ChainedHashMap> createHashMap() const
+    {
+        return std::make_unique<ChainedHashMap>(KEY_SIZE, VALUE_SIZE, NUMBER_OF_BUCKETS, PAGE_SIZE);
+    }
+
+    [[nodiscard]] ChainedHashMapRef createHashMapRef(ChainedHashMap& hashMap) const
+    {
+        return {nautilus::val<HashMap*>(&hashMap), fieldKeys, fieldValues, PAGE_SIZE / entrySize, entrySize};
+    }
+
+    /// Creates a size-prefixed variable sized value, which is stored in its own memory
+    static std::vector<int8_t> createVarSized(const std::string& content)
+    {
+        const uint32_t contentSize = content.size();
+        std::vector<int8_t> varSized(sizeof(uint32_t) + contentSize);
+        std::memcpy(varSized.data(), &contentSize, sizeof(uint32_t));
+        std::memcpy(varSized.data() + sizeof(uint32_t), content.data(), contentSize);
+        return varSized;
+    }
+
+    /// Finds or creates the entry for the key and stores the value, if the entry gets created
+    nautilus::val<AbstractHashMapEntry*>
+    findOrCreate(ChainedHashMapRef& hashMapRef, ChainedHashMap& hashMap, std::vector<int8_t>& varSizedKey, const uint64_t value)
+    {
+        Record recordKey;
+        recordKey.write("key", VarVal(VariableSizedData(nautilus::val<int8_t*>(varSizedKey.data()))));
+        return hashMapRef.findOrCreateEntry(
+            recordKey,
+            *TestUtils::NautilusTestUtils::getMurMurHashFunction(),
+            [&](const nautilus::val<AbstractHashMapEntry*>& entry)
+            {
+                Record recordValue;
+                recordValue.write("value", VarVal(nautilus::val<uint64_t>(value)));
+                createEntryRef(entry, hashMap).copyValuesToEntry(recordValue, nautilus::val<AbstractBufferProvider*>(bufferManager.get()));
+            },
+            nautilus::val<AbstractBufferProvider*>(bufferManager.get()));
+    }
+
+    [[nodiscard]] ChainedHashMapRef::ChainedEntryRef
+    createEntryRef(const nautilus::val<AbstractHashMapEntry*>& entry, ChainedHashMap& hashMap) const
+    {
+        return {static_cast<nautilus::val<ChainedHashMapEntry*>>(entry), nautilus::val<ChainedHashMap*>(&hashMap), fieldKeys, fieldValues};
+    }
+
+    /// Returns true, if the content of the key field of the entryIndex-th entry is stored in the entry itself
+    [[nodiscard]] bool isKeyInlined(const ChainedHashMap& hashMap, const uint64_t entryIndex) const
+    {
+        const auto* const keyField = hashMap.getPage(0).getAvailableMemoryArea<int8_t>().data() + (entryIndex * entrySize)
+            + fieldKeys.front().fieldOffset;
+        uint32_t contentSize = 0;
+        std::memcpy(&contentSize, keyField, sizeof(contentSize));
+        return contentSize <= ChainedEntryMemoryProvider::MAX_INLINED_VAR_SIZED_CONTENT_SIZE;
+    }
+
+    static constexpr uint64_t KEY_SIZE = ChainedEntryMemoryProvider::VAR_SIZED_FIELD_SIZE;
+    static constexpr uint64_t VALUE_SIZE = sizeof(uint64_t);
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create();
+    std::vector<FieldOffsets> fieldKeys;
+    std::vector<FieldOffsets> fieldValues;
+    uint64_t entrySize = 0;
+};
+
+/// Keys are found by their content, regardless of whether the stored key is inlined and the probing key is not
+TEST_F(ChainedHashMapVarSizedKeyTest, inlinedAndOutOfLineKeysAreFoundByContent)
+{
+    /// Contents of up to 12 bytes are inlined, the keys around the limit share their prefix
+    const std::vector<std::string> contents{
+        "", "short", "abcdefghijk", "abcdefghijkl", "abcdefghijklm", "a variable sized key that is stored in the var sized space"};
+    ASSERT_EQ(std::string("abcdefghijkl").size(), ChainedEntryMemoryProvider::MAX_INLINED_VAR_SIZED_CONTENT_SIZE);
+
+    const auto hashMap = createHashMap();
+    auto hashMapRef = createHashMapRef(*hashMap);
+    for (uint64_t i = 0; i < contents.size(); ++i)
+    {
+        auto varSizedKey = createVarSized(contents[i]);
+        findOrCreate(hashMapRef, *hashMap, varSizedKey, i);
+    }
+    ASSERT_EQ(hashMap->getNumberOfTuples(), contents.size());
+    for (uint64_t i = 0; i < contents.size(); ++i)
+    {
+        EXPECT_EQ(isKeyInlined(*hashMap, i), contents[i].size() <= ChainedEntryMemoryProvider::MAX_INLINED_VAR_SIZED_CONTENT_SIZE);
+    }
+
+    /// Probing with keys in other memory finds the same entries, whose keys compare equal to the probing keys
+    for (uint64_t i = 0; i < contents.size(); ++i)
+    {
+        auto varSizedKey = createVarSized(contents[i]);
+        const auto entry = findOrCreate(hashMapRef, *hashMap, varSizedKey, contents.size());
+        const auto entryRef = createEntryRef(entry, *hashMap);
+        const VariableSizedData probingKey(nautilus::val<int8_t*>(varSizedKey.data()));
+        const auto storedKey = entryRef.getKey("key").cast<VariableSizedData>();
+        EXPECT_TRUE(storedKey == probingKey) << "Key " << contents[i];
+        EXPECT_EQ(storedKey.getContentSize(), static_cast<uint32_t>(contents[i].size()));
+        EXPECT_EQ(entryRef.getValue().read("value").cast<nautilus::val<uint64_t>>(), i);
+    }
+    EXPECT_EQ(hashMap->getNumberOfTuples(), contents.size());
+}
+
+/// Merging entries into another hash map copies and compares the keys in their stored form
+TEST_F(ChainedHashMapVarSizedKeyTest, entriesWithInlinedAndOutOfLineKeysAreMerged)
+{
+    const std::vector<std::string> contents{"short", "abcdefghijkl", "abcdefghijklm", "a variable sized key in the var sized space"};
+    const auto hashMap = createHashMap();
+    auto hashMapRef = createHashMapRef(*hashMap);
+    std::vector<nautilus::val<AbstractHashMapEntry*>> entries;
+    for (uint64_t i = 0; i < contents.size(); ++i)
+    {
+        auto varSizedKey = createVarSized(contents[i]);
+        entries.emplace_back(findOrCreate(hashMapRef, *hashMap, varSizedKey, i));
+    }
+
+    const auto mergedHashMap = createHashMap();
+    auto mergedHashMapRef = createHashMapRef(*mergedHashMap);
+    const auto bufferProvider = nautilus::val<AbstractBufferProvider*>(bufferManager.get());
+    uint64_t numberOfUpdates = 0;
+    for (int round = 0; round < 2; ++round)
+    {
+        for (const auto& entry : entries)
+        {
+            mergedHashMapRef.insertOrUpdateEntry(
+                entry,
+                [&](const nautilus::val<AbstractHashMapEntry*>&) { ++numberOfUpdates; },
+                [&](const nautilus::val<AbstractHashMapEntry*>& newEntry)
+                { createEntryRef(newEntry, *mergedHashMap).copyValuesToEntry(createEntryRef(entry, *hashMap), bufferProvider); },
+                bufferProvider);
+        }
+    }
+
+    /// The second round updates the entries that the first round has inserted
+    EXPECT_EQ(mergedHashMap->getNumberOfTuples(), contents.size());
+    EXPECT_EQ(numberOfUpdates, contents.size());
+    for (uint64_t i = 0; i < contents.size(); ++i)
+    {
+        EXPECT_EQ(isKeyInlined(*mergedHashMap, i), isKeyInlined(*hashMap, i));
+        const auto mergedEntry = mergedHashMapRef.findEntry(entries[i]);
+        const auto storedKey = createEntryRef(mergedEntry, *mergedHashMap).getKey("key").cast<VariableSizedData>();
+        const auto originalKey = createEntryRef(entries[i], *hashMap).getKey("key").cast<VariableSizedData>();
+        EXPECT_TRUE(storedKey == originalKey) << "Key " << contents[i];
+        EXPECT_EQ(createEntryRef(mergedEntry, *mergedHashMap).getValue().read("value").cast<nautilus::val<uint64_t>>(), i);
+    }
+}
+
 INSTANTIATE_TEST_CASE_P(
     ChainedHashMapTest,
     ChainedHashMapTest,
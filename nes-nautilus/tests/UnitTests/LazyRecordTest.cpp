@@ -0,0 +1,126 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <magic_enum/magic_enum.hpp>
+#include <BaseUnitTest.hpp>
+#include <NautilusTestUtils.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+/// Checks for the row and the column layout that lazily read records contain the same values as eagerly read records and that a lazy
+/// field gets loaded only once
+class LazyRecordTest : public Testing::BaseUnitTest,
+                       public TestUtils::NautilusTestUtils,
+                       public testing::WithParamInterface<MemoryLayoutType>
+{
+public:
+    static constexpr uint64_t NUMBER_OF_RECORDS = 100;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("LazyRecordTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup LazyRecordTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        schema = createSchemaFromBasicTypes(
+            {DataType::Type::INT8, DataType::Type::UINT16, DataType::Type::INT64, DataType::Type::FLOAT32, DataType::Type::VARSIZED});
+        bufferRef = LowerSchemaProvider::lowerSchema(bufferManager->getBufferSize(), schema, GetParam());
+        fields = bufferRef->getAllFieldNames();
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create();
+    Schema schema;
+    std::shared_ptr<TupleBufferRef> bufferRef;
+    std::vector<Record::RecordFieldIdentifier> fields;
+};
+
+TEST_P(LazyRecordTest, lazyRecordsMatchEagerRecords)
+{
+    auto buffers = createMonotonicallyIncreasingValues(schema, GetParam(), NUMBER_OF_RECORDS, *bufferManager);
+    for (auto& buffer : buffers)
+    {
+        const RecordBuffer recordBuffer(nautilus::val<TupleBuffer*>(&buffer));
+        auto cursor = bufferRef->createCursor(recordBuffer, nautilus::val<uint64_t>(0));
+        for (nautilus::val<uint64_t> recordIndex = 0; recordIndex < recordBuffer.getNumRecords(); recordIndex = recordIndex + 1)
+        {
+            const auto eagerRecord = bufferRef->readRecord(fields, recordBuffer, recordIndex);
+            const auto lazyRecord = bufferRef->readRecordLazily(fields, recordBuffer, recordIndex);
+            const auto lazyRecordAtCursor = bufferRef->readRecordLazilyAtCursor(fields, recordBuffer, cursor);
+            cursor.advance();
+
+            /// Reading the lazy fields twice returns the same values
+            for (uint64_t read = 0; read < 2; ++read)
+            {
+                const auto lazyDifference = compareRecords(lazyRecord, eagerRecord, fields);
+                EXPECT_FALSE(lazyDifference.has_value()) << *lazyDifference;
+                const auto cursorDifference = compareRecords(lazyRecordAtCursor, eagerRecord, fields);
+                EXPECT_FALSE(cursorDifference.has_value()) << *cursorDifference;
+            }
+        }
+    }
+}
+
+TEST_P(LazyRecordTest, lazyFieldIsLoadedOnce)
+{
+    auto buffers = createMonotonicallyIncreasingValues(schema, GetParam(), NUMBER_OF_RECORDS, *bufferManager);
+    ASSERT_FALSE(buffers.empty());
+    const RecordBuffer recordBuffer(nautilus::val<TupleBuffer*>(&buffers.front()));
+    nautilus::val<uint64_t> recordIndex(0);
+    const auto& fieldName = fields.front();
+    const auto lazyRecord = bufferRef->readRecordLazily(fields, recordBuffer, recordIndex);
+    const auto firstRead = lazyRecord.read(fieldName);
+
+    /// Overwriting the field in the buffer after the first read does not change the value of the lazy field anymore
+    auto changedRecord = bufferRef->readRecord(fields, recordBuffer, recordIndex);
+    const auto changedValue = firstRead + VarVal(nautilus::val<int8_t>(1));
+    changedRecord.write(fieldName, changedValue);
+    bufferRef->writeRecord(recordIndex, recordBuffer, changedRecord, nautilus::val<AbstractBufferProvider*>(bufferManager.get()));
+    EXPECT_TRUE(lazyRecord.read(fieldName) == firstRead);
+
+    /// A newly read record loads the changed value
+    const auto newLazyRecord = bufferRef->readRecordLazily(fields, recordBuffer, recordIndex);
+    EXPECT_TRUE(newLazyRecord.read(fieldName) == changedValue.castToType(DataType::Type::INT8));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    LazyRecordTest,
+    LazyRecordTest,
+    ::testing::Values(MemoryLayoutType::ROW_LAYOUT, MemoryLayoutType::COLUMNAR_LAYOUT),
+    [](const testing::TestParamInfo<LazyRecordTest::ParamType>& info) { return std::string(magic_enum::enum_name(info.param)); });
+
+}
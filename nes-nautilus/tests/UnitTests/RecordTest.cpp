@@ -0,0 +1,105 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+class RecordTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestCase()
+    {
+        Logger::setupLogging("RecordTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup RecordTest class.");
+    }
+
+    static void TearDownTestCase() { NES_INFO("Tear down RecordTest class."); }
+};
+
+TEST_F(RecordTest, LazyFieldIsLoadedOnlyWhenRead)
+{
+    uint64_t numberOfLoads = 0;
+    Record record;
+    record.writeLazy(
+        "lazy",
+        [&numberOfLoads]
+        {
+            ++numberOfLoads;
+            return VarVal(nautilus::val<uint64_t>(42));
+        });
+    record.write("materialized", VarVal(nautilus::val<uint64_t>(23)));
+
+    /// Adding, querying and reading other fields does not load the lazy field
+    EXPECT_TRUE(record.hasField("lazy"));
+    EXPECT_EQ(record.getNumberOfFields(), 2);
+    EXPECT_EQ(record.read("materialized").cast<nautilus::val<uint64_t>>(), 23);
+    EXPECT_EQ(numberOfLoads, 0);
+
+    /// The first read loads the field
+    EXPECT_EQ(record.read("lazy").cast<nautilus::val<uint64_t>>(), 42);
+    EXPECT_EQ(numberOfLoads, 1);
+
+    /// Each further read calls the loader again, as the record leaves caching the loaded value to the loader
+    EXPECT_EQ(record.read("lazy").cast<nautilus::val<uint64_t>>(), 42);
+    EXPECT_EQ(numberOfLoads, 2);
+}
+
+TEST_F(RecordTest, WritingLazyFieldReplacesLoader)
+{
+    uint64_t numberOfLoads = 0;
+    Record record;
+    record.writeLazy(
+        "field",
+        [&numberOfLoads]
+        {
+            ++numberOfLoads;
+            return VarVal(nautilus::val<uint64_t>(42));
+        });
+
+    /// A written value replaces the lazy field, thus, reading it does not load anymore
+    record.write("field", VarVal(nautilus::val<uint64_t>(7)));
+    EXPECT_EQ(record.read("field").cast<nautilus::val<uint64_t>>(), 7);
+    EXPECT_EQ(numberOfLoads, 0);
+    EXPECT_EQ(record.getNumberOfFields(), 1);
+}
+
+TEST_F(RecordTest, ReassignedLazyFieldStaysLazy)
+{
+    uint64_t numberOfLoads = 0;
+    Record source;
+    source.writeLazy(
+        "lazy",
+        [&numberOfLoads]
+        {
+            ++numberOfLoads;
+            return VarVal(nautilus::val<uint64_t>(42));
+        });
+
+    Record target;
+    target.reassignFields(source);
+    EXPECT_EQ(numberOfLoads, 0);
+    EXPECT_EQ(target.read("lazy").cast<nautilus::val<uint64_t>>(), 42);
+    EXPECT_EQ(numberOfLoads, 1);
+}
+
+}
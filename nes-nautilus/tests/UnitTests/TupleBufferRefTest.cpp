@@ -0,0 +1,308 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Runtime/VariableSizedAccess.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <NautilusTestUtils.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+class TupleBufferRefTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t BUFFER_SIZE = 128;
+    static constexpr uint64_t NUMBER_OF_BUFFERS = 64;
+
+    static void SetUpTestCase()
+    {
+        Logger::setupLogging("TupleBufferRefTest.log", LogLevel::LOG_DEBUG);
+        NES_INFO("Setup TupleBufferRefTest class.");
+    }
+
+    static void TearDownTestCase() { NES_INFO("Tear down TupleBufferRefTest class."); }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        bufferManager = BufferManager::create(BUFFER_SIZE, NUMBER_OF_BUFFERS);
+        const auto schema = TestUtils::NautilusTestUtils::createSchemaFromBasicTypes({DataType::Type::VARSIZED});
+        bufferRef = LowerSchemaProvider::lowerSchema(BUFFER_SIZE, schema, MemoryLayoutType::ROW_LAYOUT);
+    }
+
+    /// Creates a variable sized value, whose first four bytes store the size of its content
+    static std::vector<int8_t> createVarSized(const uint32_t contentSize, const int8_t content)
+    {
+        std::vector<int8_t> varSized(sizeof(uint32_t) + contentSize, content);
+        std::memcpy(varSized.data(), &contentSize, sizeof(uint32_t));
+        return varSized;
+    }
+
+    /// Writes the values record by record via a cursor, like the emit does, without flushing the cursor
+    TupleBufferRef::RecordCursor
+    writeViaCursor(TupleBuffer& buffer, const RecordBuffer& recordBuffer, std::vector<std::vector<int8_t>>& varSizedValues) const
+    {
+        const auto fieldName = bufferRef->getAllFieldNames().front();
+        auto cursor = bufferRef->createCursor(recordBuffer, nautilus::val<uint64_t>(0));
+        for (auto& varSized : varSizedValues)
+        {
+            Record record;
+            record.write(fieldName, VarVal(VariableSizedData(nautilus::val<int8_t*>(varSized.data()))));
+            bufferRef->writeRecordAtCursor(cursor, recordBuffer, record, nautilus::val<AbstractBufferProvider*>(bufferManager.get()));
+            cursor.advance();
+        }
+        buffer.setNumberOfTuples(varSizedValues.size());
+        return cursor;
+    }
+
+    /// Returns the combined index that has been written to the record at recordIndex
+    static VariableSizedAccess getAccess(const TupleBuffer& buffer, const uint64_t recordIndex)
+    {
+        VariableSizedAccess::CombinedIndex combinedIndex = 0;
+        std::memcpy(&combinedIndex, buffer.getAvailableMemoryArea().data() + (recordIndex * sizeof(combinedIndex)), sizeof(combinedIndex));
+        return VariableSizedAccess(combinedIndex);
+    }
+
+    static bool storesValue(const TupleBuffer& buffer, const uint64_t recordIndex, const std::vector<int8_t>& expectedVarSized)
+    {
+        const auto storedVarSized = TupleBufferRef::loadAssociatedVarSizedValue(buffer, getAccess(buffer, recordIndex));
+        return std::ranges::equal(storedVarSized, std::as_bytes(std::span{expectedVarSized}));
+    }
+
+    /// Reads the records of the input buffer and writes them unmodified via a cursor to the output buffer
+    void copyRecords(const RecordBuffer& inputRecordBuffer, RecordBuffer outputRecordBuffer, const bool forwarding) const
+    {
+        const auto fieldNames = bufferRef->getAllFieldNames();
+        auto cursor = bufferRef->createCursor(outputRecordBuffer, nautilus::val<uint64_t>(0));
+        if (forwarding)
+        {
+            cursor.setForwardingBuffer(inputRecordBuffer.getReference());
+        }
+        for (nautilus::val<uint64_t> recordIndex = 0; recordIndex < inputRecordBuffer.getNumRecords(); recordIndex = recordIndex + 1)
+        {
+            const auto record = bufferRef->readRecord(fieldNames, inputRecordBuffer, recordIndex);
+            bufferRef->writeRecordAtCursor(
+                cursor, outputRecordBuffer, record, nautilus::val<AbstractBufferProvider*>(bufferManager.get()));
+            cursor.advance();
+        }
+        TupleBufferRef::flushCursor(cursor, outputRecordBuffer);
+        outputRecordBuffer.setNumRecords(inputRecordBuffer.getNumRecords());
+    }
+
+    /// Creates a buffer whose values are stored behind each other in a single child buffer
+    TupleBuffer createInputBuffer(std::vector<std::vector<int8_t>>& varSizedValues) const
+    {
+        auto buffer = bufferManager->getBufferBlocking();
+        const RecordBuffer recordBuffer(nautilus::val<TupleBuffer*>(&buffer));
+        const auto cursor = writeViaCursor(buffer, recordBuffer, varSizedValues);
+        TupleBufferRef::flushCursor(cursor, recordBuffer);
+        return buffer;
+    }
+
+    static std::vector<std::vector<int8_t>> createVarSizedValues(const uint64_t numberOfValues)
+    {
+        std::vector<std::vector<int8_t>> varSizedValues;
+        for (uint64_t i = 0; i < numberOfValues; ++i)
+        {
+            varSizedValues.emplace_back(createVarSized(10, static_cast<int8_t>(i)));
+        }
+        return varSizedValues;
+    }
+
+    std::shared_ptr<BufferManager> bufferManager;
+    std::shared_ptr<TupleBufferRef> bufferRef;
+};
+
+/// Values that fit into the current child buffer are copied inline behind each other into the same child buffer
+TEST_F(TupleBufferRefTest, CursorAppendsInlineToSameChildBuffer)
+{
+    auto buffer = bufferManager->getBufferBlocking();
+    const RecordBuffer recordBuffer(nautilus::val<TupleBuffer*>(&buffer));
+    std::vector<std::vector<int8_t>> varSizedValues;
+    for (int8_t i = 0; i < 5; ++i)
+    {
+        varSizedValues.emplace_back(createVarSized(10, i));
+    }
+    const auto cursor = writeViaCursor(buffer, recordBuffer, varSizedValues);
+    TupleBufferRef::flushCursor(cursor, recordBuffer);
+
+    ASSERT_EQ(buffer.getNumberOfChildBuffers(), 1);
+    uint32_t expectedOffset = 0;
+    for (uint64_t recordIndex = 0; recordIndex < varSizedValues.size(); ++recordIndex)
+    {
+        const auto access = getAccess(buffer, recordIndex);
+        EXPECT_EQ(access.getIndex(), VariableSizedAccess::Index(0));
+        EXPECT_EQ(access.getOffset().getRawOffset(), expectedOffset);
+        EXPECT_TRUE(storesValue(buffer, recordIndex, varSizedValues[recordIndex]));
+        expectedOffset += varSizedValues[recordIndex].size();
+    }
+}
+
+/// A value that does not fit into the current child buffer moves the cursor to a new child buffer, which is acquired via a proxy call
+TEST_F(TupleBufferRefTest, CursorRefillsWithNewChildBuffer)
+{
+    auto buffer = bufferManager->getBufferBlocking();
+    const RecordBuffer recordBuffer(nautilus::val<TupleBuffer*>(&buffer));
+    /// Two values of 64 bytes do not fit into one child buffer. A value larger than a pooled buffer requires an unpooled child buffer.
+    std::vector<std::vector<int8_t>> varSizedValues{
+        createVarSized(60, 1), createVarSized(60, 2), createVarSized(2 * BUFFER_SIZE, 3), createVarSized(10, 4), createVarSized(10, 5)};
+    const auto cursor = writeViaCursor(buffer, recordBuffer, varSizedValues);
+    TupleBufferRef::flushCursor(cursor, recordBuffer);
+
+    /// The last two values share the child buffer that was acquired for the first of them
+    ASSERT_EQ(buffer.getNumberOfChildBuffers(), 4);
+    const std::vector<uint32_t> expectedChildIndexes{0, 1, 2, 3, 3};
+    const std::vector<uint32_t> expectedOffsets{0, 0, 0, 0, 14};
+    for (uint64_t recordIndex = 0; recordIndex < varSizedValues.size(); ++recordIndex)
+    {
+        const auto access = getAccess(buffer, recordIndex);
+        EXPECT_EQ(access.getIndex(), VariableSizedAccess::Index(expectedChildIndexes[recordIndex]));
+        EXPECT_EQ(access.getOffset().getRawOffset(), expectedOffsets[recordIndex]);
+        EXPECT_TRUE(storesValue(buffer, recordIndex, varSizedValues[recordIndex]));
+    }
+    EXPECT_GE(buffer.loadChildBuffer(VariableSizedAccess::Index(2)).getBufferSize(), varSizedValues[2].size());
+}
+
+/// The inline path does not update the used bytes of the child buffer. Refilling publishes them for the previous child buffer and
+/// flushing the cursor for the current one, before the record buffer gets emitted.
+TEST_F(TupleBufferRefTest, UsedBytesArePublishedOnRefillAndFlush)
+{
+    auto buffer = bufferManager->getBufferBlocking();
+    const RecordBuffer recordBuffer(nautilus::val<TupleBuffer*>(&buffer));
+    std::vector<std::vector<int8_t>> varSizedValues{
+        createVarSized(30, 1), createVarSized(30, 2), createVarSized(60, 3), createVarSized(20, 4)};
+    const auto cursor = writeViaCursor(buffer, recordBuffer, varSizedValues);
+    ASSERT_EQ(buffer.getNumberOfChildBuffers(), 2);
+
+    /// The first child buffer got published on the refill, the second one only knows about the value it has been acquired for
+    const auto firstChildBytes = varSizedValues[0].size() + varSizedValues[1].size();
+    const auto secondChildBytes = varSizedValues[2].size() + varSizedValues[3].size();
+    EXPECT_EQ(buffer.loadChildBuffer(VariableSizedAccess::Index(0)).getNumberOfTuples(), firstChildBytes);
+    EXPECT_EQ(buffer.loadChildBuffer(VariableSizedAccess::Index(1)).getNumberOfTuples(), varSizedValues[2].size());
+
+    TupleBufferRef::flushCursor(cursor, recordBuffer);
+    EXPECT_EQ(buffer.loadChildBuffer(VariableSizedAccess::Index(1)).getNumberOfTuples(), secondChildBytes);
+
+    /// Appending to the flushed record buffer without the cursor continues behind the published bytes
+    const auto appendedVarSized = createVarSized(4, 5);
+    const auto access = TupleBufferRef::writeVarSized<TupleBufferRef::PREPEND_NONE>(
+        buffer, *bufferManager, std::as_bytes(std::span{appendedVarSized}));
+    EXPECT_EQ(access.getIndex(), VariableSizedAccess::Index(1));
+    EXPECT_EQ(access.getOffset().getRawOffset(), secondChildBytes);
+}
+
+/// A value read from a child buffer refers to the buffer and the combined index it has been read from, a created value does not
+TEST_F(TupleBufferRefTest, ReadValueRefersToBackingBuffer)
+{
+    auto varSizedValues = createVarSizedValues(3);
+    auto inputBuffer = createInputBuffer(varSizedValues);
+    const RecordBuffer inputRecordBuffer(nautilus::val<TupleBuffer*>(&inputBuffer));
+    const auto fieldName = bufferRef->getAllFieldNames().front();
+    for (uint64_t recordIndex = 0; recordIndex < varSizedValues.size(); ++recordIndex)
+    {
+        nautilus::val<uint64_t> recordIndexVal(recordIndex);
+        const auto record = bufferRef->readRecord({fieldName}, inputRecordBuffer, recordIndexVal);
+        const auto varSizedValue = record.read(fieldName).cast<VariableSizedData>();
+        EXPECT_TRUE(varSizedValue.getBackingBuffer() == nautilus::val<TupleBuffer*>(&inputBuffer));
+        EXPECT_EQ(varSizedValue.getBackingAccess(), getAccess(inputBuffer, recordIndex).getCombinedIdxOffset());
+
+        /// Copies keep referring to the backing buffer
+        const auto copiedValue = varSizedValue; /// NOLINT(performance-unnecessary-copy-initialization)
+        EXPECT_TRUE(copiedValue.getBackingBuffer() == nautilus::val<TupleBuffer*>(&inputBuffer));
+    }
+
+    const VariableSizedData createdValue(nautilus::val<int8_t*>(varSizedValues.front().data()));
+    EXPECT_TRUE(createdValue.getBackingBuffer() == nautilus::val<TupleBuffer*>(nullptr));
+}
+
+/// Forwarding attaches the child buffer of the input buffer once and only rewrites the child index of the forwarded values
+TEST_F(TupleBufferRefTest, ForwardingAttachesChildBufferOfInput)
+{
+    auto varSizedValues = createVarSizedValues(5);
+    auto inputBuffer = createInputBuffer(varSizedValues);
+    auto outputBuffer = bufferManager->getBufferBlocking();
+    copyRecords(
+        RecordBuffer(nautilus::val<TupleBuffer*>(&inputBuffer)), RecordBuffer(nautilus::val<TupleBuffer*>(&outputBuffer)), true);
+
+    ASSERT_EQ(outputBuffer.getNumberOfChildBuffers(), 1);
+    EXPECT_EQ(
+        outputBuffer.loadChildBufferMemoryArea(VariableSizedAccess::Index(0)).data(),
+        inputBuffer.loadChildBufferMemoryArea(VariableSizedAccess::Index(0)).data());
+    for (uint64_t recordIndex = 0; recordIndex < varSizedValues.size(); ++recordIndex)
+    {
+        EXPECT_EQ(getAccess(outputBuffer, recordIndex).getOffset(), getAccess(inputBuffer, recordIndex).getOffset());
+        EXPECT_TRUE(storesValue(outputBuffer, recordIndex, varSizedValues[recordIndex]));
+    }
+}
+
+/// Without a forwarding buffer, the values are copied into child buffers of the output buffer
+TEST_F(TupleBufferRefTest, ValuesAreCopiedWithoutForwarding)
+{
+    auto varSizedValues = createVarSizedValues(5);
+    auto inputBuffer = createInputBuffer(varSizedValues);
+    auto outputBuffer = bufferManager->getBufferBlocking();
+    copyRecords(
+        RecordBuffer(nautilus::val<TupleBuffer*>(&inputBuffer)), RecordBuffer(nautilus::val<TupleBuffer*>(&outputBuffer)), false);
+
+    ASSERT_EQ(outputBuffer.getNumberOfChildBuffers(), 1);
+    EXPECT_NE(
+        outputBuffer.loadChildBufferMemoryArea(VariableSizedAccess::Index(0)).data(),
+        inputBuffer.loadChildBufferMemoryArea(VariableSizedAccess::Index(0)).data());
+    for (uint64_t recordIndex = 0; recordIndex < varSizedValues.size(); ++recordIndex)
+    {
+        EXPECT_TRUE(storesValue(outputBuffer, recordIndex, varSizedValues[recordIndex]));
+    }
+}
+
+/// The output buffer holds a reference to the attached child buffer, thus, forwarded values outlive the input buffer
+TEST_F(TupleBufferRefTest, ForwardedChildBufferOutlivesInput)
+{
+    auto varSizedValues = createVarSizedValues(5);
+    auto inputBuffer = createInputBuffer(varSizedValues);
+    auto outputBuffer = bufferManager->getBufferBlocking();
+    copyRecords(
+        RecordBuffer(nautilus::val<TupleBuffer*>(&inputBuffer)), RecordBuffer(nautilus::val<TupleBuffer*>(&outputBuffer)), true);
+
+    /// The input buffer, the output buffer, and the loaded child buffer itself refer to the child buffer
+    EXPECT_EQ(outputBuffer.loadChildBuffer(VariableSizedAccess::Index(0)).getReferenceCounter(), 3);
+    inputBuffer.release();
+    EXPECT_EQ(outputBuffer.loadChildBuffer(VariableSizedAccess::Index(0)).getReferenceCounter(), 2);
+    for (uint64_t recordIndex = 0; recordIndex < varSizedValues.size(); ++recordIndex)
+    {
+        EXPECT_TRUE(storesValue(outputBuffer, recordIndex, varSizedValues[recordIndex]));
+    }
+}
+
+}
@@ -76,6 +76,11 @@ namespace NES
  * Given that logical source car has two physical sources: i.e. car1 and car2 and
  * logical source truck has two physical sources: i.e. truck1 and truck2
  *
+ * Note: if all physical sources of a logical source are file sources that opted in via their 'grouped' parameter and share their
+ * parser config, we replace them by a single grouped source descriptor. It interleaves its files round-robin at tuple boundaries
+ * behind a single source operator and origin. Thus, the size of the plan, the number of source threads, and the time to optimize
+ * and start the query no longer grow with the number of physical sources.
+ *
  */
 class LogicalSourceExpansionRule
 {
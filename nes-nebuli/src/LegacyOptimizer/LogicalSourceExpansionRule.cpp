@@ -22,6 +22,7 @@
 #include <Operators/Sources/SourceNameLogicalOperator.hpp>
 #include <Operators/UnionLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
+#include <Util/Logger/Logger.hpp>
 #include <Util/PlanRenderer.hpp>
 #include <ErrorHandling.hpp>
 
@@ -50,9 +51,16 @@ void LogicalSourceExpansionRule::apply(LogicalPlan& queryPlan) const
             throw UnknownSourceName("No physical sources present for logical source \"{}\"", sourceOp->getLogicalSourceName());
         }
 
-        auto expandedSourceOperators = entries
-            | std::views::transform([](const auto& entry) { return LogicalOperator{SourceDescriptorLogicalOperator{entry}}; })
-            | std::ranges::to<std::vector>();
+        auto expandedSourceOperators = [&]
+        {
+            if (const auto groupedSource = sourceCatalog->getGroupedPhysicalSource(logicalSource))
+            {
+                return std::vector{LogicalOperator{SourceDescriptorLogicalOperator{groupedSource.value()}}};
+            }
+            return entries
+                | std::views::transform([](const auto& entry) { return LogicalOperator{SourceDescriptorLogicalOperator{entry}}; })
+                | std::ranges::to<std::vector>();
+        }();
 
         INVARIANT(getParents(queryPlan, sourceOp).size() == 1, "Source name operator must have exactly one parent");
         auto parent = getParents(queryPlan, sourceOp).front();
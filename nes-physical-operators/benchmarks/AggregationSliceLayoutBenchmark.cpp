@@ -0,0 +1,223 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include <Aggregation/AggregationOperatorHandler.hpp>
+#include <Aggregation/AggregationSlice.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <benchmark/benchmark.h>
+
+/// This benchmark compares the per-worker layout and the shared layout of an AggregationSlice for a keyed SUM/COUNT/MIN/MAX aggregation
+/// depending on the number of worker threads and the number of distinct keys. Each iteration aggregates all records into the hashmaps of
+/// a single slice and combines them into one hashmap, as the trigger and the probe do. The compiled build operator performs the same
+/// hashmap operations, but this benchmark calls the ChainedHashMap directly, so that it does not depend on the query compiler.
+namespace
+{
+constexpr uint64_t NUMBER_OF_RECORDS = 1 << 22;
+constexpr uint64_t NUMBER_OF_BUCKETS = 1 << 16;
+constexpr uint64_t PAGE_SIZE = 4096;
+
+struct AggregationStates
+{
+    uint64_t sum;
+    uint64_t count;
+    uint64_t min;
+    uint64_t max;
+};
+
+constexpr uint64_t KEY_SIZE = sizeof(uint64_t);
+constexpr uint64_t VALUE_SIZE = sizeof(AggregationStates);
+
+uint64_t hashKey(const uint64_t key)
+{
+    /// Finalizer of MurMur3, which spreads the key over the upper bits that choose the partition and the tag
+    auto hash = key;
+    hash ^= hash >> 33U;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33U;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33U;
+    return hash;
+}
+
+uint64_t* getKey(NES::ChainedHashMapEntry* entry)
+{
+    return reinterpret_cast<uint64_t*>(reinterpret_cast<int8_t*>(entry) + sizeof(NES::ChainedHashMapEntry));
+}
+
+AggregationStates* getStates(NES::ChainedHashMapEntry* entry)
+{
+    return reinterpret_cast<AggregationStates*>(reinterpret_cast<int8_t*>(entry) + sizeof(NES::ChainedHashMapEntry) + KEY_SIZE);
+}
+
+/// Returns the entry of the key and creates it with reset aggregation states, if it does not exist
+AggregationStates* findOrCreateEntry(NES::ChainedHashMap& hashMap, const uint64_t key, NES::AbstractBufferProvider* bufferProvider)
+{
+    const auto hash = hashKey(key);
+    for (auto* entry = hashMap.findChain(hash); entry != nullptr; entry = entry->next)
+    {
+        if (entry->hash == hash and *getKey(entry) == key)
+        {
+            return getStates(entry);
+        }
+    }
+    auto* const entry = static_cast<NES::ChainedHashMapEntry*>(hashMap.insertEntry(hash, bufferProvider));
+    *getKey(entry) = key;
+    auto* const states = getStates(entry);
+    *states = AggregationStates{
+        .sum = 0, .count = 0, .min = std::numeric_limits<uint64_t>::max(), .max = std::numeric_limits<uint64_t>::min()};
+    return states;
+}
+
+void lift(AggregationStates& states, const uint64_t value)
+{
+    states.sum += value;
+    ++states.count;
+    states.min = std::min(states.min, value);
+    states.max = std::max(states.max, value);
+}
+
+void combine(AggregationStates& states, const AggregationStates& other)
+{
+    states.sum += other.sum;
+    states.count += other.count;
+    states.min = std::min(states.min, other.min);
+    states.max = std::max(states.max, other.max);
+}
+
+/// Combines all hashmaps of a slice into a single one, as the aggregation probe does. Returns the number of combined entries.
+uint64_t combineHashMaps(const std::vector<std::unique_ptr<NES::ChainedHashMap>>& hashMaps, NES::AbstractBufferProvider* bufferProvider)
+{
+    NES::ChainedHashMap finalHashMap(KEY_SIZE, VALUE_SIZE, NUMBER_OF_BUCKETS, PAGE_SIZE);
+    uint64_t numberOfCombinedEntries = 0;
+    for (const auto& hashMap : hashMaps)
+    {
+        if (hashMap->getNumberOfTuples() == 0)
+        {
+            continue;
+        }
+        for (uint64_t chainIdx = 0; chainIdx < hashMap->getNumberOfChains(); ++chainIdx)
+        {
+            for (auto* entry = hashMap->getStartOfChain(chainIdx); entry != nullptr; entry = entry->next)
+            {
+                combine(*findOrCreateEntry(finalHashMap, *getKey(entry), bufferProvider), *getStates(entry));
+                ++numberOfCombinedEntries;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(finalHashMap.getNumberOfTuples());
+    return numberOfCombinedEntries;
+}
+
+std::vector<uint64_t> createKeys(const uint64_t numberOfKeys)
+{
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<uint64_t> distribution(0, numberOfKeys - 1);
+    std::vector<uint64_t> keys(NUMBER_OF_RECORDS);
+    std::ranges::generate(keys, [&] { return distribution(generator); });
+    return keys;
+}
+
+/// Runs the function for each worker thread on its share of the records
+template <typename Function>
+void runWorkerThreads(const uint64_t numberOfWorkerThreads, Function function)
+{
+    std::vector<std::jthread> workerThreads;
+    for (uint64_t workerThread = 0; workerThread < numberOfWorkerThreads; ++workerThread)
+    {
+        const auto begin = workerThread * NUMBER_OF_RECORDS / numberOfWorkerThreads;
+        const auto end = (workerThread + 1) * NUMBER_OF_RECORDS / numberOfWorkerThreads;
+        workerThreads.emplace_back([&function, workerThread, begin, end] { function(workerThread, begin, end); });
+    }
+}
+}
+
+static void BM_PerWorkerSlice(benchmark::State& state)
+{
+    const auto numberOfWorkerThreads = static_cast<uint64_t>(state.range(0));
+    const auto keys = createKeys(static_cast<uint64_t>(state.range(1)));
+    const auto bufferManager = NES::BufferManager::create();
+
+    uint64_t numberOfCombinedEntries = 0;
+    for (auto _ : state)
+    {
+        std::vector<std::unique_ptr<NES::ChainedHashMap>> hashMaps;
+        for (uint64_t workerThread = 0; workerThread < numberOfWorkerThreads; ++workerThread)
+        {
+            hashMaps.emplace_back(std::make_unique<NES::ChainedHashMap>(KEY_SIZE, VALUE_SIZE, NUMBER_OF_BUCKETS, PAGE_SIZE));
+        }
+        runWorkerThreads(
+            numberOfWorkerThreads,
+            [&](const uint64_t workerThread, const uint64_t begin, const uint64_t end)
+            {
+                auto& hashMap = *hashMaps[workerThread];
+                for (uint64_t record = begin; record < end; ++record)
+                {
+                    lift(*findOrCreateEntry(hashMap, keys[record], bufferManager.get()), record);
+                }
+            });
+        numberOfCombinedEntries = combineHashMaps(hashMaps, bufferManager.get());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUMBER_OF_RECORDS));
+    state.counters["combinedEntries"] = static_cast<double>(numberOfCombinedEntries);
+}
+
+static void BM_SharedSlice(benchmark::State& state)
+{
+    const auto numberOfWorkerThreads = static_cast<uint64_t>(state.range(0));
+    const auto keys = createKeys(static_cast<uint64_t>(state.range(1)));
+    const auto bufferManager = NES::BufferManager::create();
+    const auto numberOfPartitions = numberOfWorkerThreads * NES::AggregationOperatorHandler::NUMBER_OF_SHARED_PARTITIONS_PER_WORKER_THREAD;
+
+    uint64_t numberOfCombinedEntries = 0;
+    for (auto _ : state)
+    {
+        std::vector<std::unique_ptr<NES::ChainedHashMap>> hashMaps;
+        for (uint64_t partition = 0; partition < numberOfPartitions; ++partition)
+        {
+            hashMaps.emplace_back(std::make_unique<NES::ChainedHashMap>(KEY_SIZE, VALUE_SIZE, NUMBER_OF_BUCKETS, PAGE_SIZE));
+        }
+        std::vector<NES::SharedHashMapPartition> partitions(numberOfPartitions);
+        runWorkerThreads(
+            numberOfWorkerThreads,
+            [&](const uint64_t, const uint64_t begin, const uint64_t end)
+            {
+                for (uint64_t record = begin; record < end; ++record)
+                {
+                    /// Same choice of the partition as in AggregationSlice::lockSharedPartition()
+                    const auto partition = (hashKey(keys[record]) >> 32) % numberOfPartitions;
+                    const std::scoped_lock lock(partitions[partition].mutex);
+                    lift(*findOrCreateEntry(*hashMaps[partition], keys[record], bufferManager.get()), record);
+                }
+            });
+        numberOfCombinedEntries = combineHashMaps(hashMaps, bufferManager.get());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUMBER_OF_RECORDS));
+    state.counters["combinedEntries"] = static_cast<double>(numberOfCombinedEntries);
+}
+
+/// Register the function as a benchmark. The arguments are the number of worker threads and the number of distinct keys.
+BENCHMARK(BM_PerWorkerSlice)->ArgsProduct({{1, 2, 4, 8, 16, 32, 64}, {1 << 10, 1 << 20}})->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SharedSlice)->ArgsProduct({{1, 2, 4, 8, 16, 32, 64}, {1 << 10, 1 << 20}})->UseRealTime()->Unit(benchmark::kMillisecond);
+/// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include <Functions/ConcatPhysicalFunction.hpp>
+#include <Functions/FieldAccessPhysicalFunction.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <benchmark/benchmark.h>
+#include <Arena.hpp>
+#include <val.hpp>
+
+namespace
+{
+/// Number of records that are projected per pipeline invocation, i.e., per arena
+constexpr size_t NUMBER_OF_RECORDS_PER_INVOCATION = 1024;
+
+/// Returns the given string in the memory layout of a variable sized data, i.e., the size followed by the content
+std::vector<int8_t> toVariableSizedData(const std::string& content)
+{
+    const auto size = static_cast<uint32_t>(content.size());
+    std::vector<int8_t> memory(sizeof(uint32_t) + content.size());
+    std::memcpy(memory.data(), &size, sizeof(uint32_t));
+    std::memcpy(memory.data() + sizeof(uint32_t), content.data(), content.size());
+    return memory;
+}
+}
+
+/// This Benchmark measures a string building projection, i.e., CONCAT(CONCAT(...CONCAT(f0, f1)..., fn-1), fn), depending on the number
+/// of concatenated fields. Every iteration mimics one pipeline invocation that projects NUMBER_OF_RECORDS_PER_INVOCATION records with a
+/// new arena.
+static void BM_ConcatFields(benchmark::State& state)
+{
+    const auto numberOfFields = static_cast<size_t>(state.range(0));
+    const auto bufferManager = NES::BufferManager::create(4096, 128);
+
+    std::vector<std::vector<int8_t>> fieldValues;
+    NES::Record record;
+    for (size_t fieldIndex = 0; fieldIndex < numberOfFields; ++fieldIndex)
+    {
+        fieldValues.emplace_back(toVariableSizedData("value-of-field-" + std::to_string(fieldIndex)));
+        record.write("f" + std::to_string(fieldIndex), NES::VariableSizedData(nautilus::val<int8_t*>(fieldValues.back().data())));
+    }
+
+    NES::PhysicalFunction concatFunction = NES::FieldAccessPhysicalFunction("f0");
+    for (size_t fieldIndex = 1; fieldIndex < numberOfFields; ++fieldIndex)
+    {
+        concatFunction = NES::ConcatPhysicalFunction(concatFunction, NES::FieldAccessPhysicalFunction("f" + std::to_string(fieldIndex)));
+    }
+
+    for (auto _ : state)
+    {
+        NES::Arena arena(bufferManager);
+        NES::ArenaRef arenaRef(nautilus::val<NES::Arena*>(&arena));
+        for (size_t recordIndex = 0; recordIndex < NUMBER_OF_RECORDS_PER_INVOCATION; ++recordIndex)
+        {
+            benchmark::DoNotOptimize(concatFunction.execute(record, arenaRef));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NUMBER_OF_RECORDS_PER_INVOCATION));
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_ConcatFields)->DenseRange(2, 8, 2);
+/// Run the benchmark
+BENCHMARK_MAIN();
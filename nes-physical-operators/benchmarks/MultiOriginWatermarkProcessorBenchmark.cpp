@@ -0,0 +1,72 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <Time/Timestamp.hpp>
+#include <Watermark/MultiOriginWatermarkProcessor.hpp>
+#include <benchmark/benchmark.h>
+
+/// This Benchmark measures the cost of a single watermark update in the MultiOriginWatermarkProcessor depending on the number of origins.
+/// Every buffer of a window build or probe performs exactly one update. The origins are updated round-robin, which is the worst case for
+/// the minimum computation, as every update advances the origin with the current minimum watermark.
+static void BM_UpdateWatermarkRoundRobin(benchmark::State& state)
+{
+    const auto numberOfOrigins = static_cast<uint64_t>(state.range(0));
+    const auto origins = std::views::iota(NES::OriginId::INITIAL, NES::OriginId::INITIAL + numberOfOrigins)
+        | std::views::transform([](const uint64_t rawOrigin) { return NES::OriginId(rawOrigin); }) | std::ranges::to<std::vector>();
+    const NES::MultiOriginWatermarkProcessor watermarkProcessor(origins);
+
+    uint64_t sequenceNumber = NES::SequenceNumber::INITIAL;
+    size_t originIndex = 0;
+    for (auto _ : state)
+    {
+        const NES::SequenceData sequenceData{NES::SequenceNumber(sequenceNumber), NES::ChunkNumber(NES::ChunkNumber::INITIAL), true};
+        benchmark::DoNotOptimize(watermarkProcessor.updateWatermark(NES::Timestamp(sequenceNumber), sequenceData, origins[originIndex]));
+        if (++originIndex == numberOfOrigins)
+        {
+            originIndex = 0;
+            ++sequenceNumber;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+/// Only a single origin advances, all others stay at their initial watermark. Thus, the minimum never changes.
+static void BM_UpdateWatermarkSingleOrigin(benchmark::State& state)
+{
+    const auto numberOfOrigins = static_cast<uint64_t>(state.range(0));
+    const auto origins = std::views::iota(NES::OriginId::INITIAL, NES::OriginId::INITIAL + numberOfOrigins)
+        | std::views::transform([](const uint64_t rawOrigin) { return NES::OriginId(rawOrigin); }) | std::ranges::to<std::vector>();
+    const NES::MultiOriginWatermarkProcessor watermarkProcessor(origins);
+
+    uint64_t sequenceNumber = NES::SequenceNumber::INITIAL;
+    for (auto _ : state)
+    {
+        const NES::SequenceData sequenceData{NES::SequenceNumber(sequenceNumber), NES::ChunkNumber(NES::ChunkNumber::INITIAL), true};
+        benchmark::DoNotOptimize(watermarkProcessor.updateWatermark(NES::Timestamp(sequenceNumber), sequenceData, origins.back()));
+        ++sequenceNumber;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+/// Register the function as a benchmark
+BENCHMARK(BM_UpdateWatermarkRoundRobin)->RangeMultiplier(4)->Range(1, 1024);
+BENCHMARK(BM_UpdateWatermarkSingleOrigin)->RangeMultiplier(4)->Range(1, 1024);
+/// Run the benchmark
+BENCHMARK_MAIN();
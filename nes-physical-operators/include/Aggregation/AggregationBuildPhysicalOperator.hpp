@@ -15,18 +15,24 @@
 #pragma once
 
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <Aggregation/AggregationOperatorHandler.hpp>
+#include <Aggregation/AggregationSlice.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Time/Timestamp.hpp>
+#include <Util/AggregationSliceLayout.hpp>
 #include <Watermark/TimeFunction.hpp>
+#include <Arena.hpp>
 #include <CompilationContext.hpp>
 #include <HashMapOptions.hpp>
 #include <WindowBuildPhysicalOperator.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -36,6 +42,12 @@ HashMap* getAggHashMapProxy(
     Timestamp timestamp,
     WorkerThreadId workerThreadId,
     const AggregationBuildPhysicalOperator* buildOperator);
+HashMap* lockSharedAggHashMapPartitionProxy(
+    const AggregationOperatorHandler* operatorHandler,
+    Timestamp timestamp,
+    uint64_t keyHash,
+    Arena* arena,
+    const AggregationBuildPhysicalOperator* buildOperator);
 
 class AggregationBuildPhysicalOperator final : public WindowBuildPhysicalOperator
 {
@@ -45,19 +57,31 @@ public:
         Timestamp timestamp,
         WorkerThreadId workerThreadId,
         const AggregationBuildPhysicalOperator* buildOperator);
+    friend HashMap* lockSharedAggHashMapPartitionProxy(
+        const AggregationOperatorHandler* operatorHandler,
+        Timestamp timestamp,
+        uint64_t keyHash,
+        Arena* arena,
+        const AggregationBuildPhysicalOperator* buildOperator);
 
     AggregationBuildPhysicalOperator(
         OperatorHandlerId operatorHandlerId,
         std::unique_ptr<TimeFunction> timeFunction,
         std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationFunctions,
-        HashMapOptions hashMapOptions);
+        HashMapOptions hashMapOptions,
+        AggregationSliceLayout sliceLayout = AggregationSliceLayout::PER_WORKER);
     void setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const override;
     void execute(ExecutionContext& ctx, Record& record) const override;
 
 private:
+    /// Creates the entry for the keys of the record, if it does not exist, and lifts the record into its aggregation states
+    void updateAggregationStates(
+        ExecutionContext& ctx, Record& record, const HashFunction::HashValue& keyHash, const nautilus::val<HashMap*>& hashMapPtr) const;
+
     /// The aggregation function is a shared_ptr, because it is used in the aggregation build and in the getSliceCleanupFunction()
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions;
     HashMapOptions hashMapOptions;
+    AggregationSliceLayout sliceLayout;
 };
 
 }
@@ -14,7 +14,9 @@
 
 #pragma once
 #include <algorithm>
+#include <atomic>
 #include <bit>
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <map>
@@ -26,7 +28,8 @@
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
-#include <Util/RollingAverage.hpp>
+#include <Util/AggregationSliceLayout.hpp>
+#include <HashMapSizeTuner.hpp>
 #include <HashMapSlice.hpp>
 #include <WindowBasedOperatorHandler.hpp>
 
@@ -54,18 +57,55 @@ struct EmittedAggregationWindow
     HashMap** hashMaps; /// Pointer to the stored pointers of all hash maps that the probe should combine
 };
 
+/// This struct models the trigger of all aggregation windows that share a sequence number, i.e., that have become ready at once.
+/// It is followed by the pointers to all windows and then by the EmittedAggregationWindows themselves. Thus, a single probe task combines
+/// the windows in the order of their window end and appends their results to the same output buffers.
+struct EmittedAggregationWindows
+{
+    explicit EmittedAggregationWindows(const uint64_t numberOfWindows)
+        : numberOfWindows(numberOfWindows), windows(std::bit_cast<EmittedAggregationWindow**>(this + 1))
+    {
+    }
+
+    uint64_t numberOfWindows;
+    EmittedAggregationWindow** windows; /// Pointer to the stored pointers of all windows that the probe should emit
+};
+
+/// Configures when an aggregation emits provisional results for windows that have not been triggered yet, e.g., for long windows.
+/// A provisional result combines all slices of a window that do not receive tuples anymore, without consuming them. The final result of a
+/// window is still emitted once the watermark passes the window end. Provisional and final results share the same schema. Thus, the
+/// lowering solely enables early firing for aggregations, whose results flow into a sink without passing another stateful operator.
+struct EarlyFireTrigger
+{
+    /// Processing time between two provisional results. Zero disables this trigger.
+    std::chrono::milliseconds interval{0};
+    /// Number of input tuples between two provisional results. Zero disables this trigger.
+    uint64_t numberOfTuples{0};
+
+    [[nodiscard]] bool isEnabled() const { return interval.count() > 0 or numberOfTuples > 0; }
+};
+
 class AggregationOperatorHandler final : public WindowBasedOperatorHandler
 {
 public:
+    /// Number of shared hashmaps per worker thread of a slice with the shared layout. More partitions than worker threads make it less
+    /// likely that two worker threads wait for the same lock.
+    static constexpr uint64_t NUMBER_OF_SHARED_PARTITIONS_PER_WORKER_THREAD = 4;
+
     AggregationOperatorHandler(
         const std::vector<OriginId>& inputOrigins,
         OriginId outputOriginId,
         std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-        uint64_t maxNumberOfBuckets);
+        uint64_t maxNumberOfBuckets,
+        EarlyFireTrigger earlyFireTrigger = {},
+        AggregationSliceLayout sliceLayout = AggregationSliceLayout::PER_WORKER);
 
     [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
     getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const override;
 
+    /// Additionally to triggering windows, emits provisional results if the early fire trigger is due
+    void checkAndTriggerWindows(const BufferMetaData& bufferMetaData, PipelineExecutionContext* pipelineCtx) override;
+
     /// Is required to not perform the setup again and resolving a race condition to the cleanup state function
     std::atomic<bool> setupAlreadyCalled;
     /// shared_ptr as multiple slices need access to it
@@ -75,8 +115,33 @@ protected:
     void triggerSlices(
         const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
         PipelineExecutionContext* pipelineCtx) override;
-    folly::Synchronized<RollingAverage<uint64_t>> rollingAverageNumberOfKeys;
-    uint64_t maxNumberOfBuckets;
+    folly::Synchronized<HashMapSizeTuner> hashMapSizeTuner;
+
+private:
+    /// Stores the state of a single window until it is written to the buffer of its sequence number
+    struct WindowToEmit
+    {
+        WindowInfo windowInfo;
+        std::unique_ptr<HashMap> finalHashMap;
+        std::vector<HashMap*> hashMaps;
+    };
+
+    /// Collects the hash maps of all slices of a window
+    WindowToEmit collectWindow(const WindowInfo& windowInfo, const std::vector<std::shared_ptr<Slice>>& slices);
+
+    /// Emits one buffer containing all windows that share the sequence number to the probe
+    void emitWindows(SequenceNumber sequenceNumber, std::vector<WindowToEmit>& windows, PipelineExecutionContext* pipelineCtx) const;
+
+    /// Returns true for exactly one caller, once the early fire trigger is due
+    bool isEarlyFireDue(uint64_t numberOfTuples);
+
+    /// Recycles the hash maps of expired slices for new slices
+    std::shared_ptr<HashMapFreeList> hashMapFreeList = std::make_shared<HashMapFreeList>();
+
+    EarlyFireTrigger earlyFireTrigger;
+    AggregationSliceLayout sliceLayout;
+    std::atomic<uint64_t> numberOfTuplesSinceLastEarlyFire;
+    std::atomic<std::chrono::steady_clock::rep> lastEarlyFire;
 };
 
 }
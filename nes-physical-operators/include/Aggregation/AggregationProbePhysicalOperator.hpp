@@ -16,12 +16,14 @@
 
 #include <memory>
 #include <vector>
+#include <Aggregation/AggregationOperatorHandler.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Windowing/WindowMetaData.hpp>
 #include <HashMapOptions.hpp>
 #include <WindowProbePhysicalOperator.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
@@ -37,6 +39,9 @@ public:
     void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
 private:
+    /// Combines the hash maps of a single window and passes its results to the child
+    void probeWindow(ExecutionContext& executionCtx, const nautilus::val<EmittedAggregationWindow*>& aggregationWindowRef) const;
+
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationPhysicalFunctions;
     HashMapOptions hashMapOptions;
 };
@@ -15,27 +15,59 @@
 #pragma once
 
 #include <cstdint>
+#include <mutex>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <SliceStore/Slice.hpp>
+#include <Util/AggregationSliceLayout.hpp>
 #include <HashMapSlice.hpp>
 
 namespace NES
 {
 
+/// A hash map of a slice with the shared layout. All worker threads that update a group of this partition have to hold its lock.
+/// The hash map is owned by the slice and only referenced here.
+struct SharedHashMapPartition
+{
+    HashMap* hashMap{nullptr};
+    std::mutex mutex;
+};
+
+/// The hash map of a partition, whose lock is held until the lock gets destroyed or unlocked
+struct LockedSharedHashMapPartition
+{
+    HashMap* hashMap;
+    std::unique_lock<std::mutex> lock;
+};
+
 /// This class represents a single slice for the (keyed) aggregation. It stores the aggregation state in a hashmap.
 /// If it is a global/non-keyed aggregation, each hashmap contains a single entry for the keyValue = 0.
-/// In our current implementation, we have one hashmap per worker thread.
+/// With the per-worker layout, we have one hashmap per worker thread. With the shared layout, the groups are partitioned by their hash
+/// across the hashmaps and all worker threads update the same hashmaps under the lock of the partition. As the partitions are
+/// disjoint, the probe combines them in the same way as the hashmaps of the worker threads.
 class AggregationSlice final : public HashMapSlice
 {
 public:
     AggregationSlice(
-        SliceStart sliceStart, SliceEnd sliceEnd, const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs, uint64_t numberOfHashMaps);
+        SliceStart sliceStart,
+        SliceEnd sliceEnd,
+        const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs,
+        uint64_t numberOfHashMaps,
+        AggregationSliceLayout sliceLayout = AggregationSliceLayout::PER_WORKER);
 
     /// Returns the pointer to the underlying hashmap.
     /// IMPORTANT: This method should only be used for passing the hashmap to the nautilus executable.
     [[nodiscard]] HashMap* getHashMapPtr(WorkerThreadId workerThreadId) const;
     [[nodiscard]] HashMap* getHashMapPtrOrCreate(WorkerThreadId workerThreadId);
+
+    /// Locks the partition of the key hash and creates its hashmap, if it does not exist yet. Requires the shared layout.
+    /// The partition stays locked until the returned lock is released.
+    [[nodiscard]] LockedSharedHashMapPartition lockSharedPartition(uint64_t keyHash);
+
+private:
+    /// Empty for the per-worker layout, one partition per hashmap for the shared layout
+    std::vector<SharedHashMapPartition> sharedPartitions;
 };
 
 }
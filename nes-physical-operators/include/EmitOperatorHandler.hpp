@@ -24,6 +24,7 @@
 #include <Runtime/TupleBuffer.hpp>
 #include <Util/Logger/Formatter.hpp>
 #include <folly/Synchronized.h>
+#include <SelectivityStatistics.hpp>
 
 #ifndef NO_ASSERT
     #include <set>
@@ -64,6 +65,9 @@ public:
     void stop(QueryTerminationType terminationType, PipelineExecutionContext& pipelineExecutionContext) override;
 
     folly::Synchronized<std::map<SequenceNumberForOriginId, SequenceState>> sequenceStates;
+    /// Observed ratio of emitted to input records across all buffers and worker threads of the pipeline, which decides whether the emit
+    /// forwards variable sized values instead of copying them
+    SelectivityStatistics forwardingStatistics;
 
 #ifndef NO_ASSERT
     /// We assume that every tuple of (SequenceNumber, ChunkNumber, OriginId) is unique per query.
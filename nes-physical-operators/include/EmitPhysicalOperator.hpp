@@ -31,9 +31,14 @@ namespace NES
 
 /// @brief Basic emit operator that receives records from an upstream operator and
 /// writes them to a tuple buffer according to a memory layout.
+/// Variable sized values that are emitted unmodified from the input buffer are not copied. Instead, their child buffer gets attached to
+/// the result buffer. As an attached child buffer stays alive as long as the result buffer, this only pays off if most of the input
+/// records get emitted. Thus, the emit falls back to copying the values, if the observed selectivity of its pipeline is low.
 class EmitPhysicalOperator final : public PhysicalOperatorConcept
 {
 public:
+    static constexpr double MIN_SELECTIVITY_FOR_FORWARDING = 0.5;
+
     explicit EmitPhysicalOperator(OperatorHandlerId operatorHandlerId, std::shared_ptr<TupleBufferRef> bufferRef);
 
     void setup(ExecutionContext&, CompilationContext&) const override { /*noop*/ }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <vector>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/Interface/Record.hpp>
@@ -22,6 +23,9 @@
 namespace NES
 {
 
+/// Concatenates the variable sized results of its children.
+/// Nested concats, e.g., CONCAT(CONCAT(a, b), c), are folded into a single concat over all operands. Thus, the result is allocated once
+/// with its final size and every operand is copied exactly once, instead of materializing an intermediate result per nesting level.
 class ConcatPhysicalFunction final : public PhysicalFunctionConcept
 {
 public:
@@ -29,8 +33,7 @@ public:
     [[nodiscard]] VarVal execute(const Record& record, ArenaRef& arena) const override;
 
 private:
-    PhysicalFunction leftPhysicalFunction;
-    PhysicalFunction rightPhysicalFunction;
+    std::vector<PhysicalFunction> operandPhysicalFunctions;
 };
 
 }
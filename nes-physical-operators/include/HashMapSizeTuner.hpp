@@ -0,0 +1,55 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <Util/RollingAverage.hpp>
+
+namespace NES
+{
+
+/// Chooses the number of buckets for the hash maps of new slices from the hash maps of already triggered slices.
+/// The average chain length of a hash map is the ratio of its keys to its chains. Long chains make every lookup expensive, while short
+/// chains waste the memory of the chains and the time to initialize them for every new slice. As long as the hash maps stay within
+/// [MIN_AVERAGE_CHAIN_LENGTH, MAX_AVERAGE_CHAIN_LENGTH], we keep the number of buckets. Only if the average chain length leaves this
+/// range, we choose the average number of keys as the new number of buckets. This hysteresis prevents that a slightly varying number of
+/// keys changes the size of the hash map for every slice.
+/// IMPORTANT: This class is NOT thread-safe.
+class HashMapSizeTuner
+{
+public:
+    static constexpr double MIN_AVERAGE_CHAIN_LENGTH = 0.125;
+    static constexpr double MAX_AVERAGE_CHAIN_LENGTH = 2.0;
+    static constexpr uint64_t DEFAULT_NUMBER_OF_OBSERVED_HASH_MAPS = 100;
+
+    HashMapSizeTuner(uint64_t maxNumberOfBuckets, uint64_t numberOfObservedHashMaps);
+
+    /// Adds the statistics of a filled hash map that has been created with the passed number of buckets
+    void observe(uint64_t numberOfBucketsOfHashMap, uint64_t numberOfKeys, uint64_t numberOfChains);
+
+    /// Returns the number of buckets for a new hash map. Returns the configured number of buckets, if no hash map has been observed yet.
+    [[nodiscard]] uint64_t getNumberOfBuckets(uint64_t configuredNumberOfBuckets) const;
+
+private:
+    uint64_t maxNumberOfBuckets;
+    uint64_t numberOfObservedHashMaps;
+    RollingAverage<uint64_t> averageNumberOfKeys;
+    /// Solely contains hash maps that have been created with the currently chosen number of buckets
+    RollingAverage<double> averageChainLength;
+    std::optional<uint64_t> numberOfBuckets;
+};
+
+}
@@ -21,13 +21,35 @@
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <SliceStore/Slice.hpp>
+#include <folly/Synchronized.h>
 #include <Engine.hpp>
 
 namespace NES
 {
 
+/// Free-list of the hash maps of expired slices of an operator. Instead of destroying the hash maps of an expired slice and allocating
+/// new ones for the next slice, a HashMapSlice returns its hash maps to this free-list. They get reset, retaining their entry space and
+/// some of their pages, before they are stored. This avoids that high slice rates churn the allocator and page fault for every window.
+class HashMapFreeList
+{
+public:
+    /// Upper bounds for the memory that the free-list retains
+    static constexpr uint64_t MAX_NUMBER_OF_HASH_MAPS = 256;
+    static constexpr uint64_t MAX_NUMBER_OF_RETAINED_PAGES = 64;
+
+    /// Returns a reset hash map with the passed configuration or nullptr, if there is none
+    std::unique_ptr<ChainedHashMap> acquire(uint64_t keySize, uint64_t valueSize, uint64_t numberOfBuckets, uint64_t pageSize);
+
+    /// Resets the hash map and stores it, if the free-list is not full. Must not be called while holding a lock of the slice store.
+    void release(std::unique_ptr<HashMap> hashMap);
+
+private:
+    folly::Synchronized<std::vector<std::unique_ptr<ChainedHashMap>>> hashMaps;
+};
+
 struct CreateNewHashMapSliceArgs final : CreateNewSlicesArguments
 {
     using NautilusCleanupExec = nautilus::engine::CallableFunction<void, HashMap*>;
@@ -37,12 +59,14 @@ struct CreateNewHashMapSliceArgs final : CreateNewSlicesArguments
         const uint64_t keySize,
         const uint64_t valueSize,
         const uint64_t pageSize,
-        const uint64_t numberOfBuckets)
+        const uint64_t numberOfBuckets,
+        std::shared_ptr<HashMapFreeList> hashMapFreeList = nullptr)
         : nautilusCleanup(std::move(nautilusCleanup))
         , keySize(keySize)
         , valueSize(valueSize)
         , pageSize(pageSize)
         , numberOfBuckets(numberOfBuckets)
+        , hashMapFreeList(std::move(hashMapFreeList))
     {
     }
 
@@ -52,6 +76,8 @@ struct CreateNewHashMapSliceArgs final : CreateNewSlicesArguments
     uint64_t valueSize;
     uint64_t pageSize;
     uint64_t numberOfBuckets;
+    /// If set, the hash maps of a slice are taken from and returned to this free-list
+    std::shared_ptr<HashMapFreeList> hashMapFreeList;
 };
 
 /// A HashMapSlice stores a number of hashmaps per input stream. We assume that each input stream has the same number of hashmaps
@@ -79,7 +105,13 @@ public:
 
     [[nodiscard]] uint64_t getNumberOfTuples() const;
 
+    /// Returns the number of buckets that all hash maps of this slice have been created with
+    [[nodiscard]] uint64_t getNumberOfBuckets() const;
+
 protected:
+    /// Takes a hash map from the free-list or creates a new one
+    [[nodiscard]] std::unique_ptr<HashMap> createHashMap() const;
+
     std::vector<std::unique_ptr<HashMap>> hashMaps;
     CreateNewHashMapSliceArgs createNewHashMapSliceArgs;
     uint64_t numberOfHashMapsPerInputStream;
@@ -13,24 +13,31 @@
 */
 
 #pragma once
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/HashJoin/HJOperatorHandler.hpp>
+#include <Join/HashJoin/HJSlice.hpp>
 #include <Join/StreamJoinBuildPhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Time/Timestamp.hpp>
 #include <Watermark/TimeFunction.hpp>
+#include <Windowing/WindowMetaData.hpp>
 #include <CompilationContext.hpp>
 #include <ExecutionContext.hpp>
 #include <HashMapOptions.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
 class HJBuildPhysicalOperator;
+HJSlice* getHashJoinSliceProxy(const HJOperatorHandler* operatorHandler, Timestamp timestamp, const HJBuildPhysicalOperator* buildOperator);
 HashMap* getHashJoinHashMapProxy(
     const HJOperatorHandler* operatorHandler,
     Timestamp timestamp,
@@ -38,12 +45,29 @@ HashMap* getHashJoinHashMapProxy(
     JoinBuildSideType buildSide,
     const HJBuildPhysicalOperator* buildOperator);
 
+/// Stores what the build of the symmetric hash join requires for probing the hash maps of the other join side
+struct SymmetricHashJoinOptions
+{
+    std::shared_ptr<TupleBufferRef> otherSideBufferRef;
+    HashMapOptions otherSideHashMapOptions;
+    /// Stores the joined records in the buffers that are emitted to the probe
+    std::shared_ptr<TupleBufferRef> resultBufferRef;
+    WindowMetaData windowMetaData;
+};
+
 /// This class is the first phase of the join. For both streams (left and right), the tuples are stored in a hash map of a
 /// corresponding slice one after the other. Afterward, the second phase (HJProbe) will start joining the tuples by comparing the join keys
 /// via a hash function.
+/// For the symmetric hash join, the tuples of a buffer additionally get published at once in their slice and joined with all published
+/// tuples of the other side with the same keys. The joined records get emitted to the probe at the end of the buffer. Thus, the probe
+/// solely has to forward the joined records and no join work is left for the window trigger. As the slice must be equal to the window,
+/// this requires a tumbling window. As the published tuples get read while their pages get filled, this requires tuples without variable
+/// sized data.
 class HJBuildPhysicalOperator : public StreamJoinBuildPhysicalOperator
 {
 public:
+    friend HJSlice*
+    getHashJoinSliceProxy(const HJOperatorHandler* operatorHandler, Timestamp timestamp, const HJBuildPhysicalOperator* buildOperator);
     friend HashMap* getHashJoinHashMapProxy(
         const HJOperatorHandler* operatorHandler,
         Timestamp timestamp,
@@ -55,12 +79,23 @@ public:
         JoinBuildSideType joinBuildSide,
         std::unique_ptr<TimeFunction> timeFunction,
         const std::shared_ptr<TupleBufferRef>& bufferRef,
-        HashMapOptions hashMapOptions);
+        HashMapOptions hashMapOptions,
+        std::optional<SymmetricHashJoinOptions> symmetricHashJoinOptions = std::nullopt);
     void setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const override;
+    void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
     void execute(ExecutionContext& ctx, Record& record) const override;
+    void close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
 private:
+    /// Publishes the tuples that have been staged for the slice in the local state, joins them with the tuples of the other side that the
+    /// slice has collected for them, and writes the joined records into the result buffer
+    void publishAndJoinStagedTuples(ExecutionContext& ctx) const;
+    /// Writes the joined record into the result buffer and emits the result buffer to the probe, if it is full
+    void writeResultRecord(ExecutionContext& ctx, const Record& joinedRecord) const;
+    void emitResultBuffer(ExecutionContext& ctx) const;
+
     HashMapOptions hashMapOptions;
+    std::optional<SymmetricHashJoinOptions> symmetricHashJoinOptions;
 };
 
 }
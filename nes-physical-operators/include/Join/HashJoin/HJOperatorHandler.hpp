@@ -25,10 +25,11 @@
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
-#include <Util/RollingAverage.hpp>
+#include <HashMapSizeTuner.hpp>
 #include <HashMapSlice.hpp>
 
 namespace NES
@@ -66,7 +67,8 @@ public:
         const std::vector<OriginId>& inputOrigins,
         OriginId outputOriginId,
         std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-        uint64_t maxNumberOfBuckets);
+        uint64_t maxNumberOfBuckets,
+        bool symmetric = false);
 
     [[nodiscard]] std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
     getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const override;
@@ -76,6 +78,10 @@ public:
         std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> nautilusCleanupExec, const JoinBuildSideType& buildSide);
     [[nodiscard]] std::vector<std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec>> getNautilusCleanupExec() const;
 
+    /// Emits a buffer of joined records that the symmetric hash join has produced before their window gets triggered.
+    /// Each of these buffers gets its own sequence number of the output origin.
+    void emitEagerJoinResults(TupleBuffer& resultBuffer, PipelineExecutionContext* pipelineCtx) const;
+
 private:
     /// Is required to not perform the setup again and resolving a race condition to the cleanup state function
     std::atomic<bool> setupAlreadyCalledLeft;
@@ -83,6 +89,8 @@ private:
     /// shared_ptr as multiple slices need access to it
     std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> leftCleanupStateNautilusFunction;
     std::shared_ptr<CreateNewHashMapSliceArgs::NautilusCleanupExec> rightCleanupStateNautilusFunction;
+    /// Recycles the hash maps of expired slices for new slices
+    std::shared_ptr<HashMapFreeList> hashMapFreeList = std::make_shared<HashMapFreeList>();
 
 
     void emitSlicesToProbe(
@@ -92,8 +100,10 @@ private:
         const SequenceData& sequenceData,
         PipelineExecutionContext* pipelineCtx) override;
 
-    folly::Synchronized<RollingAverage<uint64_t>> rollingAverageNumberOfKeys;
-    uint64_t maxNumberOfBuckets;
+    folly::Synchronized<HashMapSizeTuner> hashMapSizeTuner;
+    /// The symmetric hash join has already emitted all joined records during the build. Thus, triggering a window solely informs the
+    /// probe, so that it can garbage collect the slices.
+    bool symmetric;
 };
 
 }
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <Functions/PhysicalFunction.hpp>
 #include <Join/StreamJoinProbePhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
@@ -40,15 +41,19 @@ public:
         std::shared_ptr<TupleBufferRef> leftBufferRef,
         std::shared_ptr<TupleBufferRef> rightBufferRef,
         HashMapOptions leftHashMapBasedOptions,
-        HashMapOptions rightHashMapBasedOptions);
+        HashMapOptions rightHashMapBasedOptions,
+        std::optional<std::shared_ptr<TupleBufferRef>> symmetricResultBufferRef = std::nullopt);
 
     /// As the second phase gets triggered by the first phase, we receive a tuple buffer containing all information for performing the probe.
     /// Thus, we start a new pipeline and therefore, we create new Records from the built-up state.
+    /// For the symmetric hash join, the build has already joined the records and we solely read them from the received tuple buffer.
     void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
 private:
     std::shared_ptr<TupleBufferRef> leftBufferRef, rightBufferRef;
     HashMapOptions leftHashMapOptions, rightHashMapOptions;
+    /// Set for the symmetric hash join, reads the joined records that the build has emitted
+    std::optional<std::shared_ptr<TupleBufferRef>> symmetricResultBufferRef;
 };
 
 }
@@ -14,10 +14,15 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <SliceStore/Slice.hpp>
 #include <HashMapSlice.hpp>
 
@@ -34,6 +39,48 @@ public:
     [[nodiscard]] HashMap* getHashMapPtr(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide) const;
     [[nodiscard]] HashMap* getHashMapPtrOrCreate(WorkerThreadId workerThreadId, const JoinBuildSideType& buildSide);
     [[nodiscard]] uint64_t getNumberOfHashMapsForSide() const;
+
+    /// Position of a tuple of the symmetric hash join on a page of the paged vector that stores it
+    struct SymmetricJoinTuple
+    {
+        TupleBuffer page;
+        uint64_t positionOnPage;
+    };
+
+    /// A staged tuple of the worker thread and a published tuple of the other side with the same hash
+    struct SymmetricJoinPair
+    {
+        const SymmetricJoinTuple* tuple;
+        const SymmetricJoinTuple* match;
+    };
+
+    /// Stages the tuple, so that it gets published together with all other tuples that the worker thread inserts while processing the
+    /// same buffer. Staging does not take any lock, as every worker thread has its own staged tuples.
+    void stageSymmetric(WorkerThreadId workerThreadId, uint64_t hash, SymmetricJoinTuple tuple);
+
+    /// Publishes the staged tuples of the worker thread for the other side and collects for each of them all published tuples of the
+    /// other side with the same hash. The lock of a partition is taken once for all staged tuples of the partition. Thus, every pair of
+    /// tuples with equal keys is collected exactly once, namely by the tuple that is published later. Returns the number of collected
+    /// pairs, which stay accessible via getSymmetricJoinPair() until the next call of the same worker thread.
+    uint64_t publishAndProbeSymmetric(WorkerThreadId workerThreadId, JoinBuildSideType buildSide);
+    [[nodiscard]] const SymmetricJoinPair& getSymmetricJoinPair(WorkerThreadId workerThreadId, uint64_t pairIndex) const;
+
+private:
+    /// Partitioning the published tuples by their hash lets workers that insert different keys publish and probe concurrently
+    static constexpr uint64_t NUMBER_OF_SYMMETRIC_JOIN_PARTITIONS = 16;
+    using SymmetricJoinTuples = std::unordered_multimap<uint64_t, SymmetricJoinTuple>;
+
+    struct SymmetricJoinPartition
+    {
+        std::mutex mutex;
+        std::array<SymmetricJoinTuples, 2> publishedTuplesPerSide;
+    };
+
+    std::array<SymmetricJoinPartition, NUMBER_OF_SYMMETRIC_JOIN_PARTITIONS> symmetricJoinPartitions;
+    /// The nodes of the staged tuples get allocated without holding a lock and publishing moves them into the published tuples.
+    /// Thus, pointers to the tuples stay valid until the slice gets destroyed.
+    std::vector<std::array<SymmetricJoinTuples, NUMBER_OF_SYMMETRIC_JOIN_PARTITIONS>> stagedTuplesPerWorkerThread;
+    std::vector<std::vector<SymmetricJoinPair>> symmetricJoinPairsPerWorkerThread;
 };
 
 }
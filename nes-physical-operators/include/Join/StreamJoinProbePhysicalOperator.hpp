@@ -38,6 +38,17 @@ public:
     StreamJoinProbePhysicalOperator(
         OperatorHandlerId operatorHandlerId, PhysicalFunction joinFunction, WindowMetaData windowMetaData, JoinSchema joinSchema);
 
+    /// Creates a joined record out of the outer and inner record for the window field names of the given window meta data.
+    /// Is also used by the build of the symmetric hash join, which joins the records before the window gets triggered.
+    static Record createJoinedRecord(
+        const WindowMetaData& windowMetaData,
+        const Record& outerRecord,
+        const Record& innerRecord,
+        const nautilus::val<Timestamp>& windowStart,
+        const nautilus::val<Timestamp>& windowEnd,
+        const std::vector<Record::RecordFieldIdentifier>& projectionsOuter,
+        const std::vector<Record::RecordFieldIdentifier>& projectionsInner);
+
 protected:
     /// Creates a joined record out of the outer and inner record
     Record createJoinedRecord(
@@ -16,6 +16,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <ostream>
@@ -34,6 +35,7 @@
 #include <CompilationContext.hpp>
 #include <ErrorHandling.hpp>
 #include <nameof.hpp>
+#include <val.hpp>
 
 namespace NES
 {
@@ -46,6 +48,19 @@ inline OperatorId getNextPhysicalOperatorId()
     return OperatorId(id++);
 }
 
+/// The records of a buffer, which an operator processes at once via executeOnRecords
+struct RecordBatch
+{
+    using RecordReader = std::function<Record(nautilus::val<uint64_t>& recordIndex)>;
+    using RecordConsumer = std::function<void(Record& record)>;
+
+    nautilus::val<uint64_t> numberOfRecords;
+    /// Reads the record at the index. Operators may read the records in any order and more than once.
+    RecordReader readRecord;
+    /// Passes all records in their order to the consumer, which is cheaper than reading each record via its index
+    std::function<void(const RecordConsumer& consumer)> forEachRecord;
+};
+
 /// Concept defining the interface for all physical operators in the query plan.
 /// Physical operators represent operations that are executed during query execution.
 /// TODO #875: Investigate C++20 Concepts to replace Operator/Function Inheritance
@@ -77,6 +92,15 @@ struct PhysicalOperatorConcept
     /// Executes the operator on the given record.
     virtual void execute(ExecutionContext& executionCtx, Record& record) const;
 
+    /// Executes the operator on all records of a batch, e.g., all records of the buffer that a scan reads.
+    /// By default, the operator executes each record on its own. Operators that profit from processing all records at once, e.g., a
+    /// selection that evaluates its predicate for blocks of records without branching, override this function.
+    virtual void executeOnRecords(ExecutionContext& executionCtx, const RecordBatch& records) const;
+
+    /// Returns true if the operator gathered runtime statistics, for which it specializes the code that it traces if its pipeline gets
+    /// recompiled. A pipeline is only recompiled if one of its operators has such a profile.
+    [[nodiscard]] virtual bool hasProfileForRecompilation() const;
+
     /// Unique identifier for this operator.
     const OperatorId id = INVALID_OPERATOR_ID;
 
@@ -86,6 +110,7 @@ protected:
     void openChild(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const;
     void closeChild(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const;
     void executeChild(ExecutionContext& executionCtx, Record& record) const;
+    void executeChildOnRecords(ExecutionContext& executionCtx, const RecordBatch& records) const;
     void terminateChild(ExecutionContext& executionCtx) const;
 };
 
@@ -123,6 +148,8 @@ struct PhysicalOperator
     void close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const;
     void terminate(ExecutionContext& executionCtx) const;
     void execute(ExecutionContext& executionCtx, Record& record) const;
+    void executeOnRecords(ExecutionContext& executionCtx, const RecordBatch& records) const;
+    [[nodiscard]] bool hasProfileForRecompilation() const;
     [[nodiscard]] std::string toString() const;
 
     [[nodiscard]] OperatorId getId() const;
@@ -199,6 +226,13 @@ private:
 
         void execute(ExecutionContext& executionCtx, Record& record) const override { data.execute(executionCtx, record); }
 
+        void executeOnRecords(ExecutionContext& executionCtx, const RecordBatch& records) const override
+        {
+            data.executeOnRecords(executionCtx, records);
+        }
+
+        [[nodiscard]] bool hasProfileForRecompilation() const override { return data.hasProfileForRecompilation(); }
+
         [[nodiscard]] std::string toString() const override { return fmt::format("PhysicalOperator({})", NAMEOF_TYPE(OperatorType)); }
     };
 
@@ -19,6 +19,7 @@
 #include <string>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Util/CompilationOptions.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <Util/Logger/Formatter.hpp>
 #include <PhysicalOperator.hpp>
@@ -39,18 +40,21 @@ public:
     [[nodiscard]] QueryId getQueryId() const;
     [[nodiscard]] const Roots& getRootOperators() const;
     [[nodiscard]] ExecutionMode getExecutionMode() const;
+    [[nodiscard]] CompilationOptions getCompilationOptions() const;
     [[nodiscard]] uint64_t getOperatorBufferSize() const;
 
 private:
     QueryId queryId;
     Roots rootOperators;
     ExecutionMode executionMode;
+    CompilationOptions compilationOptions;
     uint64_t operatorBufferSize;
 
     [[nodiscard]] std::string toString() const;
 
     friend class PhysicalPlanBuilder;
-    PhysicalPlan(QueryId id, Roots rootOperators, ExecutionMode executionMode, uint64_t operatorBufferSize);
+    PhysicalPlan(
+        QueryId id, Roots rootOperators, ExecutionMode executionMode, CompilationOptions compilationOptions, uint64_t operatorBufferSize);
 };
 }
 
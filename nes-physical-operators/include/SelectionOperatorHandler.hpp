@@ -0,0 +1,35 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <SelectivityStatistics.hpp>
+
+namespace NES
+{
+
+/// Holds the selectivity that an adaptive selection observes across all buffers and worker threads of its pipeline
+class SelectionOperatorHandler final : public OperatorHandler
+{
+public:
+    void start(PipelineExecutionContext& pipelineExecutionContext, uint32_t localStateVariableId) override;
+    void stop(QueryTerminationType terminationType, PipelineExecutionContext& pipelineExecutionContext) override;
+
+    SelectivityStatistics statistics;
+};
+
+}
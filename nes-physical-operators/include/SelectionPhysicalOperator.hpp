@@ -13,27 +13,73 @@
 */
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <utility>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Util/SelectionStrategy.hpp>
+#include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
+#include <SelectionOperatorHandler.hpp>
+#include <SelectivityStatistics.hpp>
+#include <val.hpp>
 
 namespace NES
 {
 
 /// @brief Selection operator that evaluates a boolean function on each record.
+/// If the selection receives all records of a buffer at once via executeOnRecords and does not use the branching strategy, it evaluates the
+/// predicate for blocks of records into a selection vector without branching and executes the child only for selected records. This avoids
+/// branch mispredictions for selectivities that are neither low nor high.
 class SelectionPhysicalOperator final : public PhysicalOperatorConcept
 {
 public:
-    explicit SelectionPhysicalOperator(PhysicalFunction function) : function(std::move(function)) { };
+    /// Number of records whose predicate gets evaluated before the child is executed on the selected records
+    static constexpr uint64_t SELECTION_VECTOR_SIZE = 1024;
+    /// The branching evaluation is cheaper if the branch predictor can guess the outcome of the predicate for most records
+    static constexpr double MIN_SELECTIVITY_FOR_PREDICATION = 0.1;
+    static constexpr double MAX_SELECTIVITY_FOR_PREDICATION = 0.9;
+    /// Number of observed records, after which a recompilation of the pipeline only contains the variant of the adaptive strategy that
+    /// fits the observed selectivity
+    static constexpr uint64_t MIN_NUMBER_OF_RECORDS_FOR_SPECIALIZATION = 64 * SELECTION_VECTOR_SIZE;
+
+    /// Creates a selection with a strategy that does not depend on the observed selectivity, i.e., the branching or the predicated strategy
+    explicit SelectionPhysicalOperator(PhysicalFunction function, SelectionStrategy strategy = SelectionStrategy::BRANCHING);
+    /// Creates a selection with the adaptive strategy, which observes the selectivity in the operator handler.
+    /// If specializeForProfile is set, the selection specializes the traced code for the observed selectivity, once it has observed enough
+    /// records. It must only be set if the pipeline gets recompiled with the profile, as the specialized code no longer adapts.
+    SelectionPhysicalOperator(
+        PhysicalFunction function,
+        OperatorHandlerId operatorHandlerId,
+        std::shared_ptr<SelectionOperatorHandler> operatorHandler,
+        bool specializeForProfile);
+
     void execute(ExecutionContext& ctx, Record& record) const override;
+    void executeOnRecords(ExecutionContext& ctx, const RecordBatch& records) const override;
 
+    [[nodiscard]] bool hasProfileForRecompilation() const override;
+    /// Number of records whose selectivity the adaptive strategy observed
+    [[nodiscard]] uint64_t getNumberOfObservedRecords() const;
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
 
+    /// Whether the predicated variant fits the observed selectivity better than the branching variant
+    static bool shouldUsePredication(const SelectivityStatistics& statistics);
+
 private:
+    nautilus::val<uint64_t> executeBranching(ExecutionContext& ctx, const RecordBatch& records) const;
+    nautilus::val<uint64_t> executePredicated(ExecutionContext& ctx, const RecordBatch& records) const;
+
     const PhysicalFunction function;
+    SelectionStrategy strategy;
+    OperatorHandlerId operatorHandlerId = INVALID_OPERATOR_HANDLER_ID;
+    /// The traced code accesses the handler via the execution context. The selection solely reads the statistics directly to decide which
+    /// variant it traces, if it specializes for the profile.
+    std::shared_ptr<SelectionOperatorHandler> operatorHandler;
+    bool specializeForProfile = false;
     std::optional<PhysicalOperator> child;
 };
 }
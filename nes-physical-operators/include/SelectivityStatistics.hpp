@@ -0,0 +1,46 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+namespace NES
+{
+
+/// Ratio of the selected records to all observed records across the buffers of a pipeline, e.g., of the records that pass a selection.
+/// The ratio might exceed one, e.g., if an emit observes more result records than input records of a join.
+/// Both counters share a single atomic word. Thus, concurrent updates of multiple worker threads are neither lost nor mixed up.
+class SelectivityStatistics
+{
+public:
+    /// Both counters get halved once one of them exceeds this number, which lets the selectivity follow changes in the data
+    static constexpr uint64_t MAX_NUMBER_OF_OBSERVED_RECORDS = 1UL << 20;
+
+    void addObservation(uint64_t numberOfRecords, uint64_t numberOfSelectedRecords);
+    [[nodiscard]] uint64_t getNumberOfObservedRecords() const;
+    /// Returns nullopt, if no records have been observed yet
+    [[nodiscard]] std::optional<double> getSelectivity() const;
+
+private:
+    static constexpr uint64_t COUNTER_BITS = 32;
+    static constexpr uint64_t COUNTER_MASK = (1UL << COUNTER_BITS) - 1;
+
+    /// Number of observed records in the upper and number of selected records in the lower 32 bits
+    std::atomic<uint64_t> counters{0};
+};
+
+}
@@ -47,14 +47,21 @@ struct SlicesAndState
 class DefaultTimeBasedSliceStore final : public WindowSlicesStoreInterface
 {
 public:
-    DefaultTimeBasedSliceStore(uint64_t windowSize, uint64_t windowSlide);
+    /// @param maxWindowsPerSequenceNumber: Number of consecutive windows that get triggered at once and share a sequence number.
+    /// Sharing a sequence number allows the probe to process these windows in a single task.
+    /// @param maxSliceSize: If larger than zero, slices do not span more than maxSliceSize, see SliceAssigner
+    DefaultTimeBasedSliceStore(
+        uint64_t windowSize, uint64_t windowSlide, uint64_t maxWindowsPerSequenceNumber = 1, uint64_t maxSliceSize = 0);
 
     ~DefaultTimeBasedSliceStore() override;
     std::vector<std::shared_ptr<Slice>> getSlicesOrCreate(
         Timestamp timestamp, const std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>& createNewSlice) override;
     std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
     getTriggerableWindowSlices(Timestamp globalWatermark) override;
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+    getProvisionalWindowSlices(Timestamp globalWatermark) override;
     std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getAllNonTriggeredSlices() override;
+    SequenceNumberAndWatermark getNextSequenceNumberAndWatermark(const std::function<Timestamp()>& readWatermark) override;
     std::optional<std::shared_ptr<Slice>> getSliceBySliceEnd(SliceEnd sliceEnd) override;
     void garbageCollectSlicesAndWindows(Timestamp newGlobalWaterMark) override;
     void deleteState() override;
@@ -71,6 +78,11 @@ private:
     /// We need to store the sequence number for the triggerable window infos. This is necessary, as we have to ensure that the sequence number is unique
     /// and increases for each window info.
     std::atomic<SequenceNumber::Underlying> sequenceNumber;
+    uint64_t maxWindowsPerSequenceNumber;
+
+    /// Returns the sequence number for the next window that gets triggered in the current call.
+    /// Hands out a new sequence number after maxWindowsPerSequenceNumber windows. Must be called while holding the windows lock.
+    SequenceNumber getSequenceNumberForNextWindow(uint64_t& numberOfWindowsWithCurrentSequenceNumber);
 
     /// If a window build operator appears in multiple pipelines, it may get terminated multiple times
     /// We need to track how many input pipelines have not terminated yet, to only release pending slices after the last termination
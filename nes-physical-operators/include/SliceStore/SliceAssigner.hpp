@@ -27,10 +27,15 @@ namespace NES
 /// @brief The SliceAssigner assigner determines the start and end timestamp of a slice for
 /// a specific window definition, that consists of a window size and a window slide.
 /// @note Tumbling windows are in general modeled at this point as sliding windows with the size is equals to the slide.
+/// A maxSliceSize larger than zero additionally cuts the slices at multiples of it, e.g., so that parts of a long window can be completed,
+/// while the window itself is still filling.
 class SliceAssigner
 {
 public:
-    explicit SliceAssigner(const uint64_t windowSize, const uint64_t windowSlide) : windowSize(windowSize), windowSlide(windowSlide) { }
+    explicit SliceAssigner(const uint64_t windowSize, const uint64_t windowSlide, const uint64_t maxSliceSize = 0)
+        : windowSize(windowSize), windowSlide(windowSlide), maxSliceSize(maxSliceSize)
+    {
+    }
 
     SliceAssigner(const SliceAssigner& other) = default;
     SliceAssigner(SliceAssigner&& other) noexcept = default;
@@ -48,7 +53,8 @@ public:
         const auto prevSlideStart = timestampRaw - ((timestampRaw) % windowSlide);
         const auto prevWindowStart
             = timestampRaw < windowSize ? prevSlideStart : timestampRaw - ((timestampRaw - windowSize) % windowSlide);
-        return SliceStart(std::max(prevSlideStart, prevWindowStart));
+        const auto prevCutStart = maxSliceSize == 0 ? prevSlideStart : timestampRaw - (timestampRaw % maxSliceSize);
+        return SliceStart(std::max({prevSlideStart, prevWindowStart, prevCutStart}));
     }
 
     /// @brief Calculates the end of a slice for a specific timestamp ts.
@@ -60,7 +66,8 @@ public:
         const auto nextSlideEnd = timestampRaw + windowSlide - ((timestampRaw) % windowSlide);
         const auto nextWindowEnd
             = timestampRaw < windowSize ? windowSize : timestampRaw + windowSlide - ((timestampRaw - windowSize) % windowSlide);
-        return SliceEnd(std::min(nextSlideEnd, nextWindowEnd));
+        const auto nextCutEnd = maxSliceSize == 0 ? nextSlideEnd : timestampRaw + maxSliceSize - (timestampRaw % maxSliceSize);
+        return SliceEnd(std::min({nextSlideEnd, nextWindowEnd, nextCutEnd}));
     }
 
     /// Retrieves all window identifiers that correspond to this slice
@@ -73,16 +80,12 @@ public:
 
         /// Taking the max out of sliceEnd and windowSize, allows us to not create windows, such as 0-5 for slide 5 and size 100.
         /// In our window model, a window is always the size of the window size.
+        /// A window contains the slice, if it ends not before the slice end and starts not after the slice start. Thus, we round the first
+        /// window end up to the next valid window end for the window parameters size and slide. For slices in a gap between two windows,
+        /// the first window end is then larger than the last one.
         auto firstWindowEnd = std::max((sliceEnd), windowSize);
-        auto lastWindowEnd = sliceStart + windowSize;
-
-        if ((firstWindowEnd - windowSize) % windowSlide != 0)
-        {
-            /// firstWindowEnd is no valid windowEnd for the window parameters size and slide.
-            /// essentially means, it is the firstWindowStart in which the slice is not contained, and we can use that to derive the required parameters
-            lastWindowEnd = firstWindowEnd + windowSize - windowSlide;
-            firstWindowEnd = sliceStart + windowSlide;
-        }
+        firstWindowEnd += (windowSlide - ((firstWindowEnd - windowSize) % windowSlide)) % windowSlide;
+        const auto lastWindowEnd = sliceStart + windowSize;
 
         std::vector<WindowInfo> allWindows;
         for (auto curWindowEnd = firstWindowEnd; curWindowEnd <= lastWindowEnd; curWindowEnd += windowSlide)
@@ -100,6 +103,7 @@ public:
 private:
     uint64_t windowSize;
     uint64_t windowSlide;
+    uint64_t maxSliceSize;
 };
 
 }
@@ -58,6 +58,13 @@ struct WindowInfoAndSequenceNumber
     bool operator<(const WindowInfoAndSequenceNumber& other) const { return windowInfo < other.windowInfo; }
 };
 
+/// Sequence number and watermark of a buffer that gets emitted in between the triggered windows
+struct SequenceNumberAndWatermark
+{
+    SequenceNumber sequenceNumber;
+    Timestamp watermark;
+};
+
 /// This is the interface for storing windows and slices in a window-based operator
 /// It provides an interface to operate on slices and windows for a time-based window operator, e.g., join or aggregation
 class WindowSlicesStoreInterface
@@ -72,17 +79,30 @@ public:
     /// Retrieves all slices that can be triggered by the given global watermark
     /// This method returns all slices for each window that can be triggered. It returns the slices for all windows that have been filled and have a window end smaller than the global watermark
     /// Additionally, it returns a sequence number per window that is incremented for each window and thus, it can be used to set it in the emitted tuple buffer for the probe operator.
+    /// Depending on the slice store, consecutive windows might share a sequence number and must then be emitted in the same tuple buffer.
     virtual std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getTriggerableWindowSlices(Timestamp globalWatermark)
         = 0;
 
+    /// Retrieves for all windows that are still filling the slices that end at or before the global watermark, i.e., that do not receive
+    /// any tuples anymore. Combining these slices results in a provisional result of a window, without consuming the slices.
+    /// Windows without such slices are omitted. The windows get sequence numbers like in getTriggerableWindowSlices().
+    /// If the windows are currently locked by another thread, nothing is returned, as the provisional results must not block the build.
+    virtual std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+    getProvisionalWindowSlices(Timestamp globalWatermark) = 0;
+
     /// Retrieves the slice by its end timestamp. If no slice exists for the given slice end, the optional return value is nullopt
     virtual std::optional<std::shared_ptr<Slice>> getSliceBySliceEnd(SliceEnd sliceEnd) = 0;
 
     /// Retrieves all current non-deleted slices that have not been triggered yet
     /// This method returns for each window all slices that have not been triggered yet, regardless of any watermark timestamp
-    /// Additionally, it returns a sequence number per window that is incremented for each window and thus, it can be used to set it in the emitted tuple buffer for the probe operator.
+    /// Additionally, it returns a sequence number per window like getTriggerableWindowSlices().
     virtual std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> getAllNonTriggeredSlices() = 0;
 
+    /// Hands out a sequence number that is not shared with any window, e.g., for results that are emitted before their window is triggered.
+    /// The watermark gets read while holding the same lock as triggering windows. Thus, the returned watermark is not smaller than the
+    /// watermark of any window with a smaller sequence number and is capped to the start of the oldest window that has not been triggered.
+    virtual SequenceNumberAndWatermark getNextSequenceNumberAndWatermark(const std::function<Timestamp()>& readWatermark) = 0;
+
     /// Garbage collect all slices and windows that are not valid anymore
     /// It is open for the implementation to delete the slices in this call or to mark them for deletion
     /// There is no guarantee that the slices are deleted after this call
@@ -0,0 +1,66 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <Time/Timestamp.hpp>
+#include <Watermark/MultiOriginWatermarkProcessor.hpp>
+#include <folly/Synchronized.h>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+/// Sequence number and watermark of an input buffer after it has been re-stamped onto the output origin of the union
+struct MergedBufferMetaData
+{
+    SequenceNumber::Underlying sequenceNumber;
+    Timestamp::Underlying watermarkTs;
+};
+
+/// Coalesces the origins of all inputs of a union into a single output origin.
+/// Every input buffer receives its own sequence number of the output origin and the minimal watermark across all input origins.
+/// Thus, downstream operators, e.g., watermark processors of windowed operators, track a single origin regardless of the fan-in.
+class UnionOperatorHandler final : public OperatorHandler
+{
+public:
+    UnionOperatorHandler(const std::vector<OriginId>& inputOrigins, OriginId outputOriginId);
+
+    /// Assigns the next sequence number of the output origin to the input buffer and returns the minimal watermark across all inputs.
+    /// Both happen atomically. Otherwise, a buffer could receive a smaller sequence number than a buffer that is already part of its
+    /// watermark, and downstream operators could consider a watermark complete that does not cover all of its preceding buffers.
+    [[nodiscard]] MergedBufferMetaData mergeBuffer(Timestamp watermarkTs, SequenceData sequenceData, OriginId originId);
+
+    [[nodiscard]] OriginId getOutputOriginId() const;
+
+    void start(PipelineExecutionContext& pipelineExecutionContext, uint32_t localStateVariableId) override;
+    void stop(QueryTerminationType terminationType, PipelineExecutionContext& pipelineExecutionContext) override;
+
+private:
+    struct MergeState
+    {
+        SequenceNumber::Underlying nextSequenceNumber = SequenceNumber::INITIAL;
+    };
+
+    OriginId outputOriginId;
+    MultiOriginWatermarkProcessor watermarkProcessor;
+    folly::Synchronized<MergeState> mergeState;
+};
+}
@@ -11,24 +11,35 @@
     See the License for the specific language governing permissions and
     limitations under the License.
 */
+
 #pragma once
 
 #include <optional>
+#include <Identifiers/Identifiers.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
 
 namespace NES
 {
+
+/// Merges the inputs of a union into a single output origin.
+/// In open, every input buffer is re-stamped via the UnionOperatorHandler onto a new sequence number of the output origin, carrying the
+/// minimal watermark across all inputs. Thus, all downstream operators of this pipeline observe the merged origin. Records pass through.
 class UnionPhysicalOperator final : public PhysicalOperatorConcept
 {
 public:
-    explicit UnionPhysicalOperator() = default;
+    UnionPhysicalOperator(OperatorHandlerId operatorHandlerId, OriginId outputOriginId);
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
 
+    void open(ExecutionContext& ctx, RecordBuffer& recordBuffer) const override;
     void execute(ExecutionContext& ctx, Record& record) const override;
 
 private:
     std::optional<PhysicalOperator> child;
+    OperatorHandlerId operatorHandlerId;
+    OriginId outputOriginId;
 };
 }
@@ -12,10 +12,13 @@
     limitations under the License.
 */
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <Watermark/TimeFunction.hpp>
+#include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
+#include <val.hpp>
 
 namespace NES
 {
@@ -23,12 +26,15 @@ class TimeFunction;
 
 /// @brief Watermark assignment operator.
 /// Determines the watermark ts according to a WatermarkStrategyDescriptor an places it in the current buffer.
+/// If the operator receives all records of a buffer at once via executeOnRecords, it determines the watermark of the whole buffer upfront
+/// and hands over the records to its child afterward. Thus, no per record watermark logic remains in the pipeline body.
 class EventTimeWatermarkAssignerPhysicalOperator : public PhysicalOperatorConcept
 {
 public:
     explicit EventTimeWatermarkAssignerPhysicalOperator(EventTimeFunction timeFunction);
     void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
     void execute(ExecutionContext& ctx, Record& record) const override;
+    void executeOnRecords(ExecutionContext& ctx, const RecordBatch& records) const override;
     void close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
     [[nodiscard]] std::optional<PhysicalOperator> getChild() const override;
     void setChild(PhysicalOperator child) override;
@@ -13,8 +13,11 @@
 */
 
 #pragma once
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Sequencing/NonBlockingMonotonicSeqQueue.hpp>
@@ -26,6 +29,10 @@ namespace NES
 {
 
 /// @brief A multi origin version of the lock free watermark processor.
+/// The origins are resolved once during construction to dense indexes via a lookup table that is indexed by the raw origin id.
+/// As origin ids are assigned consecutively per query, this table stays small and allows an O(1) lookup per buffer.
+/// The minimal watermark across all origins is kept in a lock-free tournament tree, which requires O(log(origins)) work per update
+/// instead of O(origins). Reading the current watermark is a single atomic load of the root.
 class MultiOriginWatermarkProcessor
 {
 public:
@@ -41,8 +48,23 @@ public:
     std::string getCurrentStatus();
 
 private:
+    static constexpr uint32_t NO_ORIGIN_INDEX = UINT32_MAX;
+
+    /// Raises the node to the given value, if the value is larger. Watermarks are monotonic, thus nodes never decrease.
+    static void raiseTo(std::atomic<uint64_t>& node, uint64_t value);
+
     const std::vector<OriginId> origins;
     std::vector<std::shared_ptr<Sequencing::NonBlockingMonotonicSeqQueue<uint64_t>>> watermarkProcessors;
+
+    /// Maps the raw value of an origin id to its index in origins. Unknown origins are mapped to NO_ORIGIN_INDEX.
+    std::vector<uint32_t> originIndexes;
+
+    /// Implicit binary tree of numberOfLeaves leaves, stored at [numberOfLeaves, 2 * numberOfLeaves), and the root at index 1.
+    /// Every inner node stores the minimum of its children. Leaves without an origin are set to UINT64_MAX.
+    /// A node only ever stores a minimum that was valid at some point and is therefore never larger than the true minimum.
+    /// As every update recomputes the path up to the root after publishing its leaf, the last update always installs the exact minimum.
+    size_t numberOfLeaves;
+    mutable std::vector<std::atomic<uint64_t>> tournamentTree;
 };
 
 }
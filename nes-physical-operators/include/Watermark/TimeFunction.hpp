@@ -13,6 +13,8 @@
 */
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <DataTypes/TimeUnit.hpp>
 #include <Functions/PhysicalFunction.hpp>
@@ -46,10 +48,18 @@ public:
 class EventTimeFunction final : public TimeFunction
 {
 public:
+    using RecordReader = std::function<Record(nautilus::val<uint64_t>& recordIndex)>;
+
     explicit EventTimeFunction(PhysicalFunction timestampFunction, const Windowing::TimeUnit& unit);
     void open(ExecutionContext& ctx, RecordBuffer& buffer) const override;
     nautilus::val<Timestamp> getTs(ExecutionContext& ctx, Record& record) const override;
 
+    /// Returns the maximum timestamp of numberOfRecords records, which are read via readRecord. It does not change the current ts, which
+    /// remains the timestamp of the record that is being processed. The maximum is computed without branching on the raw timestamps. As
+    /// the conversion to milliseconds is monotonic, it is applied only once to the maximum.
+    nautilus::val<Timestamp>
+    getMaxTs(ExecutionContext& ctx, const nautilus::val<uint64_t>& numberOfRecords, const RecordReader& readRecord) const;
+
     [[nodiscard]] std::unique_ptr<TimeFunction> clone() const override
     {
         return std::make_unique<EventTimeFunction>(timestampFunction, unit);
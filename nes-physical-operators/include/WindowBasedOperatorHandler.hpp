@@ -35,19 +35,26 @@ namespace NES
 /// Stores the metadata for a RecordBuffer
 struct BufferMetaData
 {
-    BufferMetaData(const Timestamp watermarkTs, const SequenceData seqNumber, const OriginId originId)
-        : watermarkTs(watermarkTs), seqNumber(seqNumber), originId(originId)
+    BufferMetaData(const Timestamp watermarkTs, const SequenceData seqNumber, const OriginId originId, const uint64_t numberOfTuples = 0)
+        : watermarkTs(watermarkTs), seqNumber(seqNumber), originId(originId), numberOfTuples(numberOfTuples)
     {
     }
 
     [[nodiscard]] std::string toString() const
     {
-        return fmt::format("BufferMetadata(waterMarkTs: {}, seqNumber: {}, originId: {})", watermarkTs, seqNumber, originId);
+        return fmt::format(
+            "BufferMetadata(waterMarkTs: {}, seqNumber: {}, originId: {}, numberOfTuples: {})",
+            watermarkTs,
+            seqNumber,
+            originId,
+            numberOfTuples);
     }
 
     Timestamp watermarkTs;
     SequenceData seqNumber;
     OriginId originId;
+    /// Number of records that the build inserted into its slices while processing the buffer
+    uint64_t numberOfTuples;
 };
 
 /// This is the base class for all window-based operator handlers, e.g., join and aggregation.
@@ -31,10 +31,17 @@ namespace NES
 class WindowOperatorBuildLocalState : public OperatorState
 {
 public:
-    explicit WindowOperatorBuildLocalState(const nautilus::val<OperatorHandler*>& operatorHandler) : operatorHandler(operatorHandler) { }
+    explicit WindowOperatorBuildLocalState(const nautilus::val<OperatorHandler*>& operatorHandler)
+        : operatorHandler(operatorHandler), numberOfBuiltRecords(0)
+    {
+    }
 
     nautilus::val<OperatorHandler*> getOperatorHandler() { return operatorHandler; }
 
+    /// Number of records of the current buffer that the build has inserted into its slices.
+    /// Builds that do not rely on it, e.g., joins, do not count their records.
+    nautilus::val<uint64_t> numberOfBuiltRecords;
+
 private:
     nautilus::val<OperatorHandler*> operatorHandler;
 };
@@ -55,7 +62,8 @@ public:
     /// Initializes the time function, e.g., method that extracts the timestamp from a record
     void open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
-    /// Passes emits slices that are ready to the second phase (probe) for further processing
+    /// Passes emits slices that are ready to the second phase (probe) for further processing.
+    /// Passes the number of records that the build inserted while processing the buffer, e.g., for the early firing of aggregations.
     void close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const override;
 
     /// Emits/Flushes all slices and windows, as the query will be terminated
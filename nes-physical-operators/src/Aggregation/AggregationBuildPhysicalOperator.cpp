@@ -23,14 +23,19 @@
 #include <Aggregation/AggregationSlice.hpp>
 #include <Aggregation/Function/AggregationPhysicalFunction.hpp>
 #include <Identifiers/Identifiers.hpp>
+#include <Nautilus/DataTypes/VarVal.hpp>
+#include <Nautilus/Interface/Hash/HashFunction.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/Record.hpp>
 #include <SliceStore/Slice.hpp>
 #include <Time/Timestamp.hpp>
+#include <Util/AggregationSliceLayout.hpp>
+#include <Arena.hpp>
 #include <CompilationContext.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
+#include <HashMapOptions.hpp>
 #include <HashMapSlice.hpp>
 #include <WindowBuildPhysicalOperator.hpp>
 #include <function.hpp>
@@ -40,22 +45,18 @@
 
 namespace NES
 {
-HashMap* getAggHashMapProxy(
-    const AggregationOperatorHandler* operatorHandler,
-    const Timestamp timestamp,
-    const WorkerThreadId workerThreadId,
-    const AggregationBuildPhysicalOperator* buildOperator)
+namespace
+{
+std::shared_ptr<AggregationSlice>
+getAggregationSlice(const AggregationOperatorHandler* operatorHandler, const Timestamp timestamp, const HashMapOptions& hashMapOptions)
 {
-    PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
-    PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
-
     /// If a new hashmap slice is created, we need to set the cleanup function for the aggregation states
     const CreateNewHashMapSliceArgs hashMapSliceArgs{
         {operatorHandler->cleanupStateNautilusFunction},
-        buildOperator->hashMapOptions.keySize,
-        buildOperator->hashMapOptions.valueSize,
-        buildOperator->hashMapOptions.pageSize,
-        buildOperator->hashMapOptions.numberOfBuckets};
+        hashMapOptions.keySize,
+        hashMapOptions.valueSize,
+        hashMapOptions.pageSize,
+        hashMapOptions.numberOfBuckets};
     auto wrappedCreateFunction(
         [createFunction = operatorHandler->getCreateNewSlicesFunction(hashMapSliceArgs),
          cleanupStateNautilusFunction = operatorHandler->cleanupStateNautilusFunction](const SliceStart sliceStart, const SliceEnd sliceEnd)
@@ -71,10 +72,49 @@ HashMap* getAggHashMapProxy(
         "slicing, but got {}",
         hashMap.size());
 
-    /// Converting the slice to an AggregationSlice and returning the pointer to the hashmap
-    const auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(hashMap[0]);
+    /// Converting the slice to an AggregationSlice
+    auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(hashMap[0]);
     INVARIANT(aggregationSlice != nullptr, "The slice should be an AggregationSlice in an AggregationBuild");
-    return aggregationSlice->getHashMapPtrOrCreate(workerThreadId);
+    return aggregationSlice;
+}
+
+void unlockSharedAggHashMapPartitionProxy(Arena* arena)
+{
+    PRECONDITION(arena != nullptr, "The arena should not be null");
+    PRECONDITION(not arena->heldLocks.empty(), "The arena should hold the lock of the partition");
+    arena->heldLocks.pop_back();
+}
+}
+
+HashMap* getAggHashMapProxy(
+    const AggregationOperatorHandler* operatorHandler,
+    const Timestamp timestamp,
+    const WorkerThreadId workerThreadId,
+    const AggregationBuildPhysicalOperator* buildOperator)
+{
+    PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
+    PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
+
+    return getAggregationSlice(operatorHandler, timestamp, buildOperator->hashMapOptions)->getHashMapPtrOrCreate(workerThreadId);
+}
+
+HashMap* lockSharedAggHashMapPartitionProxy(
+    const AggregationOperatorHandler* operatorHandler,
+    const Timestamp timestamp,
+    const uint64_t keyHash,
+    Arena* arena,
+    const AggregationBuildPhysicalOperator* buildOperator)
+{
+    PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
+    PRECONDITION(arena != nullptr, "The arena should not be null");
+    PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
+
+    /// The slice outlives the returned hashmap until the watermark passes the slice end, i.e., until this buffer has been processed
+    auto [hashMap, lock] = getAggregationSlice(operatorHandler, timestamp, buildOperator->hashMapOptions)->lockSharedPartition(keyHash);
+
+    /// The arena holds the lock until the update is done. If the update throws, destroying the arena releases it.
+    arena->heldLocks.emplace_back(std::move(lock));
+    return hashMap;
 }
 
 void AggregationBuildPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
@@ -125,26 +165,60 @@ void AggregationBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& re
     auto* const localState = dynamic_cast<WindowOperatorBuildLocalState*>(ctx.getLocalState(id));
     auto operatorHandler = localState->getOperatorHandler();
 
-    /// Getting the correspinding slice so that we can update the aggregation states
-    const auto timestamp = timeFunction->getTs(ctx, record);
-    const auto hashMapPtr = invoke(
-        getAggHashMapProxy, operatorHandler, timestamp, ctx.workerThreadId, nautilus::val<const AggregationBuildPhysicalOperator*>(this));
-    ChainedHashMapRef hashMap(
-        hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize);
-
     /// Calling the key functions to add/update the keys to the record
+    std::vector<VarVal> keyValues;
     for (nautilus::static_val<uint64_t> i = 0; i < hashMapOptions.fieldKeys.size(); ++i)
     {
         const auto& [fieldIdentifier, type, fieldOffset] = hashMapOptions.fieldKeys[i];
         const auto& function = hashMapOptions.keyFunctions[i];
         const auto value = function.execute(record, ctx.pipelineMemoryProvider.arena);
         record.write(fieldIdentifier, value);
+        keyValues.emplace_back(value);
     }
 
+    /// Getting the correspinding slice so that we can update the aggregation states
+    const auto timestamp = timeFunction->getTs(ctx, record);
+    const auto keyHash = hashMapOptions.hashFunction->calculate(keyValues);
+    if (sliceLayout == AggregationSliceLayout::SHARED)
+    {
+        /// The hashmaps of the slice are shared by all worker threads. Thus, we lock the partition of the keys during the update.
+        /// The arena of this pipeline invocation holds the lock, so that an exception during the update, e.g., if no page can be
+        /// allocated, releases the partition while unwinding.
+        const auto hashMapPtr = invoke(
+            lockSharedAggHashMapPartitionProxy,
+            operatorHandler,
+            timestamp,
+            keyHash,
+            ctx.pipelineMemoryProvider.arena.getArena(),
+            nautilus::val<const AggregationBuildPhysicalOperator*>(this));
+        updateAggregationStates(ctx, record, keyHash, hashMapPtr);
+        invoke(unlockSharedAggHashMapPartitionProxy, ctx.pipelineMemoryProvider.arena.getArena());
+    }
+    else
+    {
+        const auto hashMapPtr = invoke(
+            getAggHashMapProxy,
+            operatorHandler,
+            timestamp,
+            ctx.workerThreadId,
+            nautilus::val<const AggregationBuildPhysicalOperator*>(this));
+        updateAggregationStates(ctx, record, keyHash, hashMapPtr);
+    }
+
+    /// Counting the built records, as the early firing of provisional results depends on them and not on the records of the buffer
+    localState->numberOfBuiltRecords = localState->numberOfBuiltRecords + 1;
+}
+
+void AggregationBuildPhysicalOperator::updateAggregationStates(
+    ExecutionContext& ctx, Record& record, const HashFunction::HashValue& keyHash, const nautilus::val<HashMap*>& hashMapPtr) const
+{
+    ChainedHashMapRef hashMap(
+        hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize);
+
     /// Finding or creating the entry for the provided record
     const auto hashMapEntry = hashMap.findOrCreateEntry(
         record,
-        *hashMapOptions.hashFunction,
+        keyHash,
         [&](const nautilus::val<AbstractHashMapEntry*>& entry)
         {
             /// If the entry for the provided keys does not exist, we need to create a new one and initialize the aggregation states
@@ -173,11 +247,14 @@ AggregationBuildPhysicalOperator::AggregationBuildPhysicalOperator(
     const OperatorHandlerId operatorHandlerId,
     std::unique_ptr<TimeFunction> timeFunction,
     std::vector<std::shared_ptr<AggregationPhysicalFunction>> aggregationFunctions,
-    HashMapOptions hashMapOptions)
+    HashMapOptions hashMapOptions,
+    const AggregationSliceLayout sliceLayout)
     : WindowBuildPhysicalOperator(operatorHandlerId, std::move(timeFunction))
     , aggregationPhysicalFunctions(std::move(aggregationFunctions))
     , hashMapOptions(std::move(hashMapOptions))
+    , sliceLayout(sliceLayout)
 {
+    PRECONDITION(sliceLayout != AggregationSliceLayout::OPTIMIZER_CHOOSES, "The slice layout should be chosen during lowering");
 }
 
 }
@@ -22,6 +22,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 #include <Aggregation/AggregationSlice.hpp>
@@ -31,8 +32,10 @@
 #include <Runtime/TupleBuffer.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Util/AggregationSliceLayout.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
+#include <HashMapSizeTuner.hpp>
 #include <PipelineExecutionContext.hpp>
 #include <WindowBasedOperatorHandler.hpp>
 
@@ -43,103 +46,191 @@ AggregationOperatorHandler::AggregationOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
     std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-    const uint64_t maxNumberOfBuckets)
+    const uint64_t maxNumberOfBuckets,
+    const EarlyFireTrigger earlyFireTrigger,
+    const AggregationSliceLayout sliceLayout)
     : WindowBasedOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore))
     , setupAlreadyCalled(false)
-    , rollingAverageNumberOfKeys(RollingAverage<uint64_t>{100})
-    , maxNumberOfBuckets(maxNumberOfBuckets)
+    , hashMapSizeTuner(HashMapSizeTuner{maxNumberOfBuckets, HashMapSizeTuner::DEFAULT_NUMBER_OF_OBSERVED_HASH_MAPS})
+    , earlyFireTrigger(earlyFireTrigger)
+    , sliceLayout(sliceLayout)
+    , numberOfTuplesSinceLastEarlyFire(0)
+    , lastEarlyFire(std::chrono::steady_clock::now().time_since_epoch().count())
 {
 }
 
+void AggregationOperatorHandler::checkAndTriggerWindows(const BufferMetaData& bufferMetaData, PipelineExecutionContext* pipelineCtx)
+{
+    WindowBasedOperatorHandler::checkAndTriggerWindows(bufferMetaData, pipelineCtx);
+    if (earlyFireTrigger.isEnabled() and isEarlyFireDue(bufferMetaData.numberOfTuples))
+    {
+        /// The provisional windows get their own sequence numbers. Thus, the probe emits them like any other window.
+        const auto provisionalWindowSlices
+            = sliceAndWindowStore->getProvisionalWindowSlices(watermarkProcessorBuild->getCurrentWatermark());
+        NES_TRACE("Early fire of {} provisional windows for origin: {}", provisionalWindowSlices.size(), outputOriginId);
+        triggerSlices(provisionalWindowSlices, pipelineCtx);
+    }
+}
+
+bool AggregationOperatorHandler::isEarlyFireDue(const uint64_t numberOfTuples)
+{
+    const auto observedNumberOfTuples
+        = numberOfTuplesSinceLastEarlyFire.fetch_add(numberOfTuples, std::memory_order::relaxed) + numberOfTuples;
+    const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+    auto lastEarlyFireTime = lastEarlyFire.load(std::memory_order::relaxed);
+
+    const auto tupleCountReached = earlyFireTrigger.numberOfTuples > 0 and observedNumberOfTuples >= earlyFireTrigger.numberOfTuples;
+    const auto intervalPassed = earlyFireTrigger.interval.count() > 0
+        and std::chrono::steady_clock::duration(now - lastEarlyFireTime) >= earlyFireTrigger.interval;
+    if (not tupleCountReached and not intervalPassed)
+    {
+        return false;
+    }
+
+    /// Only the thread that updates the time of the last early fire performs the early fire. Tuples that are counted concurrently to the
+    /// reset might get lost, which only delays the next early fire slightly.
+    if (not lastEarlyFire.compare_exchange_strong(lastEarlyFireTime, now))
+    {
+        return false;
+    }
+    numberOfTuplesSinceLastEarlyFire.store(0, std::memory_order::relaxed);
+    return true;
+}
+
 std::function<std::vector<std::shared_ptr<Slice>>(SliceStart, SliceEnd)>
 AggregationOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArguments& newSlicesArguments) const
 {
     PRECONDITION(
         numberOfWorkerThreads > 0, "Number of worker threads not set for window based operator. Was setWorkerThreads() being called?");
     auto newHashMapArgs = dynamic_cast<const CreateNewHashMapSliceArgs&>(newSlicesArguments);
-    newHashMapArgs.numberOfBuckets = std::clamp(rollingAverageNumberOfKeys.rlock()->getAverage(), 1UL, maxNumberOfBuckets);
+    newHashMapArgs.numberOfBuckets = hashMapSizeTuner.rlock()->getNumberOfBuckets(newHashMapArgs.numberOfBuckets);
+    newHashMapArgs.hashMapFreeList = hashMapFreeList;
+    const auto numberOfHashMaps = sliceLayout == AggregationSliceLayout::SHARED
+        ? numberOfWorkerThreads * NUMBER_OF_SHARED_PARTITIONS_PER_WORKER_THREAD
+        : numberOfWorkerThreads;
     return std::function(
-        [outputOriginId = outputOriginId, numberOfWorkerThreads = numberOfWorkerThreads, copyOfNewHashMapArgs = newHashMapArgs](
+        [outputOriginId = outputOriginId, numberOfHashMaps, sliceLayout = sliceLayout, copyOfNewHashMapArgs = newHashMapArgs](
             SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
         {
             NES_TRACE("Creating new aggregation slice with for slice {}-{} for output origin {}", sliceStart, sliceEnd, outputOriginId);
-            return {std::make_shared<AggregationSlice>(sliceStart, sliceEnd, copyOfNewHashMapArgs, numberOfWorkerThreads)};
+            return {std::make_shared<AggregationSlice>(sliceStart, sliceEnd, copyOfNewHashMapArgs, numberOfHashMaps, sliceLayout)};
         });
 }
 
-void AggregationOperatorHandler::triggerSlices(
-    const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
-    PipelineExecutionContext* pipelineCtx)
+AggregationOperatorHandler::WindowToEmit
+AggregationOperatorHandler::collectWindow(const WindowInfo& windowInfo, const std::vector<std::shared_ptr<Slice>>& slices)
 {
-    for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
+    /// Getting all hashmaps for each slice that has at least one tuple
+    WindowToEmit window{.windowInfo = windowInfo, .finalHashMap = nullptr, .hashMaps = {}};
+    for (const auto& slice : slices)
     {
-        /// Getting all hashmaps for each slice that has at least one tuple
-        std::unique_ptr<ChainedHashMap> finalHashMap;
-        std::vector<HashMap*> allHashMaps;
-        uint64_t totalNumberOfTuples = 0;
-        for (const auto& slice : allSlices)
+        const auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(slice);
+        for (uint64_t hashMapIdx = 0; hashMapIdx < aggregationSlice->getNumberOfHashMaps(); ++hashMapIdx)
         {
-            const auto aggregationSlice = std::dynamic_pointer_cast<AggregationSlice>(slice);
-            for (uint64_t hashMapIdx = 0; hashMapIdx < aggregationSlice->getNumberOfHashMaps(); ++hashMapIdx)
+            if (auto* hashMap = aggregationSlice->getHashMapPtr(WorkerThreadId(hashMapIdx));
+                (hashMap != nullptr) and hashMap->getNumberOfTuples() > 0)
             {
-                if (auto* hashMap = aggregationSlice->getHashMapPtr(WorkerThreadId(hashMapIdx));
-                    (hashMap != nullptr) and hashMap->getNumberOfTuples() > 0)
+                /// As the hashmap has one value per key, we can use the number of tuples for the number of keys
+                const auto* const chainedHashMap = dynamic_cast<const ChainedHashMap*>(hashMap);
+                INVARIANT(chainedHashMap != nullptr, "The hashmap must be of type ChainedHashMap!");
+                hashMapSizeTuner.wlock()->observe(
+                    aggregationSlice->getNumberOfBuckets(), hashMap->getNumberOfTuples(), chainedHashMap->getNumberOfChains());
+
+                window.hashMaps.emplace_back(hashMap);
+                if (not window.finalHashMap)
                 {
-                    /// As the hashmap has one value per key, we can use the number of tuples for the number of keys
-                    rollingAverageNumberOfKeys.wlock()->add(hashMap->getNumberOfTuples());
-
-                    allHashMaps.emplace_back(hashMap);
-                    totalNumberOfTuples += hashMap->getNumberOfTuples();
-                    if (not finalHashMap)
-                    {
-                        finalHashMap = ChainedHashMap::createNewMapWithSameConfiguration(*dynamic_cast<ChainedHashMap*>(hashMap));
-                    }
+                    window.finalHashMap = ChainedHashMap::createNewMapWithSameConfiguration(*dynamic_cast<ChainedHashMap*>(hashMap));
                 }
             }
         }
+    }
+    return window;
+}
+
+void AggregationOperatorHandler::emitWindows(
+    const SequenceNumber sequenceNumber, std::vector<WindowToEmit>& windows, PipelineExecutionContext* pipelineCtx) const
+{
+    /// We need a buffer that is large enough to store:
+    /// - size of EmittedAggregationWindows and the pointers to all windows
+    /// - size of EmittedAggregationWindow and all pointers to all hashmaps for each window
+    /// The windows are stored after the pointers. As all members are pointer-sized, each window is aligned.
+    auto neededBufferSize = sizeof(EmittedAggregationWindows) + (windows.size() * sizeof(EmittedAggregationWindow*));
+    uint64_t totalNumberOfTuples = 0;
+    for (const auto& window : windows)
+    {
+        neededBufferSize += sizeof(EmittedAggregationWindow) + (window.hashMaps.size() * sizeof(HashMap*));
+        for (const auto* hashMap : window.hashMaps)
+        {
+            totalNumberOfTuples += hashMap->getNumberOfTuples();
+        }
+    }
+    const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
+    if (not tupleBufferVal.has_value())
+    {
+        throw CannotAllocateBuffer("{}B for the aggregation window trigger were requested", neededBufferSize);
+    }
+    auto tupleBuffer = tupleBufferVal.value();
+
+    /// It might be that the buffer is not zeroed out.
+    std::ranges::fill(tupleBuffer.getAvailableMemoryArea(), std::byte{0});
+
+    /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
+    /// The watermark cannot be the slice end as some buffers might be still waiting to get processed. The windows are sorted by their
+    /// end, thus, we use the start of the first window.
+    tupleBuffer.setOriginId(outputOriginId);
+    tupleBuffer.setSequenceNumber(sequenceNumber);
+    tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
+    tupleBuffer.setLastChunk(true);
+    tupleBuffer.setWatermark(windows.front().windowInfo.windowStart);
+    tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
+    tupleBuffer.setCreationTimestampInMS(Timestamp(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
+
+    /// Writing all necessary information for the aggregation probe to the buffer via the placement new constructor
+    auto memoryArea = tupleBuffer.getAvailableMemoryArea();
+    auto* emittedWindows = new (memoryArea.data()) EmittedAggregationWindows{windows.size()};
+    auto nextWindowOffset = sizeof(EmittedAggregationWindows) + (windows.size() * sizeof(EmittedAggregationWindow*));
+    for (uint64_t windowIdx = 0; windowIdx < windows.size(); ++windowIdx)
+    {
+        auto& [windowInfo, finalHashMap, hashMaps] = windows[windowIdx];
+        emittedWindows->windows[windowIdx]
+            = new (memoryArea.subspan(nextWindowOffset).data()) EmittedAggregationWindow{windowInfo, std::move(finalHashMap), hashMaps};
+        nextWindowOffset += sizeof(EmittedAggregationWindow) + (hashMaps.size() * sizeof(HashMap*));
+    }
 
+    /// Dispatching the buffer to the probe operator via the task queue.
+    pipelineCtx->emitBuffer(tupleBuffer);
+    NES_TRACE(
+        "Emitted {} windows {}-{} with watermarkTs {} sequenceNumber {} originId {}",
+        windows.size(),
+        windows.front().windowInfo.windowStart,
+        windows.back().windowInfo.windowEnd,
+        tupleBuffer.getWatermark(),
+        tupleBuffer.getSequenceNumber(),
+        tupleBuffer.getOriginId());
+}
 
-        /// We need a buffer that is large enough to store:
-        /// - all pointers to all hashmaps of the window to be triggered
-        /// - a new hashmap for the probe operator, so that we are not overwriting the thread local hashmaps
-        /// - size of EmittedAggregationWindow
-        const auto neededBufferSize = sizeof(EmittedAggregationWindow) + (allHashMaps.size() * sizeof(HashMap*));
-        const auto tupleBufferVal = pipelineCtx->getBufferManager()->getUnpooledBuffer(neededBufferSize);
-        if (not tupleBufferVal.has_value())
+void AggregationOperatorHandler::triggerSlices(
+    const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo,
+    PipelineExecutionContext* pipelineCtx)
+{
+    /// Windows that share a sequence number are emitted in a single buffer. As the windows are sorted by their end, all windows of a
+    /// sequence number are next to each other.
+    std::vector<WindowToEmit> windowsOfSequenceNumber;
+    auto currentSequenceNumber = INVALID_SEQ_NUMBER;
+    for (const auto& [windowInfo, allSlices] : slicesAndWindowInfo)
+    {
+        if (windowInfo.sequenceNumber != currentSequenceNumber and not windowsOfSequenceNumber.empty())
         {
-            throw CannotAllocateBuffer("{}B for the hash join window trigger were requested", neededBufferSize);
+            emitWindows(currentSequenceNumber, windowsOfSequenceNumber, pipelineCtx);
+            windowsOfSequenceNumber.clear();
         }
-        auto tupleBuffer = tupleBufferVal.value();
-
-        /// It might be that the buffer is not zeroed out.
-        std::ranges::fill(tupleBuffer.getAvailableMemoryArea(), std::byte{0});
-
-        /// As we are here "emitting" a buffer, we have to set the originId, the seq number, the watermark and the "number of tuples".
-        /// The watermark cannot be the slice end as some buffers might be still waiting to get processed.
-        tupleBuffer.setOriginId(outputOriginId);
-        tupleBuffer.setSequenceNumber(windowInfo.sequenceNumber);
-        tupleBuffer.setChunkNumber(ChunkNumber(ChunkNumber::INITIAL));
-        tupleBuffer.setLastChunk(true);
-        tupleBuffer.setWatermark(windowInfo.windowInfo.windowStart);
-        tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
-        tupleBuffer.setCreationTimestampInMS(Timestamp(
-            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
-
-
-        /// Writing all necessary information for the aggregation probe to the buffer via the placement new constructor
-        auto tmp = tupleBuffer.getAvailableMemoryArea();
-        new (tmp.data()) EmittedAggregationWindow{windowInfo.windowInfo, std::move(finalHashMap), allHashMaps};
-
-
-        /// Dispatching the buffer to the probe operator via the task queue.
-        pipelineCtx->emitBuffer(tupleBuffer);
-        NES_TRACE(
-            "Emitted window {}-{} with watermarkTs {} sequenceNumber {} originId {}",
-            windowInfo.windowInfo.windowStart,
-            windowInfo.windowInfo.windowEnd,
-            tupleBuffer.getWatermark(),
-            tupleBuffer.getSequenceNumber(),
-            tupleBuffer.getOriginId());
+        currentSequenceNumber = windowInfo.sequenceNumber;
+        windowsOfSequenceNumber.emplace_back(collectWindow(windowInfo.windowInfo, allSlices));
+    }
+    if (not windowsOfSequenceNumber.empty())
+    {
+        emitWindows(currentSequenceNumber, windowsOfSequenceNumber, pipelineCtx);
     }
 }
 
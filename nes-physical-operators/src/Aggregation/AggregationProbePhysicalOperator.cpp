@@ -59,8 +59,23 @@ void AggregationProbePhysicalOperator::open(ExecutionContext& executionCtx, Reco
     executionCtx.originId = recordBuffer.getOriginId();
     openChild(executionCtx, recordBuffer);
 
-    /// Getting necessary values from the record buffer
-    const auto aggregationWindowRef = static_cast<nautilus::val<EmittedAggregationWindow*>>(recordBuffer.getMemArea());
+    /// The buffer contains all windows that share its sequence number. We emit them in order, thus, their results are appended to the
+    /// same output buffers of this task.
+    const auto emittedWindowsRef = static_cast<nautilus::val<EmittedAggregationWindows*>>(recordBuffer.getMemArea());
+    const auto numberOfWindows
+        = readValueFromMemRef<uint64_t>(getMemberRef(emittedWindowsRef, &EmittedAggregationWindows::numberOfWindows));
+    auto windowRefs = readValueFromMemRef<EmittedAggregationWindow**>(getMemberRef(emittedWindowsRef, &EmittedAggregationWindows::windows));
+    for (nautilus::val<uint64_t> curWindow = 0; curWindow < numberOfWindows; ++curWindow)
+    {
+        const nautilus::val<EmittedAggregationWindow*> aggregationWindowRef = windowRefs[curWindow];
+        probeWindow(executionCtx, aggregationWindowRef);
+    }
+}
+
+void AggregationProbePhysicalOperator::probeWindow(
+    ExecutionContext& executionCtx, const nautilus::val<EmittedAggregationWindow*>& aggregationWindowRef) const
+{
+    /// Getting necessary values from the emitted window
     const auto numberOfHashMaps
         = readValueFromMemRef<uint64_t>(getMemberRef(aggregationWindowRef, &EmittedAggregationWindow::numberOfHashMaps));
     const auto windowInfoRef = getMemberRef(aggregationWindowRef, &EmittedAggregationWindow::windowInfo);
@@ -15,11 +15,13 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
-#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <SliceStore/Slice.hpp>
+#include <Util/AggregationSliceLayout.hpp>
 #include <ErrorHandling.hpp>
 #include <HashMapSlice.hpp>
 
@@ -29,9 +31,12 @@ AggregationSlice::AggregationSlice(
     const SliceStart sliceStart,
     const SliceEnd sliceEnd,
     const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs,
-    const uint64_t numberOfHashMaps)
+    const uint64_t numberOfHashMaps,
+    const AggregationSliceLayout sliceLayout)
     : HashMapSlice(sliceStart, sliceEnd, createNewHashMapSliceArgs, numberOfHashMaps, 1)
+    , sharedPartitions(sliceLayout == AggregationSliceLayout::SHARED ? numberOfHashMaps : 0)
 {
+    PRECONDITION(sliceLayout != AggregationSliceLayout::OPTIMIZER_CHOOSES, "The slice layout should be chosen during lowering");
 }
 
 HashMap* AggregationSlice::getHashMapPtr(const WorkerThreadId workerThreadId) const
@@ -43,18 +48,31 @@ HashMap* AggregationSlice::getHashMapPtr(const WorkerThreadId workerThreadId) co
 
 HashMap* AggregationSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId)
 {
+    PRECONDITION(sharedPartitions.empty(), "The hashmaps of a slice with the shared layout should be accessed via their partition");
     const auto pos = workerThreadId % hashMaps.size();
     INVARIANT(pos < hashMaps.size(), "The worker thread id should be smaller than the number of hashmaps");
 
     if (hashMaps.at(pos) == nullptr)
     {
-        hashMaps.at(pos) = std::make_unique<ChainedHashMap>(
-            createNewHashMapSliceArgs.keySize,
-            createNewHashMapSliceArgs.valueSize,
-            createNewHashMapSliceArgs.numberOfBuckets,
-            createNewHashMapSliceArgs.pageSize);
+        hashMaps.at(pos) = createHashMap();
     }
     return hashMaps[pos].get();
 }
 
+LockedSharedHashMapPartition AggregationSlice::lockSharedPartition(const uint64_t keyHash)
+{
+    PRECONDITION(not sharedPartitions.empty(), "Only a slice with the shared layout has shared partitions");
+
+    /// The hashmap of the partition chooses the bucket by the lower bits of the hash. Thus, we choose the partition by the upper bits.
+    const auto pos = (keyHash >> 32) % sharedPartitions.size();
+    auto& partition = sharedPartitions[pos];
+    std::unique_lock lock(partition.mutex);
+    if (partition.hashMap == nullptr)
+    {
+        hashMaps.at(pos) = createHashMap();
+        partition.hashMap = hashMaps[pos].get();
+    }
+    return {.hashMap = partition.hashMap, .lock = std::move(lock)};
+}
+
 }
@@ -25,10 +25,12 @@
 #include <Nautilus/Interface/Record.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <Util/StdInt.hpp>
 #include <nautilus/val.hpp>
 #include <EmitOperatorHandler.hpp>
+#include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <OperatorState.hpp>
 #include <PhysicalOperator.hpp>
@@ -41,19 +43,38 @@ namespace NES
 class EmitState : public OperatorState
 {
 public:
-    explicit EmitState(const RecordBuffer& resultBuffer) : resultBuffer(resultBuffer), bufferMemoryArea(resultBuffer.getMemArea()) { }
+    explicit EmitState(const RecordBuffer& resultBuffer, TupleBufferRef::RecordCursor cursor)
+        : resultBuffer(resultBuffer), cursor(std::move(cursor)), numberOfEmittedRecords(0_u64)
+    {
+    }
 
-    nautilus::val<uint64_t> outputIndex = 0;
     RecordBuffer resultBuffer;
-    nautilus::val<int8_t*> bufferMemoryArea;
+    /// Position of the next record in the result buffer, its record index is the number of records written so far
+    TupleBufferRef::RecordCursor cursor;
+    /// Number of records in the result buffers that have already been emitted
+    nautilus::val<uint64_t> numberOfEmittedRecords;
 };
 
-void EmitPhysicalOperator::open(ExecutionContext& ctx, RecordBuffer&) const
+void EmitPhysicalOperator::open(ExecutionContext& ctx, RecordBuffer& recordBuffer) const
 {
     /// initialize state variable and create new buffer
     const auto resultBufferRef = ctx.allocateBuffer();
     const auto resultBuffer = RecordBuffer(resultBufferRef);
-    auto emitState = std::make_unique<EmitState>(resultBuffer);
+    auto emitState = std::make_unique<EmitState>(resultBuffer, bufferRef->createCursor(resultBuffer, 0_u64));
+    if (emitState->cursor.varSizedWriteCursor.has_value())
+    {
+        /// Forwarding is part of the compiled pipeline. We enable it per buffer, based on the selectivity of prior buffers.
+        const auto forwardingBuffer = invoke(
+            +[](OperatorHandler* handler, TupleBuffer* inputBuffer) -> TupleBuffer*
+            {
+                PRECONDITION(handler != nullptr, "Expects a valid handler");
+                const auto selectivity = dynamic_cast<EmitOperatorHandler&>(*handler).forwardingStatistics.getSelectivity();
+                return selectivity.has_value() and *selectivity >= MIN_SELECTIVITY_FOR_FORWARDING ? inputBuffer : nullptr;
+            },
+            ctx.getGlobalOperatorHandler(operatorHandlerId),
+            recordBuffer.getReference());
+        emitState->cursor.setForwardingBuffer(forwardingBuffer);
+    }
     ctx.setLocalOperatorState(id, std::move(emitState));
 }
 
@@ -61,27 +82,44 @@ void EmitPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
 {
     auto* const emitState = dynamic_cast<EmitState*>(ctx.getLocalState(id));
     /// emit buffer if it reached the maximal capacity
-    if (emitState->outputIndex >= getMaxRecordsPerBuffer())
+    auto& cursor = emitState->cursor;
+    if (cursor.recordIndex >= getMaxRecordsPerBuffer())
     {
-        emitRecordBuffer(ctx, emitState->resultBuffer, emitState->outputIndex, false);
+        TupleBufferRef::flushCursor(cursor, emitState->resultBuffer);
+        emitRecordBuffer(ctx, emitState->resultBuffer, cursor.recordIndex, false);
+        emitState->numberOfEmittedRecords = emitState->numberOfEmittedRecords + cursor.recordIndex;
         const auto resultBufferRef = ctx.allocateBuffer();
         emitState->resultBuffer = RecordBuffer(resultBufferRef);
-        emitState->bufferMemoryArea = emitState->resultBuffer.getMemArea();
-        emitState->outputIndex = 0_u64;
+        cursor.reset(bufferRef->createCursor(emitState->resultBuffer, 0_u64));
     }
 
     /// We need to first check if the buffer has to be emitted and then write to it. Otherwise, it can happen that we will
     /// emit a tuple twice. Once in the execute() and then again in close(). This happens only for buffers that are filled
     /// to the brim, i.e., have no more space left.
-    bufferRef->writeRecord(emitState->outputIndex, emitState->resultBuffer, record, ctx.pipelineMemoryProvider.bufferProvider);
-    emitState->outputIndex = emitState->outputIndex + 1;
+    bufferRef->writeRecordAtCursor(cursor, emitState->resultBuffer, record, ctx.pipelineMemoryProvider.bufferProvider);
+    cursor.advance();
 }
 
-void EmitPhysicalOperator::close(ExecutionContext& ctx, RecordBuffer&) const
+void EmitPhysicalOperator::close(ExecutionContext& ctx, RecordBuffer& recordBuffer) const
 {
     /// emit current buffer and set the metadata
     auto* const emitState = dynamic_cast<EmitState*>(ctx.getLocalState(id));
-    emitRecordBuffer(ctx, emitState->resultBuffer, emitState->outputIndex, true);
+    TupleBufferRef::flushCursor(emitState->cursor, emitState->resultBuffer);
+    emitRecordBuffer(ctx, emitState->resultBuffer, emitState->cursor.recordIndex, true);
+
+    if (emitState->cursor.varSizedWriteCursor.has_value())
+    {
+        invoke(
+            +[](OperatorHandler* handler, const uint64_t numberOfInputRecords, const uint64_t numberOfEmittedRecords)
+            {
+                PRECONDITION(handler != nullptr, "Expects a valid handler");
+                auto& forwardingStatistics = dynamic_cast<EmitOperatorHandler&>(*handler).forwardingStatistics;
+                forwardingStatistics.addObservation(numberOfInputRecords, numberOfEmittedRecords);
+            },
+            ctx.getGlobalOperatorHandler(operatorHandlerId),
+            recordBuffer.getNumRecords(),
+            emitState->numberOfEmittedRecords + emitState->cursor.recordIndex);
+    }
 }
 
 namespace
@@ -134,7 +172,8 @@ void EmitPhysicalOperator::emitRecordBuffer(
 }
 
 EmitPhysicalOperator::EmitPhysicalOperator(OperatorHandlerId operatorHandlerId, std::shared_ptr<TupleBufferRef> memoryProvider)
-    : bufferRef(std::move(memoryProvider)), operatorHandlerId(operatorHandlerId)
+    : bufferRef(std::move(memoryProvider))
+    , operatorHandlerId(operatorHandlerId)
 {
 }
 
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <utility>
+#include <vector>
 #include <Functions/PhysicalFunction.hpp>
 #include <Nautilus/DataTypes/VarVal.hpp>
 #include <Nautilus/DataTypes/VariableSizedData.hpp>
@@ -30,21 +31,41 @@ namespace NES
 {
 
 ConcatPhysicalFunction::ConcatPhysicalFunction(PhysicalFunction leftPhysicalFunction, PhysicalFunction rightPhysicalFunction)
-    : leftPhysicalFunction(std::move(leftPhysicalFunction)), rightPhysicalFunction(std::move(rightPhysicalFunction))
 {
+    /// Taking over the operands of nested concats, so that we do not create an intermediate result for them
+    for (const auto& childFunction : {std::move(leftPhysicalFunction), std::move(rightPhysicalFunction)})
+    {
+        if (const auto childConcat = childFunction.tryGet<ConcatPhysicalFunction>())
+        {
+            operandPhysicalFunctions.insert(
+                operandPhysicalFunctions.end(), childConcat->operandPhysicalFunctions.begin(), childConcat->operandPhysicalFunctions.end());
+        }
+        else
+        {
+            operandPhysicalFunctions.emplace_back(childFunction);
+        }
+    }
 }
 
 VarVal ConcatPhysicalFunction::execute(const Record& record, ArenaRef& arena) const
 {
-    const auto leftValue = leftPhysicalFunction.execute(record, arena).cast<VariableSizedData>();
-    const auto rightValue = rightPhysicalFunction.execute(record, arena).cast<VariableSizedData>();
-
-    const auto newSize = leftValue.getContentSize() + rightValue.getContentSize();
+    std::vector<VariableSizedData> operandValues;
+    operandValues.reserve(operandPhysicalFunctions.size());
+    nautilus::val<uint32_t> newSize(0);
+    for (const auto& operandFunction : operandPhysicalFunctions)
+    {
+        operandValues.emplace_back(operandFunction.execute(record, arena).cast<VariableSizedData>());
+        newSize = newSize + operandValues.back().getContentSize();
+    }
     auto newVarSizeData = arena.allocateVariableSizedData(newSize);
 
-    /// Writing the left value and then the right value to the new variable sized data
-    nautilus::memcpy(newVarSizeData.getContent(), leftValue.getContent(), leftValue.getContentSize());
-    nautilus::memcpy(newVarSizeData.getContent() + leftValue.getContentSize(), rightValue.getContent(), rightValue.getContentSize());
+    /// Writing all operands one after another to the new variable sized data
+    auto writePosition = newVarSizeData.getContent();
+    for (const auto& operandValue : operandValues)
+    {
+        nautilus::memcpy(writePosition, operandValue.getContent(), operandValue.getContentSize());
+        writePosition = writePosition + operandValue.getContentSize();
+    }
     VarVal(nautilus::val<uint32_t>(newSize)).writeToMemory(newVarSizeData.getReference());
     return newVarSizeData;
 }
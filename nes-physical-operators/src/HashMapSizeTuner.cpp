@@ -0,0 +1,66 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <HashMapSizeTuner.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <Util/Logger/Logger.hpp>
+#include <Util/RollingAverage.hpp>
+#include <ErrorHandling.hpp>
+
+namespace NES
+{
+
+HashMapSizeTuner::HashMapSizeTuner(const uint64_t maxNumberOfBuckets, const uint64_t numberOfObservedHashMaps)
+    : maxNumberOfBuckets(maxNumberOfBuckets)
+    , numberOfObservedHashMaps(numberOfObservedHashMaps)
+    , averageNumberOfKeys(numberOfObservedHashMaps)
+    , averageChainLength(numberOfObservedHashMaps)
+{
+    PRECONDITION(maxNumberOfBuckets > 0, "The maximal number of buckets must be greater than 0");
+}
+
+void HashMapSizeTuner::observe(const uint64_t numberOfBucketsOfHashMap, const uint64_t numberOfKeys, const uint64_t numberOfChains)
+{
+    PRECONDITION(numberOfChains > 0, "A hash map must have at least one chain");
+    averageNumberOfKeys.add(numberOfKeys);
+    /// Slices that have been created before the last resize are still triggered afterward. The length of their chains tells nothing about
+    /// the chosen number of buckets, thus they must not trigger another resize. Their number of keys is still representative, though.
+    if (numberOfBuckets.has_value() and numberOfBucketsOfHashMap != numberOfBuckets)
+    {
+        return;
+    }
+
+    const auto chainLength = averageChainLength.add(static_cast<double>(numberOfKeys) / static_cast<double>(numberOfChains));
+    if (numberOfBuckets.has_value() and chainLength >= MIN_AVERAGE_CHAIN_LENGTH and chainLength <= MAX_AVERAGE_CHAIN_LENGTH)
+    {
+        return;
+    }
+
+    const auto newNumberOfBuckets = std::clamp(averageNumberOfKeys.getAverage(), uint64_t{1}, maxNumberOfBuckets);
+    if (newNumberOfBuckets != numberOfBuckets)
+    {
+        NES_DEBUG("Choosing {} buckets for new hash maps, as the average chain length was {}", newNumberOfBuckets, chainLength);
+    }
+    numberOfBuckets = newNumberOfBuckets;
+    averageChainLength = RollingAverage<double>(numberOfObservedHashMaps);
+}
+
+uint64_t HashMapSizeTuner::getNumberOfBuckets(const uint64_t configuredNumberOfBuckets) const
+{
+    return numberOfBuckets.value_or(std::clamp(configuredNumberOfBuckets, uint64_t{1}, maxNumberOfBuckets));
+}
+
+}
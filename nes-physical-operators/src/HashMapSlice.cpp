@@ -30,6 +30,48 @@
 namespace NES
 {
 
+std::unique_ptr<ChainedHashMap>
+HashMapFreeList::acquire(const uint64_t keySize, const uint64_t valueSize, const uint64_t numberOfBuckets, const uint64_t pageSize)
+{
+    /// Hash maps with a different configuration, e.g., as the number of buckets has been tuned in the meantime, get destroyed after
+    /// releasing the lock
+    std::vector<std::unique_ptr<ChainedHashMap>> nonMatchingHashMaps;
+    std::unique_ptr<ChainedHashMap> hashMap;
+    {
+        const auto hashMapsLocked = hashMaps.wlock();
+        while (not hashMapsLocked->empty() and hashMap == nullptr)
+        {
+            auto candidate = std::move(hashMapsLocked->back());
+            hashMapsLocked->pop_back();
+            if (candidate->hasConfiguration(keySize, valueSize, numberOfBuckets, pageSize))
+            {
+                hashMap = std::move(candidate);
+            }
+            else
+            {
+                nonMatchingHashMaps.emplace_back(std::move(candidate));
+            }
+        }
+    }
+    return hashMap;
+}
+
+void HashMapFreeList::release(std::unique_ptr<HashMap> hashMap)
+{
+    auto* chainedHashMap = dynamic_cast<ChainedHashMap*>(hashMap.get());
+    if (chainedHashMap == nullptr)
+    {
+        return;
+    }
+    chainedHashMap->reset(MAX_NUMBER_OF_RETAINED_PAGES);
+
+    std::unique_ptr<ChainedHashMap> resetHashMap(dynamic_cast<ChainedHashMap*>(hashMap.release()));
+    if (const auto hashMapsLocked = hashMaps.wlock(); hashMapsLocked->size() < MAX_NUMBER_OF_HASH_MAPS)
+    {
+        hashMapsLocked->emplace_back(std::move(resetHashMap));
+    }
+}
+
 HashMapSlice::HashMapSlice(
     const SliceStart sliceStart,
     const SliceEnd sliceEnd,
@@ -60,11 +102,35 @@ HashMapSlice::~HashMapSlice()
             /// Calling the compiled nautilus function
             createNewHashMapSliceArgs.nautilusCleanup[i / numberOfHashMapsPerInputStream]->operator()(hashMaps[i].get());
         }
+        if (hashMaps[i] and createNewHashMapSliceArgs.hashMapFreeList)
+        {
+            createNewHashMapSliceArgs.hashMapFreeList->release(std::move(hashMaps[i]));
+        }
     }
 
     hashMaps.clear();
 }
 
+std::unique_ptr<HashMap> HashMapSlice::createHashMap() const
+{
+    if (createNewHashMapSliceArgs.hashMapFreeList)
+    {
+        if (auto hashMap = createNewHashMapSliceArgs.hashMapFreeList->acquire(
+                createNewHashMapSliceArgs.keySize,
+                createNewHashMapSliceArgs.valueSize,
+                createNewHashMapSliceArgs.numberOfBuckets,
+                createNewHashMapSliceArgs.pageSize))
+        {
+            return hashMap;
+        }
+    }
+    return std::make_unique<ChainedHashMap>(
+        createNewHashMapSliceArgs.keySize,
+        createNewHashMapSliceArgs.valueSize,
+        createNewHashMapSliceArgs.numberOfBuckets,
+        createNewHashMapSliceArgs.pageSize);
+}
+
 uint64_t HashMapSlice::getNumberOfHashMaps() const
 {
     return hashMaps.size();
@@ -78,4 +144,10 @@ uint64_t HashMapSlice::getNumberOfTuples() const
         0,
         [](uint64_t runningSum, const auto& hashMap) { return runningSum + hashMap->getNumberOfTuples(); });
 }
+
+uint64_t HashMapSlice::getNumberOfBuckets() const
+{
+    return createNewHashMapSliceArgs.numberOfBuckets;
+}
+
 }
@@ -17,23 +17,31 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/HashJoin/HJOperatorHandler.hpp>
 #include <Join/HashJoin/HJSlice.hpp>
 #include <Join/StreamJoinBuildPhysicalOperator.hpp>
+#include <Join/StreamJoinProbePhysicalOperator.hpp>
 #include <Join/StreamJoinUtil.hpp>
 #include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedEntryMemoryProvider.hpp>
 #include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMapRef.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVector.hpp>
 #include <Nautilus/Interface/PagedVector/PagedVectorRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <Time/Timestamp.hpp>
 #include <CompilationContext.hpp>
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <HashMapSlice.hpp>
+#include <PipelineExecutionContext.hpp>
 #include <WindowBuildPhysicalOperator.hpp>
 #include <function.hpp>
 #include <options.hpp>
@@ -43,12 +51,8 @@
 
 namespace NES
 {
-HashMap* getHashJoinHashMapProxy(
-    const HJOperatorHandler* operatorHandler,
-    const Timestamp timestamp,
-    const WorkerThreadId workerThreadId,
-    const JoinBuildSideType buildSide,
-    const HJBuildPhysicalOperator* buildOperator)
+HJSlice* getHashJoinSliceProxy(
+    const HJOperatorHandler* operatorHandler, const Timestamp timestamp, const HJBuildPhysicalOperator* buildOperator)
 {
     PRECONDITION(operatorHandler != nullptr, "The operator handler should not be null");
     PRECONDITION(buildOperator != nullptr, "The build operator should not be null");
@@ -67,12 +71,90 @@ HashMap* getHashJoinHashMapProxy(
         "slicing, but got {}",
         hashMap.size());
 
-    /// Converting the slice to an HJSlice and returning the pointer to the hashmap
+    /// Converting the slice to an HJSlice
     const auto hjSlice = std::dynamic_pointer_cast<HJSlice>(hashMap[0]);
     INVARIANT(hjSlice != nullptr, "The slice should be an HJSlice in an HJBuildPhysicalOperator");
-    return hjSlice->getHashMapPtrOrCreate(workerThreadId, buildSide);
+    return hjSlice.get();
+}
+
+HashMap* getHashJoinHashMapProxy(
+    const HJOperatorHandler* operatorHandler,
+    const Timestamp timestamp,
+    const WorkerThreadId workerThreadId,
+    const JoinBuildSideType buildSide,
+    const HJBuildPhysicalOperator* buildOperator)
+{
+    return getHashJoinSliceProxy(operatorHandler, timestamp, buildOperator)->getHashMapPtrOrCreate(workerThreadId, buildSide);
+}
+
+namespace
+{
+/// The keys of both join sides are stored in the same order with the same data types
+nautilus::val<bool> compareJoinKeys(
+    const Record& record,
+    const std::vector<FieldOffsets>& fieldKeys,
+    const Record& otherRecord,
+    const std::vector<FieldOffsets>& otherFieldKeys)
+{
+    for (nautilus::static_val<uint64_t> i = 0; i < fieldKeys.size(); ++i)
+    {
+        if (record.read(fieldKeys[i].fieldIdentifier) != otherRecord.read(otherFieldKeys[i].fieldIdentifier))
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
+/// Reads either the staged tuple or the match of the pair from the page that stores it
+Record readSymmetricJoinTuple(
+    ExecutionContext& ctx,
+    const nautilus::val<HJSlice*>& slice,
+    const nautilus::val<uint64_t>& pairIndex,
+    const bool match,
+    const TupleBufferRef& bufferRef,
+    const std::vector<Record::RecordFieldIdentifier>& fields)
+{
+    /// As we can not return two values via one invoke, we have to perform two invokes
+    const RecordBuffer page(invoke(
+        +[](const HJSlice* hjSlice, const WorkerThreadId workerThreadId, const uint64_t index, const bool readMatch)
+        {
+            const auto& pair = hjSlice->getSymmetricJoinPair(workerThreadId, index);
+            return &(readMatch ? pair.match : pair.tuple)->page;
+        },
+        slice,
+        ctx.workerThreadId,
+        pairIndex,
+        nautilus::val<bool>(match)));
+    auto positionOnPage = invoke(
+        +[](const HJSlice* hjSlice, const WorkerThreadId workerThreadId, const uint64_t index, const bool readMatch)
+        {
+            const auto& pair = hjSlice->getSymmetricJoinPair(workerThreadId, index);
+            return (readMatch ? pair.match : pair.tuple)->positionOnPage;
+        },
+        slice,
+        ctx.workerThreadId,
+        pairIndex,
+        nautilus::val<bool>(match));
+    return bufferRef.readRecord(fields, page, positionOnPage);
+}
+}
+
+/// Stores the slice whose staged tuples have not been published yet and the buffer of joined records of the symmetric hash join, which
+/// gets allocated for the first joined record
+class HJBuildSymmetricLocalState : public WindowOperatorBuildLocalState
+{
+public:
+    explicit HJBuildSymmetricLocalState(const nautilus::val<OperatorHandler*>& operatorHandler)
+        : WindowOperatorBuildLocalState(operatorHandler), stagedSlice(nullptr), resultBuffer(nullptr), numberOfResults(0)
+    {
+    }
+
+    nautilus::val<HJSlice*> stagedSlice;
+    nautilus::val<TupleBuffer*> resultBuffer;
+    nautilus::val<uint64_t> numberOfResults;
+};
+
 void HJBuildPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
 {
     StreamJoinBuildPhysicalOperator::setup(executionCtx, compilationContext);
@@ -119,6 +201,19 @@ void HJBuildPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationC
     operatorHandler->setNautilusCleanupExec(cleanupStateNautilusFunction, joinBuildSide);
 }
 
+void HJBuildPhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    if (not symmetricHashJoinOptions.has_value())
+    {
+        StreamJoinBuildPhysicalOperator::open(executionCtx, recordBuffer);
+        return;
+    }
+
+    timeFunction->open(executionCtx, recordBuffer);
+    const auto operatorHandler = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
+    executionCtx.setLocalOperatorState(id, std::make_unique<HJBuildSymmetricLocalState>(operatorHandler));
+}
+
 void HJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
 {
     /// Getting the operator handler from the local state
@@ -127,13 +222,28 @@ void HJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) con
 
     /// Get the current slice / hash map that we have to insert the tuple into
     const auto timestamp = timeFunction->getTs(ctx, record);
-    const auto hashMapPtr = invoke(
-        getHashJoinHashMapProxy,
-        operatorHandler,
-        timestamp,
-        ctx.workerThreadId,
-        nautilus::val<JoinBuildSideType>(joinBuildSide),
-        nautilus::val<const HJBuildPhysicalOperator*>(this));
+    nautilus::val<HJSlice*> slice(nullptr);
+    nautilus::val<HashMap*> hashMapPtr(nullptr);
+    if (symmetricHashJoinOptions.has_value())
+    {
+        slice = invoke(getHashJoinSliceProxy, operatorHandler, timestamp, nautilus::val<const HJBuildPhysicalOperator*>(this));
+        hashMapPtr = invoke(
+            +[](HJSlice* hjSlice, const WorkerThreadId workerThreadId, const JoinBuildSideType buildSide) -> HashMap*
+            { return hjSlice->getHashMapPtrOrCreate(workerThreadId, buildSide); },
+            slice,
+            ctx.workerThreadId,
+            nautilus::val<JoinBuildSideType>(joinBuildSide));
+    }
+    else
+    {
+        hashMapPtr = invoke(
+            getHashJoinHashMapProxy,
+            operatorHandler,
+            timestamp,
+            ctx.workerThreadId,
+            nautilus::val<JoinBuildSideType>(joinBuildSide),
+            nautilus::val<const HJBuildPhysicalOperator*>(this));
+    }
     ChainedHashMapRef hashMap{
         hashMapPtr, hashMapOptions.fieldKeys, hashMapOptions.fieldValues, hashMapOptions.entriesPerPage, hashMapOptions.entrySize};
 
@@ -172,6 +282,135 @@ void HJBuildPhysicalOperator::execute(ExecutionContext& ctx, Record& record) con
     auto entryMemArea = entryRef.getValueMemArea();
     const PagedVectorRef pagedVectorRef(entryMemArea, bufferRef);
     pagedVectorRef.writeRecord(record, ctx.pipelineMemoryProvider.bufferProvider);
+
+    if (symmetricHashJoinOptions.has_value())
+    {
+        /// Staging the tuple does not require any lock. The staged tuples of a slice get published and joined at once, either at the end
+        /// of the buffer or once a tuple belongs to another slice.
+        auto* symmetricLocalState = dynamic_cast<HJBuildSymmetricLocalState*>(localState);
+        if (symmetricLocalState->stagedSlice != slice)
+        {
+            if (symmetricLocalState->stagedSlice != nullptr)
+            {
+                publishAndJoinStagedTuples(ctx);
+            }
+            symmetricLocalState->stagedSlice = slice;
+        }
+        invoke(
+            +[](HJSlice* hjSlice, const WorkerThreadId workerThreadId, const uint64_t hash, const int8_t* pagedVectorMemArea)
+            {
+                /// The tuple has just been written to the last page of the paged vector
+                /// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                const auto* pagedVector = reinterpret_cast<const PagedVector*>(pagedVectorMemArea);
+                const auto& lastPage = pagedVector->getLastPage();
+                hjSlice->stageSymmetric(workerThreadId, hash, HJSlice::SymmetricJoinTuple{lastPage, lastPage.getNumberOfTuples() - 1});
+            },
+            slice,
+            ctx.workerThreadId,
+            entryRef.getHash(),
+            entryMemArea);
+    }
+}
+
+void HJBuildPhysicalOperator::publishAndJoinStagedTuples(ExecutionContext& ctx) const
+{
+    const auto& otherSideBufferRef = symmetricHashJoinOptions->otherSideBufferRef;
+    const auto& otherSideHashMapOptions = symmetricHashJoinOptions->otherSideHashMapOptions;
+    const auto& windowMetaData = symmetricHashJoinOptions->windowMetaData;
+    auto* localState = dynamic_cast<HJBuildSymmetricLocalState*>(ctx.getLocalState(id));
+    const auto slice = localState->stagedSlice;
+    localState->stagedSlice = nautilus::val<HJSlice*>(nullptr);
+
+    /// Publishing the staged tuples and collecting the tuples of the other side happens in one call, as it has to be atomic.
+    /// Joining the collected pairs and emitting the joined records does not require any lock.
+    const auto numberOfPairs = invoke(
+        +[](HJSlice* hjSlice, const WorkerThreadId workerThreadId, const JoinBuildSideType buildSide)
+        { return hjSlice->publishAndProbeSymmetric(workerThreadId, buildSide); },
+        slice,
+        ctx.workerThreadId,
+        nautilus::val<JoinBuildSideType>(joinBuildSide));
+
+    /// As the symmetric hash join requires a tumbling window, the slice is also the window of the joined records
+    const nautilus::val<Timestamp> windowStart{
+        invoke(+[](const HJSlice* hjSlice) { return hjSlice->getSliceStart().getRawValue(); }, slice)};
+    const nautilus::val<Timestamp> windowEnd{invoke(+[](const HJSlice* hjSlice) { return hjSlice->getSliceEnd().getRawValue(); }, slice)};
+    const auto fields = bufferRef->getAllFieldNames();
+    const auto otherSideFields = otherSideBufferRef->getAllFieldNames();
+
+    for (nautilus::val<uint64_t> pairIndex = 0; pairIndex < numberOfPairs; ++pairIndex)
+    {
+        const auto record = readSymmetricJoinTuple(ctx, slice, pairIndex, false, *bufferRef, fields);
+        const auto otherRecord = readSymmetricJoinTuple(ctx, slice, pairIndex, true, *otherSideBufferRef, otherSideFields);
+
+        /// The pairs solely share the hash, thus, we have to compare the keys
+        if (compareJoinKeys(record, hashMapOptions.fieldKeys, otherRecord, otherSideHashMapOptions.fieldKeys))
+        {
+            const auto joinedRecord = joinBuildSide == JoinBuildSideType::Left
+                ? StreamJoinProbePhysicalOperator::createJoinedRecord(
+                      windowMetaData, record, otherRecord, windowStart, windowEnd, fields, otherSideFields)
+                : StreamJoinProbePhysicalOperator::createJoinedRecord(
+                      windowMetaData, otherRecord, record, windowStart, windowEnd, otherSideFields, fields);
+            writeResultRecord(ctx, joinedRecord);
+        }
+    }
+}
+
+void HJBuildPhysicalOperator::writeResultRecord(ExecutionContext& ctx, const Record& joinedRecord) const
+{
+    const auto& resultBufferRef = symmetricHashJoinOptions->resultBufferRef;
+    auto* localState = dynamic_cast<HJBuildSymmetricLocalState*>(ctx.getLocalState(id));
+    if (localState->resultBuffer == nullptr)
+    {
+        localState->resultBuffer = ctx.allocateBuffer();
+        localState->numberOfResults = 0;
+    }
+
+    const RecordBuffer resultBuffer(localState->resultBuffer);
+    resultBufferRef->writeRecord(localState->numberOfResults, resultBuffer, joinedRecord, ctx.pipelineMemoryProvider.bufferProvider);
+    localState->numberOfResults = localState->numberOfResults + 1;
+    if (localState->numberOfResults >= resultBufferRef->getCapacity())
+    {
+        emitResultBuffer(ctx);
+    }
+}
+
+void HJBuildPhysicalOperator::emitResultBuffer(ExecutionContext& ctx) const
+{
+    auto* localState = dynamic_cast<HJBuildSymmetricLocalState*>(ctx.getLocalState(id));
+    RecordBuffer resultBuffer(localState->resultBuffer);
+    resultBuffer.setNumRecords(localState->numberOfResults);
+    invoke(
+        +[](OperatorHandler* ptrOpHandler, PipelineExecutionContext* pipelineCtx, TupleBuffer* resultBuffer)
+        {
+            PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+            PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null");
+            const auto* opHandler = dynamic_cast<HJOperatorHandler*>(ptrOpHandler);
+            opHandler->emitEagerJoinResults(*resultBuffer, pipelineCtx);
+            /// Deleting the tuple buffer, as it has been allocated for this pipeline invocation, like ExecutionContext::emitBuffer() does
+            delete resultBuffer;
+        },
+        localState->getOperatorHandler(),
+        ctx.pipelineContext,
+        localState->resultBuffer);
+    localState->resultBuffer = nautilus::val<TupleBuffer*>(nullptr);
+}
+
+void HJBuildPhysicalOperator::close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
+{
+    /// The joined records must reach the probe before the windows that might get triggered in the close of the build
+    if (symmetricHashJoinOptions.has_value())
+    {
+        auto* localState = dynamic_cast<HJBuildSymmetricLocalState*>(executionCtx.getLocalState(id));
+        if (localState->stagedSlice != nullptr)
+        {
+            publishAndJoinStagedTuples(executionCtx);
+        }
+        if (localState->resultBuffer != nullptr)
+        {
+            emitResultBuffer(executionCtx);
+        }
+    }
+    StreamJoinBuildPhysicalOperator::close(executionCtx, recordBuffer);
 }
 
 HJBuildPhysicalOperator::HJBuildPhysicalOperator(
@@ -179,9 +418,11 @@ HJBuildPhysicalOperator::HJBuildPhysicalOperator(
     const JoinBuildSideType joinBuildSide,
     std::unique_ptr<TimeFunction> timeFunction,
     const std::shared_ptr<TupleBufferRef>& bufferRef,
-    HashMapOptions hashMapOptions)
+    HashMapOptions hashMapOptions,
+    std::optional<SymmetricHashJoinOptions> symmetricHashJoinOptions)
     : StreamJoinBuildPhysicalOperator(operatorHandlerId, joinBuildSide, std::move(timeFunction), bufferRef)
     , hashMapOptions(std::move(hashMapOptions))
+    , symmetricHashJoinOptions(std::move(symmetricHashJoinOptions))
 {
 }
 
@@ -27,12 +27,16 @@
 #include <Join/HashJoin/HJSlice.hpp>
 #include <Join/StreamJoinOperatorHandler.hpp>
 #include <Join/StreamJoinUtil.hpp>
+#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <Runtime/TupleBuffer.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <SliceStore/Slice.hpp>
 #include <SliceStore/WindowSlicesStoreInterface.hpp>
+#include <Time/Timestamp.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
+#include <HashMapSizeTuner.hpp>
 #include <PipelineExecutionContext.hpp>
 
 namespace NES
@@ -41,12 +45,13 @@ HJOperatorHandler::HJOperatorHandler(
     const std::vector<OriginId>& inputOrigins,
     const OriginId outputOriginId,
     std::unique_ptr<WindowSlicesStoreInterface> sliceAndWindowStore,
-    const uint64_t maxNumberOfBuckets)
+    const uint64_t maxNumberOfBuckets,
+    const bool symmetric)
     : StreamJoinOperatorHandler(inputOrigins, outputOriginId, std::move(sliceAndWindowStore))
     , setupAlreadyCalledLeft(false)
     , setupAlreadyCalledRight(false)
-    , rollingAverageNumberOfKeys(RollingAverage<uint64_t>{100})
-    , maxNumberOfBuckets(maxNumberOfBuckets)
+    , hashMapSizeTuner(HashMapSizeTuner{maxNumberOfBuckets, HashMapSizeTuner::DEFAULT_NUMBER_OF_OBSERVED_HASH_MAPS})
+    , symmetric(symmetric)
 {
 }
 
@@ -57,7 +62,8 @@ HJOperatorHandler::getCreateNewSlicesFunction(const CreateNewSlicesArguments& ne
         numberOfWorkerThreads > 0, "Number of worker threads not set for window based operator. Has setWorkerThreads() being called?");
 
     auto newHashMapArgs = dynamic_cast<const CreateNewHashMapSliceArgs&>(newSlicesArguments);
-    newHashMapArgs.numberOfBuckets = std::clamp(rollingAverageNumberOfKeys.rlock()->getAverage(), 1UL, maxNumberOfBuckets);
+    newHashMapArgs.numberOfBuckets = hashMapSizeTuner.rlock()->getNumberOfBuckets(newHashMapArgs.numberOfBuckets);
+    newHashMapArgs.hashMapFreeList = hashMapFreeList;
     return std::function(
         [outputOriginId = outputOriginId, numberOfWorkerThreads = numberOfWorkerThreads, copyOfNewHashMapArgs = newHashMapArgs](
             SliceStart sliceStart, SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
@@ -126,7 +132,10 @@ void HJOperatorHandler::emitSlicesToProbe(
                 hashMap and hashMap->getNumberOfTuples() > 0)
             {
                 /// As the hashmap has one value per key, we can use the number of tuples for the number of keys
-                rollingAverageNumberOfKeys.wlock()->add(hashMap->getNumberOfTuples());
+                const auto* const chainedHashMap = dynamic_cast<const ChainedHashMap*>(hashMap);
+                INVARIANT(chainedHashMap != nullptr, "The hashmap must be of type ChainedHashMap!");
+                hashMapSizeTuner.wlock()->observe(
+                    hashJoinSlice->getNumberOfBuckets(), hashMap->getNumberOfTuples(), chainedHashMap->getNumberOfChains());
 
                 allHashMaps.emplace_back(hashMap);
                 totalNumberOfTuples += hashMap->getNumberOfTuples();
@@ -155,7 +164,7 @@ void HJOperatorHandler::emitSlicesToProbe(
     tupleBuffer.setChunkNumber(ChunkNumber(sequenceData.chunkNumber));
     tupleBuffer.setLastChunk(sequenceData.lastChunk);
     tupleBuffer.setWatermark(windowInfo.windowStart);
-    tupleBuffer.setNumberOfTuples(totalNumberOfTuples);
+    tupleBuffer.setNumberOfTuples(symmetric ? 0 : totalNumberOfTuples);
     tupleBuffer.setCreationTimestampInMS(Timestamp(
         std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
 
@@ -175,4 +184,32 @@ void HJOperatorHandler::emitSlicesToProbe(
         rightHashMaps.size());
 }
 
+void HJOperatorHandler::emitEagerJoinResults(TupleBuffer& resultBuffer, PipelineExecutionContext* pipelineCtx) const
+{
+    /// The watermark must not be larger than the start of any window that has not been triggered yet. As the symmetric hash join only
+    /// supports tumbling windows, the window containing the current watermark is the oldest window that can still receive tuples.
+    /// Reading the watermark and taking the sequence number in one step keeps the watermarks in the order of the sequence numbers.
+    const auto windowSize = sliceAndWindowStore->getWindowSize();
+    const auto [sequenceNumber, watermark] = sliceAndWindowStore->getNextSequenceNumberAndWatermark(
+        [this, windowSize]
+        {
+            const auto currentWatermark = watermarkProcessorBuild->getCurrentWatermark().getRawValue();
+            return Timestamp(currentWatermark - (currentWatermark % windowSize));
+        });
+    resultBuffer.setOriginId(outputOriginId);
+    resultBuffer.setSequenceNumber(sequenceNumber);
+    resultBuffer.setChunkNumber(INITIAL<ChunkNumber>);
+    resultBuffer.setLastChunk(true);
+    resultBuffer.setWatermark(watermark);
+    resultBuffer.setCreationTimestampInMS(Timestamp(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count()));
+    pipelineCtx->emitBuffer(resultBuffer);
+    NES_TRACE(
+        "Emitted {} eagerly joined records with watermarkTs {} sequenceNumber {} originId {}",
+        resultBuffer.getNumberOfTuples(),
+        resultBuffer.getWatermark(),
+        resultBuffer.getSequenceNumber(),
+        resultBuffer.getOriginId());
+}
+
 }
@@ -15,6 +15,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <Functions/PhysicalFunction.hpp>
 #include <Join/HashJoin/HJOperatorHandler.hpp>
@@ -49,12 +50,14 @@ HJProbePhysicalOperator::HJProbePhysicalOperator(
     std::shared_ptr<TupleBufferRef> leftBufferRef,
     std::shared_ptr<TupleBufferRef> rightBufferRef,
     HashMapOptions leftHashMapBasedOptions,
-    HashMapOptions rightHashMapBasedOptions)
+    HashMapOptions rightHashMapBasedOptions,
+    std::optional<std::shared_ptr<TupleBufferRef>> symmetricResultBufferRef)
     : StreamJoinProbePhysicalOperator(operatorHandlerId, std::move(joinFunction), std::move(windowMetaData), std::move(joinSchema))
     , leftBufferRef(std::move(leftBufferRef))
     , rightBufferRef(std::move(rightBufferRef))
     , leftHashMapOptions(std::move(leftHashMapBasedOptions))
     , rightHashMapOptions(std::move(rightHashMapBasedOptions))
+    , symmetricResultBufferRef(std::move(symmetricResultBufferRef))
 {
 }
 
@@ -69,6 +72,20 @@ void HJProbePhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer&
     executionCtx.originId = recordBuffer.getOriginId();
     StreamJoinProbePhysicalOperator::open(executionCtx, recordBuffer);
 
+    if (symmetricResultBufferRef.has_value())
+    {
+        /// The buffers of triggered windows contain no records, as the build has already emitted all joined records of the window
+        const auto& resultBufferRef = symmetricResultBufferRef.value();
+        const auto projections = resultBufferRef->getAllFieldNames();
+        const auto numberOfRecords = recordBuffer.getNumRecords();
+        for (nautilus::val<uint64_t> recordIndex = 0; recordIndex < numberOfRecords; ++recordIndex)
+        {
+            auto joinedRecord = resultBufferRef->readRecord(projections, recordBuffer, recordIndex);
+            executeChild(executionCtx, joinedRecord);
+        }
+        return;
+    }
+
     /// Getting number of hash maps and return if there are no hashmaps
     const auto hashJoinWindowRef = static_cast<nautilus::val<EmittedHJWindowTrigger*>>(recordBuffer.getMemArea());
     const auto leftNumberOfHashMaps
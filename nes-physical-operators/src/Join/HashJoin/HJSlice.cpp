@@ -15,11 +15,11 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Join/StreamJoinUtil.hpp>
-#include <Nautilus/Interface/HashMap/ChainedHashMap/ChainedHashMap.hpp>
 #include <Nautilus/Interface/HashMap/HashMap.hpp>
 #include <SliceStore/Slice.hpp>
 #include <ErrorHandling.hpp>
@@ -30,6 +30,8 @@ namespace NES
 HJSlice::HJSlice(
     SliceStart sliceStart, SliceEnd sliceEnd, const CreateNewHashMapSliceArgs& createNewHashMapSliceArgs, const uint64_t numberOfHashMaps)
     : HashMapSlice(std::move(sliceStart), std::move(sliceEnd), createNewHashMapSliceArgs, numberOfHashMaps, 2)
+    , stagedTuplesPerWorkerThread(numberOfHashMapsPerInputStream)
+    , symmetricJoinPairsPerWorkerThread(numberOfHashMapsPerInputStream)
 {
 }
 
@@ -64,11 +66,7 @@ HashMap* HJSlice::getHashMapPtrOrCreate(const WorkerThreadId workerThreadId, con
     if (hashMaps.at(pos) == nullptr)
     {
         /// Hashmap at pos has not been initialized
-        hashMaps.at(pos) = std::make_unique<ChainedHashMap>(
-            createNewHashMapSliceArgs.keySize,
-            createNewHashMapSliceArgs.valueSize,
-            createNewHashMapSliceArgs.numberOfBuckets,
-            createNewHashMapSliceArgs.pageSize);
+        hashMaps.at(pos) = createHashMap();
     }
     return hashMaps.at(pos).get();
 }
@@ -78,4 +76,49 @@ uint64_t HJSlice::getNumberOfHashMapsForSide() const
     return numberOfHashMapsPerInputStream;
 }
 
+void HJSlice::stageSymmetric(const WorkerThreadId workerThreadId, const uint64_t hash, SymmetricJoinTuple tuple)
+{
+    auto& stagedTuples = stagedTuplesPerWorkerThread.at(workerThreadId % numberOfHashMapsPerInputStream);
+    stagedTuples[hash % NUMBER_OF_SYMMETRIC_JOIN_PARTITIONS].emplace(hash, std::move(tuple));
+}
+
+uint64_t HJSlice::publishAndProbeSymmetric(const WorkerThreadId workerThreadId, const JoinBuildSideType buildSide)
+{
+    const auto side = static_cast<uint64_t>(buildSide == JoinBuildSideType::Right);
+    auto& stagedTuples = stagedTuplesPerWorkerThread.at(workerThreadId % numberOfHashMapsPerInputStream);
+    auto& pairs = symmetricJoinPairsPerWorkerThread.at(workerThreadId % numberOfHashMapsPerInputStream);
+    pairs.clear();
+
+    for (uint64_t partitionIdx = 0; partitionIdx < NUMBER_OF_SYMMETRIC_JOIN_PARTITIONS; ++partitionIdx)
+    {
+        auto& stagedTuplesOfPartition = stagedTuples[partitionIdx];
+        if (stagedTuplesOfPartition.empty())
+        {
+            continue;
+        }
+
+        auto& partition = symmetricJoinPartitions[partitionIdx];
+        const std::scoped_lock lock(partition.mutex);
+        const auto& otherSideTuples = partition.publishedTuplesPerSide[1 - side];
+        for (const auto& [hash, tuple] : stagedTuplesOfPartition)
+        {
+            const auto [otherBegin, otherEnd] = otherSideTuples.equal_range(hash);
+            for (auto it = otherBegin; it != otherEnd; ++it)
+            {
+                pairs.emplace_back(&tuple, &it->second);
+            }
+        }
+        /// Merging moves the nodes instead of copying the tuples, thus, the collected pairs still point to the tuples afterward
+        partition.publishedTuplesPerSide[side].merge(stagedTuplesOfPartition);
+    }
+    return pairs.size();
+}
+
+const HJSlice::SymmetricJoinPair& HJSlice::getSymmetricJoinPair(const WorkerThreadId workerThreadId, const uint64_t pairIndex) const
+{
+    const auto& pairs = symmetricJoinPairsPerWorkerThread.at(workerThreadId % numberOfHashMapsPerInputStream);
+    INVARIANT(pairIndex < pairs.size(), "Pair {} does not exist, as there are {} pairs", pairIndex, pairs.size());
+    return pairs[pairIndex];
+}
+
 }
@@ -47,6 +47,18 @@ Record StreamJoinProbePhysicalOperator::createJoinedRecord(
     const nautilus::val<Timestamp>& windowEnd,
     const std::vector<Record::RecordFieldIdentifier>& projectionsOuter,
     const std::vector<Record::RecordFieldIdentifier>& projectionsInner) const
+{
+    return createJoinedRecord(windowMetaData, outerRecord, innerRecord, windowStart, windowEnd, projectionsOuter, projectionsInner);
+}
+
+Record StreamJoinProbePhysicalOperator::createJoinedRecord(
+    const WindowMetaData& windowMetaData,
+    const Record& outerRecord,
+    const Record& innerRecord,
+    const nautilus::val<Timestamp>& windowStart,
+    const nautilus::val<Timestamp>& windowEnd,
+    const std::vector<Record::RecordFieldIdentifier>& projectionsOuter,
+    const std::vector<Record::RecordFieldIdentifier>& projectionsInner)
 {
     Record joinedRecord;
 
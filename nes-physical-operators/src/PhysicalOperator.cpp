@@ -68,6 +68,16 @@ void PhysicalOperatorConcept::execute(ExecutionContext& executionCtx, Record& re
     executeChild(executionCtx, record);
 }
 
+void PhysicalOperatorConcept::executeOnRecords(ExecutionContext& executionCtx, const RecordBatch& records) const
+{
+    records.forEachRecord([&](Record& record) { execute(executionCtx, record); });
+}
+
+bool PhysicalOperatorConcept::hasProfileForRecompilation() const
+{
+    return false;
+}
+
 void PhysicalOperatorConcept::setupChild(ExecutionContext& executionCtx, CompilationContext& compilationContext) const
 {
     INVARIANT(getChild().has_value(), "Child operator is not set");
@@ -92,6 +102,12 @@ void PhysicalOperatorConcept::executeChild(ExecutionContext& executionCtx, Recor
     getChild().value().execute(executionCtx, record);
 }
 
+void PhysicalOperatorConcept::executeChildOnRecords(ExecutionContext& executionCtx, const RecordBatch& records) const
+{
+    INVARIANT(getChild().has_value(), "Child operator is not set");
+    getChild().value().executeOnRecords(executionCtx, records);
+}
+
 void PhysicalOperatorConcept::terminateChild(ExecutionContext& executionCtx) const
 {
     INVARIANT(getChild().has_value(), "Child operator is not set");
@@ -150,6 +166,16 @@ void PhysicalOperator::execute(ExecutionContext& executionCtx, Record& record) c
     self->execute(executionCtx, record);
 }
 
+void PhysicalOperator::executeOnRecords(ExecutionContext& executionCtx, const RecordBatch& records) const
+{
+    self->executeOnRecords(executionCtx, records);
+}
+
+bool PhysicalOperator::hasProfileForRecompilation() const
+{
+    return self->hasProfileForRecompilation();
+}
+
 std::string PhysicalOperator::toString() const
 {
     return self->toString();
@@ -21,6 +21,7 @@
 #include <utility>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Util/CompilationOptions.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <Util/QueryConsoleDumpHandler.hpp>
 #include <ErrorHandling.hpp>
@@ -33,8 +34,13 @@ PhysicalPlan::PhysicalPlan(
     QueryId id,
     std::vector<std::shared_ptr<PhysicalOperatorWrapper>> rootOperators,
     ExecutionMode executionMode,
+    CompilationOptions compilationOptions,
     uint64_t operatorBufferSize)
-    : queryId(id), rootOperators(std::move(rootOperators)), executionMode(executionMode), operatorBufferSize(operatorBufferSize)
+    : queryId(id)
+    , rootOperators(std::move(rootOperators))
+    , executionMode(executionMode)
+    , compilationOptions(compilationOptions)
+    , operatorBufferSize(operatorBufferSize)
 {
     for (const auto& rootOperator : this->rootOperators)
     {
@@ -68,6 +74,11 @@ ExecutionMode PhysicalPlan::getExecutionMode() const
     return executionMode;
 }
 
+CompilationOptions PhysicalPlan::getCompilationOptions() const
+{
+    return compilationOptions;
+}
+
 uint64_t PhysicalPlan::getOperatorBufferSize() const
 {
     return operatorBufferSize;
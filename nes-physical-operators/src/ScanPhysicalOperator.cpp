@@ -76,13 +76,26 @@ void ScanPhysicalOperator::open(ExecutionContext& executionCtx, RecordBuffer& re
     }
     /// call open on all child operators
     openChild(executionCtx, recordBuffer);
-    /// iterate over records in buffer
-    auto numberOfRecords = recordBuffer.getNumRecords();
-    for (nautilus::val<uint64_t> i = 0_u64; i < numberOfRecords; i = i + 1_u64)
-    {
-        auto record = bufferRef->readRecord(projections, recordBuffer, i);
-        executeChild(executionCtx, record);
-    }
+
+    /// The child receives all records of the buffer at once. Unless it overrides executeOnRecords, it executes each record on its own.
+    const auto numberOfRecords = recordBuffer.getNumRecords();
+    const RecordBatch records{
+        .numberOfRecords = numberOfRecords,
+        .readRecord = [this, &recordBuffer](nautilus::val<uint64_t>& recordIndex)
+        { return bufferRef->readRecordLazily(projections, recordBuffer, recordIndex); },
+        .forEachRecord =
+            [this, &recordBuffer, &numberOfRecords](const RecordBatch::RecordConsumer& consumer)
+        {
+            /// iterate over records in buffer. The cursor advances the field addresses by a constant stride instead of recomputing them per
+            /// record.
+            for (auto cursor = bufferRef->createCursor(recordBuffer, 0_u64); cursor.recordIndex < numberOfRecords; cursor.advance())
+            {
+                /// Fields are loaded at their first use, e.g., payload fields are only loaded for records that pass a selection
+                auto record = bufferRef->readRecordLazilyAtCursor(projections, recordBuffer, cursor);
+                consumer(record);
+            }
+        }};
+    executeChildOnRecords(executionCtx, records);
 }
 
 std::optional<PhysicalOperator> ScanPhysicalOperator::getChild() const
@@ -12,16 +12,64 @@
     limitations under the License.
 */
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <utility>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Util/SelectionStrategy.hpp>
+#include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
+#include <SelectionOperatorHandler.hpp>
 #include <SelectionPhysicalOperator.hpp>
+#include <SelectivityStatistics.hpp>
+#include <function.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
 
+namespace
+{
+bool shouldUsePredicationProxy(OperatorHandler* ptrOpHandler)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    const auto* opHandler = dynamic_cast<SelectionOperatorHandler*>(ptrOpHandler);
+    return SelectionPhysicalOperator::shouldUsePredication(opHandler->statistics);
+}
+
+void addObservationProxy(OperatorHandler* ptrOpHandler, const uint64_t numberOfRecords, const uint64_t numberOfSelectedRecords)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    auto* opHandler = dynamic_cast<SelectionOperatorHandler*>(ptrOpHandler);
+    opHandler->statistics.addObservation(numberOfRecords, numberOfSelectedRecords);
+}
+}
+
+SelectionPhysicalOperator::SelectionPhysicalOperator(PhysicalFunction function, const SelectionStrategy strategy)
+    : function(std::move(function)), strategy(strategy)
+{
+    PRECONDITION(strategy != SelectionStrategy::ADAPTIVE, "The adaptive selection requires an operator handler for its statistics");
+}
+
+SelectionPhysicalOperator::SelectionPhysicalOperator(
+    PhysicalFunction function,
+    const OperatorHandlerId operatorHandlerId,
+    std::shared_ptr<SelectionOperatorHandler> operatorHandler,
+    const bool specializeForProfile)
+    : function(std::move(function))
+    , strategy(SelectionStrategy::ADAPTIVE)
+    , operatorHandlerId(operatorHandlerId)
+    , operatorHandler(std::move(operatorHandler))
+    , specializeForProfile(specializeForProfile)
+{
+    PRECONDITION(this->operatorHandler != nullptr, "The adaptive selection requires an operator handler for its statistics");
+}
+
 void SelectionPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
 {
     /// evaluate function and call child operator if function is valid
@@ -31,6 +79,121 @@ void SelectionPhysicalOperator::execute(ExecutionContext& ctx, Record& record) c
     }
 }
 
+void SelectionPhysicalOperator::executeOnRecords(ExecutionContext& ctx, const RecordBatch& records) const
+{
+    switch (strategy)
+    {
+        case SelectionStrategy::BRANCHING: {
+            executeBranching(ctx, records);
+            return;
+        }
+        case SelectionStrategy::PREDICATED: {
+            executePredicated(ctx, records);
+            return;
+        }
+        case SelectionStrategy::ADAPTIVE: {
+            /// If the pipeline gets recompiled with the profile of prior buffers, we solely compile the variant that fits the observed
+            /// selectivity. Thus, the recompiled pipeline neither chooses a variant per buffer nor updates the statistics.
+            if (hasProfileForRecompilation())
+            {
+                if (shouldUsePredication(operatorHandler->statistics))
+                {
+                    executePredicated(ctx, records);
+                }
+                else
+                {
+                    executeBranching(ctx, records);
+                }
+                return;
+            }
+
+            /// Both variants are part of the compiled pipeline. We choose one of them per buffer, based on the selectivity of prior
+            /// buffers.
+            const auto globalOperatorHandler = ctx.getGlobalOperatorHandler(operatorHandlerId);
+            const auto usePredication = invoke(shouldUsePredicationProxy, globalOperatorHandler);
+
+            nautilus::val<uint64_t> numberOfSelectedRecords = 0;
+            if (usePredication)
+            {
+                numberOfSelectedRecords = executePredicated(ctx, records);
+            }
+            else
+            {
+                numberOfSelectedRecords = executeBranching(ctx, records);
+            }
+            invoke(addObservationProxy, globalOperatorHandler, records.numberOfRecords, numberOfSelectedRecords);
+            return;
+        }
+    }
+}
+
+bool SelectionPhysicalOperator::hasProfileForRecompilation() const
+{
+    return specializeForProfile and strategy == SelectionStrategy::ADAPTIVE
+        and operatorHandler->statistics.getNumberOfObservedRecords() >= MIN_NUMBER_OF_RECORDS_FOR_SPECIALIZATION;
+}
+
+uint64_t SelectionPhysicalOperator::getNumberOfObservedRecords() const
+{
+    return operatorHandler == nullptr ? 0 : operatorHandler->statistics.getNumberOfObservedRecords();
+}
+
+bool SelectionPhysicalOperator::shouldUsePredication(const SelectivityStatistics& statistics)
+{
+    const auto selectivity = statistics.getSelectivity();
+    return selectivity.has_value() and *selectivity >= MIN_SELECTIVITY_FOR_PREDICATION and *selectivity <= MAX_SELECTIVITY_FOR_PREDICATION;
+}
+
+nautilus::val<uint64_t> SelectionPhysicalOperator::executeBranching(ExecutionContext& ctx, const RecordBatch& records) const
+{
+    nautilus::val<uint64_t> numberOfSelectedRecords = 0;
+    records.forEachRecord(
+        [&](Record& record)
+        {
+            if (function.execute(record, ctx.pipelineMemoryProvider.arena))
+            {
+                numberOfSelectedRecords = numberOfSelectedRecords + 1;
+                executeChild(ctx, record);
+            }
+        });
+    return numberOfSelectedRecords;
+}
+
+nautilus::val<uint64_t> SelectionPhysicalOperator::executePredicated(ExecutionContext& ctx, const RecordBatch& records) const
+{
+    const auto& numberOfRecords = records.numberOfRecords;
+    const auto selectionVector = ctx.allocateMemory(SELECTION_VECTOR_SIZE * sizeof(uint64_t));
+    nautilus::val<uint64_t> numberOfSelectedRecords = 0;
+    for (nautilus::val<uint64_t> blockStart = 0; blockStart < numberOfRecords; blockStart = blockStart + SELECTION_VECTOR_SIZE)
+    {
+        nautilus::val<uint64_t> blockEnd = blockStart + SELECTION_VECTOR_SIZE;
+        if (blockEnd > numberOfRecords)
+        {
+            blockEnd = numberOfRecords;
+        }
+
+        /// Every record index gets written to the selection vector, but the number of selected records only advances if the predicate
+        /// holds. Thus, the following index overwrites the index of a record that did not pass the predicate.
+        nautilus::val<uint64_t> numberOfSelectedInBlock = 0;
+        for (nautilus::val<uint64_t> i = blockStart; i < blockEnd; i = i + 1)
+        {
+            auto record = records.readRecord(i);
+            const auto selected = function.execute(record, ctx.pipelineMemoryProvider.arena).cast<nautilus::val<bool>>();
+            *static_cast<nautilus::val<uint64_t*>>(selectionVector + numberOfSelectedInBlock * sizeof(uint64_t)) = i;
+            numberOfSelectedInBlock = numberOfSelectedInBlock + static_cast<nautilus::val<uint64_t>>(selected);
+        }
+
+        for (nautilus::val<uint64_t> i = 0; i < numberOfSelectedInBlock; i = i + 1)
+        {
+            auto recordIndex = readValueFromMemRef<uint64_t>(selectionVector + i * sizeof(uint64_t));
+            auto record = records.readRecord(recordIndex);
+            executeChild(ctx, record);
+        }
+        numberOfSelectedRecords = numberOfSelectedRecords + numberOfSelectedInBlock;
+    }
+    return numberOfSelectedRecords;
+}
+
 std::optional<PhysicalOperator> SelectionPhysicalOperator::getChild() const
 {
     return child;
@@ -0,0 +1,57 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SelectivityStatistics.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+namespace NES
+{
+
+void SelectivityStatistics::addObservation(const uint64_t numberOfRecords, const uint64_t numberOfSelectedRecords)
+{
+    auto current = counters.load(std::memory_order::relaxed);
+    uint64_t updated = 0;
+    do
+    {
+        auto observedRecords = (current >> COUNTER_BITS) + numberOfRecords;
+        auto selectedRecords = (current & COUNTER_MASK) + numberOfSelectedRecords;
+        while (observedRecords > MAX_NUMBER_OF_OBSERVED_RECORDS or selectedRecords > MAX_NUMBER_OF_OBSERVED_RECORDS)
+        {
+            observedRecords /= 2;
+            selectedRecords /= 2;
+        }
+        updated = (observedRecords << COUNTER_BITS) | selectedRecords;
+    } while (not counters.compare_exchange_weak(current, updated, std::memory_order::relaxed));
+}
+
+uint64_t SelectivityStatistics::getNumberOfObservedRecords() const
+{
+    return counters.load(std::memory_order::relaxed) >> COUNTER_BITS;
+}
+
+std::optional<double> SelectivityStatistics::getSelectivity() const
+{
+    const auto current = counters.load(std::memory_order::relaxed);
+    const auto observedRecords = current >> COUNTER_BITS;
+    if (observedRecords == 0)
+    {
+        return std::nullopt;
+    }
+    return static_cast<double>(current & COUNTER_MASK) / static_cast<double>(observedRecords);
+}
+
+}
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <optional>
@@ -35,9 +36,26 @@
 
 namespace NES
 {
-DefaultTimeBasedSliceStore::DefaultTimeBasedSliceStore(const uint64_t windowSize, const uint64_t windowSlide)
-    : sliceAssigner(windowSize, windowSlide), sequenceNumber(SequenceNumber::INITIAL), numberOfActiveInputPipelines(0)
+DefaultTimeBasedSliceStore::DefaultTimeBasedSliceStore(
+    const uint64_t windowSize, const uint64_t windowSlide, const uint64_t maxWindowsPerSequenceNumber, const uint64_t maxSliceSize)
+    : sliceAssigner(windowSize, windowSlide, maxSliceSize)
+    , sequenceNumber(SequenceNumber::INITIAL)
+    , maxWindowsPerSequenceNumber(maxWindowsPerSequenceNumber)
+    , numberOfActiveInputPipelines(0)
 {
+    PRECONDITION(maxWindowsPerSequenceNumber > 0, "At least one window must be triggered per sequence number");
+}
+
+SequenceNumber DefaultTimeBasedSliceStore::getSequenceNumberForNextWindow(uint64_t& numberOfWindowsWithCurrentSequenceNumber)
+{
+    /// As the windows are sorted and the windows lock is held, all windows of a sequence number are consecutive
+    if (numberOfWindowsWithCurrentSequenceNumber == 0 or numberOfWindowsWithCurrentSequenceNumber == maxWindowsPerSequenceNumber)
+    {
+        numberOfWindowsWithCurrentSequenceNumber = 1;
+        return SequenceNumber(sequenceNumber++);
+    }
+    ++numberOfWindowsWithCurrentSequenceNumber;
+    return SequenceNumber(sequenceNumber.load() - 1);
 }
 
 DefaultTimeBasedSliceStore::~DefaultTimeBasedSliceStore()
@@ -104,6 +122,7 @@ DefaultTimeBasedSliceStore::getTriggerableWindowSlices(const Timestamp globalWat
     /// We are iterating over all windows and check if they can be triggered
     /// A window can be triggered if all sides have been filled and the window end is smaller than the new global watermark
     std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> windowsToSlices;
+    uint64_t numberOfWindowsWithCurrentSequenceNumber = 0;
     for (auto& [windowInfo, windowSlicesAndState] : *windowsWriteLocked)
     {
         if (windowInfo.windowEnd >= globalWatermark)
@@ -119,7 +138,7 @@ DefaultTimeBasedSliceStore::getTriggerableWindowSlices(const Timestamp globalWat
 
         windowSlicesAndState.windowState = WindowInfoState::EMITTED_TO_PROBE;
         /// As the windows are sorted, we can simply increment the sequence number here.
-        const auto newSequenceNumber = SequenceNumber(sequenceNumber++);
+        const auto newSequenceNumber = getSequenceNumberForNextWindow(numberOfWindowsWithCurrentSequenceNumber);
         for (auto& slice : windowSlicesAndState.windowSlices)
         {
             windowsToSlices[{windowInfo, newSequenceNumber}].emplace_back(slice);
@@ -128,6 +147,39 @@ DefaultTimeBasedSliceStore::getTriggerableWindowSlices(const Timestamp globalWat
     return windowsToSlices;
 }
 
+std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>
+DefaultTimeBasedSliceStore::getProvisionalWindowSlices(const Timestamp globalWatermark)
+{
+    /// Same as for triggering windows, we skip the provisional results if we can not acquire the lock
+    const auto windowsWriteLocked = windows.tryWLock();
+    if (windowsWriteLocked.isNull())
+    {
+        return {};
+    }
+
+    std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> windowsToSlices;
+    uint64_t numberOfWindowsWithCurrentSequenceNumber = 0;
+    for (const auto& [windowInfo, windowSlicesAndState] : *windowsWriteLocked)
+    {
+        if (windowSlicesAndState.windowState != WindowInfoState::WINDOW_FILLING)
+        {
+            continue;
+        }
+
+        std::vector<std::shared_ptr<Slice>> completedSlices;
+        std::ranges::copy_if(
+            windowSlicesAndState.windowSlices,
+            std::back_inserter(completedSlices),
+            [globalWatermark](const auto& slice) { return slice->getSliceEnd() <= globalWatermark; });
+        if (not completedSlices.empty())
+        {
+            const auto newSequenceNumber = getSequenceNumberForNextWindow(numberOfWindowsWithCurrentSequenceNumber);
+            windowsToSlices.emplace(WindowInfoAndSequenceNumber{windowInfo, newSequenceNumber}, std::move(completedSlices));
+        }
+    }
+    return windowsToSlices;
+}
+
 std::optional<std::shared_ptr<Slice>> DefaultTimeBasedSliceStore::getSliceBySliceEnd(const SliceEnd sliceEnd)
 {
     if (const auto slicesReadLocked = slices.rlock(); slicesReadLocked->contains(sliceEnd))
@@ -149,9 +201,11 @@ std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> Defau
 
     /// Creating a lambda to add all slices to the return map windowsToSlices
     std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> windowsToSlices;
-    auto addAllSlicesToReturnMap = [&windowsToSlices, this](const WindowInfo& windowInfo, SlicesAndState& windowSlicesAndState)
+    uint64_t numberOfWindowsWithCurrentSequenceNumber = 0;
+    auto addAllSlicesToReturnMap = [&windowsToSlices, &numberOfWindowsWithCurrentSequenceNumber, this](
+                                       const WindowInfo& windowInfo, SlicesAndState& windowSlicesAndState)
     {
-        const auto newSequenceNumber = SequenceNumber(sequenceNumber++);
+        const auto newSequenceNumber = getSequenceNumberForNextWindow(numberOfWindowsWithCurrentSequenceNumber);
         for (auto& slice : windowSlicesAndState.windowSlices)
         {
             windowsToSlices[{windowInfo, newSequenceNumber}].emplace_back(slice);
@@ -199,6 +253,23 @@ std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>> Defau
     return windowsToSlices;
 }
 
+SequenceNumberAndWatermark DefaultTimeBasedSliceStore::getNextSequenceNumberAndWatermark(const std::function<Timestamp()>& readWatermark)
+{
+    /// Acquiring the windows lock, as all windows that share a sequence number must get consecutive sequence numbers
+    const auto windowsWriteLocked = windows.wlock();
+    auto watermark = readWatermark();
+    for (const auto& [windowInfo, windowSlicesAndState] : *windowsWriteLocked)
+    {
+        /// The windows that have not been triggered yet get larger sequence numbers and their window start as the watermark
+        if (windowSlicesAndState.windowState != WindowInfoState::EMITTED_TO_PROBE)
+        {
+            watermark = std::min(watermark, windowInfo.windowStart);
+            break;
+        }
+    }
+    return {SequenceNumber(sequenceNumber++), watermark};
+}
+
 void DefaultTimeBasedSliceStore::garbageCollectSlicesAndWindows(const Timestamp newGlobalWaterMark)
 {
     std::vector<std::shared_ptr<Slice>> slicesToDelete;
@@ -0,0 +1,65 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <UnionOperatorHandler.hpp>
+
+#include <cstdint>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Runtime/QueryTerminationType.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+UnionOperatorHandler::UnionOperatorHandler(const std::vector<OriginId>& inputOrigins, const OriginId outputOriginId)
+    : outputOriginId(outputOriginId), watermarkProcessor(inputOrigins)
+{
+    PRECONDITION(not inputOrigins.empty(), "A union requires at least one input origin");
+}
+
+MergedBufferMetaData
+UnionOperatorHandler::mergeBuffer(const Timestamp watermarkTs, const SequenceData sequenceData, const OriginId originId)
+{
+    const auto lockedState = mergeState.wlock();
+    const auto sequenceNumber = lockedState->nextSequenceNumber++;
+    const auto mergedWatermarkTs = watermarkProcessor.updateWatermark(watermarkTs, sequenceData, originId);
+    NES_TRACE(
+        "Union re-stamped buffer {} of origin {} to sequence number {} of origin {} with watermark {}",
+        sequenceData,
+        originId,
+        sequenceNumber,
+        outputOriginId,
+        mergedWatermarkTs);
+    return {.sequenceNumber = sequenceNumber, .watermarkTs = mergedWatermarkTs.getRawValue()};
+}
+
+OriginId UnionOperatorHandler::getOutputOriginId() const
+{
+    return outputOriginId;
+}
+
+void UnionOperatorHandler::start(PipelineExecutionContext&, uint32_t)
+{
+}
+
+void UnionOperatorHandler::stop(QueryTerminationType, PipelineExecutionContext&)
+{
+}
+
+}
@@ -12,15 +12,78 @@
     limitations under the License.
 */
 
+
 #include <optional>
 #include <utility>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/DataTypes/DataTypesUtil.hpp>
+#include <Nautilus/Interface/NESStrongTypeRef.hpp>
 #include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Nautilus/Interface/TimestampRef.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <Time/Timestamp.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
+#include <UnionOperatorHandler.hpp>
 #include <UnionPhysicalOperator.hpp>
+#include <function.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
 
 namespace NES
 {
 
+namespace
+{
+void mergeBufferProxy(
+    OperatorHandler* ptrOpHandler,
+    MergedBufferMetaData* mergedMetaData,
+    const Timestamp watermarkTs,
+    const SequenceNumber sequenceNumber,
+    const ChunkNumber chunkNumber,
+    const bool lastChunk,
+    const OriginId originId)
+{
+    PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
+    PRECONDITION(mergedMetaData != nullptr, "Expects memory for the merged buffer metadata");
+
+    auto* opHandler = dynamic_cast<UnionOperatorHandler*>(ptrOpHandler);
+    *mergedMetaData = opHandler->mergeBuffer(watermarkTs, SequenceData(sequenceNumber, chunkNumber, lastChunk), originId);
+}
+}
+
+UnionPhysicalOperator::UnionPhysicalOperator(const OperatorHandlerId operatorHandlerId, const OriginId outputOriginId)
+    : operatorHandlerId(operatorHandlerId), outputOriginId(outputOriginId)
+{
+}
+
+void UnionPhysicalOperator::open(ExecutionContext& ctx, RecordBuffer& recordBuffer) const
+{
+    /// Re-stamps the input buffer before any downstream operator reads the buffer metadata from the execution context
+    const auto mergedMetaDataRef = static_cast<nautilus::val<MergedBufferMetaData*>>(ctx.allocateMemory(sizeof(MergedBufferMetaData)));
+    nautilus::invoke(
+        mergeBufferProxy,
+        ctx.getGlobalOperatorHandler(operatorHandlerId),
+        mergedMetaDataRef,
+        ctx.watermarkTs,
+        ctx.sequenceNumber,
+        ctx.chunkNumber,
+        ctx.lastChunk,
+        ctx.originId);
+
+    /// Every input buffer is a sequence of its own on the output origin. Thus, it consists of a single chunk.
+    ctx.originId = outputOriginId;
+    ctx.sequenceNumber = readValueFromMemRef<uint64_t>(getMemberRef(mergedMetaDataRef, &MergedBufferMetaData::sequenceNumber));
+    ctx.watermarkTs
+        = nautilus::val<Timestamp>(readValueFromMemRef<uint64_t>(getMemberRef(mergedMetaDataRef, &MergedBufferMetaData::watermarkTs)));
+    ctx.chunkNumber = ChunkNumber(ChunkNumber::INITIAL);
+    ctx.lastChunk = true;
+    openChild(ctx, recordBuffer);
+}
+
 void UnionPhysicalOperator::execute(ExecutionContext& ctx, Record& record) const
 {
     /// Path-through, will be optimized out during query compilation
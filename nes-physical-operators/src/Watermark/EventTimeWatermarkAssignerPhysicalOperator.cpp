@@ -13,6 +13,7 @@
 */
 #include <Watermark/EventTimeWatermarkAssignerPhysicalOperator.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -26,6 +27,7 @@
 #include <ExecutionContext.hpp>
 #include <OperatorState.hpp>
 #include <PhysicalOperator.hpp>
+#include <val.hpp>
 
 namespace NES
 {
@@ -51,6 +53,44 @@ void EventTimeWatermarkAssignerPhysicalOperator::execute(ExecutionContext& ctx,
     executeChild(ctx, record);
 }
 
+void EventTimeWatermarkAssignerPhysicalOperator::executeOnRecords(ExecutionContext& ctx, const RecordBatch& records) const
+{
+    const auto maxTs = timeFunction.getMaxTs(ctx, records.numberOfRecords, records.readRecord);
+    if (maxTs > ctx.watermarkTs)
+    {
+        ctx.watermarkTs = maxTs;
+    }
+
+    /// The child still requires the current ts of each record, as, e.g., the emit uses it as creation ts
+    const RecordBatch recordsWithTs{
+        .numberOfRecords = records.numberOfRecords,
+        .readRecord =
+            [&](nautilus::val<uint64_t>& recordIndex)
+        {
+            auto record = records.readRecord(recordIndex);
+            timeFunction.getTs(ctx, record);
+            return record;
+        },
+        .forEachRecord =
+            [&](const RecordBatch::RecordConsumer& consumer)
+        {
+            records.forEachRecord(
+                [&](Record& record)
+                {
+                    timeFunction.getTs(ctx, record);
+                    consumer(record);
+                });
+        }};
+    executeChildOnRecords(ctx, recordsWithTs);
+
+    /// The child might read the records out of order. Thus, we restore the current ts of the last record of the buffer afterward.
+    if (records.numberOfRecords > 0)
+    {
+        nautilus::val<uint64_t> lastRecordIndex = records.numberOfRecords - 1;
+        recordsWithTs.readRecord(lastRecordIndex);
+    }
+}
+
 void EventTimeWatermarkAssignerPhysicalOperator::close(ExecutionContext& executionCtx, RecordBuffer& recordBuffer) const
 {
     PhysicalOperatorConcept::close(executionCtx, recordBuffer);
@@ -12,6 +12,8 @@
     limitations under the License.
 */
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -29,12 +31,34 @@
 namespace NES
 {
 
-MultiOriginWatermarkProcessor::MultiOriginWatermarkProcessor(const std::vector<OriginId>& origins) : origins(origins)
+MultiOriginWatermarkProcessor::MultiOriginWatermarkProcessor(const std::vector<OriginId>& origins)
+    : origins(origins), numberOfLeaves(std::bit_ceil(std::max<size_t>(origins.size(), 1))), tournamentTree(2 * numberOfLeaves)
 {
     for (const auto& _ : origins)
     {
         watermarkProcessors.emplace_back(std::make_shared<Sequencing::NonBlockingMonotonicSeqQueue<uint64_t>>());
     }
+
+    uint64_t maxRawOriginId = 0;
+    for (const auto& origin : origins)
+    {
+        maxRawOriginId = std::max(maxRawOriginId, origin.getRawValue());
+    }
+    originIndexes.resize(maxRawOriginId + 1, NO_ORIGIN_INDEX);
+    for (size_t originIndex = 0; originIndex < origins.size(); ++originIndex)
+    {
+        originIndexes[origins[originIndex].getRawValue()] = static_cast<uint32_t>(originIndex);
+    }
+
+    /// All origins start with a watermark of 0, while unused leaves must never be the minimum.
+    for (size_t leaf = 0; leaf < numberOfLeaves; ++leaf)
+    {
+        tournamentTree[numberOfLeaves + leaf].store(leaf < origins.size() ? 0 : UINT64_MAX);
+    }
+    for (size_t node = numberOfLeaves - 1; node > 0; --node)
+    {
+        tournamentTree[node].store(std::min(tournamentTree[2 * node].load(), tournamentTree[(2 * node) + 1].load()));
+    }
 };
 
 std::shared_ptr<MultiOriginWatermarkProcessor> MultiOriginWatermarkProcessor::create(const std::vector<OriginId>& origins)
@@ -42,23 +66,36 @@ std::shared_ptr<MultiOriginWatermarkProcessor> MultiOriginWatermarkProcessor::cr
     return std::make_shared<MultiOriginWatermarkProcessor>(origins);
 }
 
-Timestamp MultiOriginWatermarkProcessor::updateWatermark(Timestamp ts, SequenceData sequenceData, OriginId origin) const
+void MultiOriginWatermarkProcessor::raiseTo(std::atomic<uint64_t>& node, const uint64_t value)
 {
-    bool found = false;
-    for (size_t originIndex = 0; originIndex < origins.size(); ++originIndex)
+    auto current = node.load();
+    while (current < value && not node.compare_exchange_weak(current, value))
     {
-        if (origins[originIndex] == origin)
-        {
-            watermarkProcessors[originIndex]->emplace(sequenceData, ts.getRawValue());
-            found = true;
-        }
     }
+}
+
+Timestamp MultiOriginWatermarkProcessor::updateWatermark(Timestamp ts, SequenceData sequenceData, OriginId origin) const
+{
+    const auto rawOrigin = origin.getRawValue();
+    const auto originIndex = rawOrigin < originIndexes.size() ? originIndexes[rawOrigin] : NO_ORIGIN_INDEX;
     INVARIANT(
-        found,
+        originIndex != NO_ORIGIN_INDEX,
         "update watermark for non existing origin={} number of origins size={} ids={}",
         origin,
         origins.size(),
         fmt::join(origins, ","));
+
+    const auto& watermarkProcessor = watermarkProcessors[originIndex];
+    watermarkProcessor->emplace(sequenceData, ts.getRawValue());
+
+    /// Publishing the current watermark of the origin and recomputing the minimum on the path to the root.
+    /// We must recompute the whole path, as a concurrent update of a sibling might have read our leaf before we raised it.
+    auto node = numberOfLeaves + originIndex;
+    raiseTo(tournamentTree[node], watermarkProcessor->getCurrentValue());
+    for (node /= 2; node > 0; node /= 2)
+    {
+        raiseTo(tournamentTree[node], std::min(tournamentTree[2 * node].load(), tournamentTree[(2 * node) + 1].load()));
+    }
     return getCurrentWatermark();
 }
 
@@ -74,12 +111,7 @@ std::string MultiOriginWatermarkProcessor::getCurrentStatus()
 
 Timestamp MultiOriginWatermarkProcessor::getCurrentWatermark() const
 {
-    auto minimalWatermark = UINT64_MAX;
-    for (const auto& wt : watermarkProcessors)
-    {
-        minimalWatermark = std::min(minimalWatermark, wt->getCurrentValue());
-    }
-    return Timestamp(minimalWatermark);
+    return Timestamp(tournamentTree[1].load());
 }
 
 }
@@ -47,6 +47,22 @@ nautilus::val<Timestamp> EventTimeFunction::getTs(ExecutionContext& ctx, Record&
     return tsInMs;
 }
 
+nautilus::val<Timestamp>
+EventTimeFunction::getMaxTs(ExecutionContext& ctx, const nautilus::val<uint64_t>& numberOfRecords, const RecordReader& readRecord) const
+{
+    nautilus::val<uint64_t> maxTs = 0;
+    for (nautilus::val<uint64_t> i = 0; i < numberOfRecords; i = i + 1)
+    {
+        auto record = readRecord(i);
+        const auto ts = this->timestampFunction.execute(record, ctx.pipelineMemoryProvider.arena).cast<nautilus::val<uint64_t>>();
+        /// The difference is only added if the timestamp is larger. Otherwise, the (wrapped around) difference gets multiplied with zero.
+        maxTs = maxTs + static_cast<nautilus::val<uint64_t>>(ts > maxTs) * (ts - maxTs);
+    }
+
+    const auto timeMultiplier = nautilus::val<uint64_t>(unit.getMillisecondsConversionMultiplier());
+    return nautilus::val<Timestamp>(maxTs * timeMultiplier);
+}
+
 void IngestionTimeFunction::open(ExecutionContext& ctx, RecordBuffer& buffer) const
 {
     ctx.currentTs = buffer.getCreatingTs();
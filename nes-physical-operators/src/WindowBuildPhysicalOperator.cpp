@@ -13,6 +13,7 @@
 */
 #include <WindowBuildPhysicalOperator.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -40,13 +41,14 @@ void checkWindowsTriggerProxy(
     const SequenceNumber sequenceNumber,
     const ChunkNumber chunkNumber,
     const bool lastChunk,
-    const OriginId originId)
+    const OriginId originId,
+    const uint64_t numberOfTuples)
 {
     PRECONDITION(ptrOpHandler != nullptr, "opHandler context should not be null!");
     PRECONDITION(pipelineCtx != nullptr, "pipeline context should not be null");
 
     auto* opHandler = dynamic_cast<WindowBasedOperatorHandler*>(ptrOpHandler);
-    const BufferMetaData bufferMetaData(watermarkTs, SequenceData(sequenceNumber, chunkNumber, lastChunk), originId);
+    const BufferMetaData bufferMetaData(watermarkTs, SequenceData(sequenceNumber, chunkNumber, lastChunk), originId, numberOfTuples);
     opHandler->checkAndTriggerWindows(bufferMetaData, pipelineCtx);
 }
 
@@ -74,6 +76,9 @@ WindowBuildPhysicalOperator::WindowBuildPhysicalOperator(OperatorHandlerId opera
 
 void WindowBuildPhysicalOperator::close(ExecutionContext& executionCtx, RecordBuffer&) const
 {
+    /// The number of records in the buffer might differ from the number of built records, e.g., if a selection precedes the build
+    auto* const localState = dynamic_cast<WindowOperatorBuildLocalState*>(executionCtx.getLocalState(id));
+
     /// Update the watermark for the nlj operator and trigger slices
     auto operatorHandlerMemRef = executionCtx.getGlobalOperatorHandler(operatorHandlerId);
     invoke(
@@ -84,7 +89,8 @@ void WindowBuildPhysicalOperator::close(ExecutionContext& executionCtx, RecordBu
         executionCtx.sequenceNumber,
         executionCtx.chunkNumber,
         executionCtx.lastChunk,
-        executionCtx.originId);
+        executionCtx.originId,
+        localState->numberOfBuiltRecords);
 }
 
 void WindowBuildPhysicalOperator::setup(ExecutionContext& executionCtx, CompilationContext&) const
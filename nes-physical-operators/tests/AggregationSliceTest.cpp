@@ -0,0 +1,122 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Aggregation/AggregationSlice.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <optional>
+#include <Nautilus/Interface/HashMap/HashMap.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Util/AggregationSliceLayout.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <Arena.hpp>
+#include <BaseUnitTest.hpp>
+#include <HashMapSlice.hpp>
+
+namespace NES
+{
+
+/// Checks that the partitions of a slice with the shared layout are locked until their lock is released, also if an arena holds the lock
+class AggregationSliceTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_PARTITIONS = 4;
+    /// The partition is chosen by the upper 32 bits of the key hash
+    static constexpr uint64_t KEY_HASH_PARTITION_ZERO = 0;
+    static constexpr uint64_t OTHER_KEY_HASH_PARTITION_ZERO = 42;
+    static constexpr uint64_t KEY_HASH_PARTITION_ONE = 1UL << 32;
+    static constexpr auto BLOCKED_TIMEOUT = std::chrono::milliseconds(100);
+    static constexpr auto NOT_BLOCKED_TIMEOUT = std::chrono::seconds(10);
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("AggregationSliceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup AggregationSliceTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        /// The cleanup function is only called for hashmaps containing tuples, which the tests do not insert
+        const CreateNewHashMapSliceArgs hashMapSliceArgs{{nullptr}, 8, 8, 4096, 64};
+        slice = std::make_unique<AggregationSlice>(
+            SliceStart(0), SliceEnd(10), hashMapSliceArgs, NUMBER_OF_PARTITIONS, AggregationSliceLayout::SHARED);
+    }
+
+    void TearDown() override
+    {
+        slice.reset();
+        BaseUnitTest::TearDown();
+    }
+
+    /// Locks the partition of the key hash in another thread and releases the lock directly afterward
+    [[nodiscard]] std::future<HashMap*> lockSharedPartitionAsync(const uint64_t keyHash) const
+    {
+        return std::async(std::launch::async, [this, keyHash] { return slice->lockSharedPartition(keyHash).hashMap; });
+    }
+
+    std::unique_ptr<AggregationSlice> slice;
+};
+
+TEST_F(AggregationSliceTest, createsHashMapOncePerPartition)
+{
+    HashMap* hashMapPartitionZero = slice->lockSharedPartition(KEY_HASH_PARTITION_ZERO).hashMap;
+    ASSERT_NE(hashMapPartitionZero, nullptr);
+    EXPECT_EQ(slice->lockSharedPartition(OTHER_KEY_HASH_PARTITION_ZERO).hashMap, hashMapPartitionZero);
+
+    HashMap* hashMapPartitionOne = slice->lockSharedPartition(KEY_HASH_PARTITION_ONE).hashMap;
+    ASSERT_NE(hashMapPartitionOne, nullptr);
+    EXPECT_NE(hashMapPartitionOne, hashMapPartitionZero);
+}
+
+TEST_F(AggregationSliceTest, blocksOtherThreadsUntilLockOfPartitionIsReleased)
+{
+    std::optional lockedPartition = slice->lockSharedPartition(KEY_HASH_PARTITION_ZERO);
+    ASSERT_TRUE(lockedPartition->lock.owns_lock());
+
+    /// Other partitions can be locked, while the partition of the key hash is locked
+    auto otherPartition = lockSharedPartitionAsync(KEY_HASH_PARTITION_ONE);
+    ASSERT_EQ(otherPartition.wait_for(NOT_BLOCKED_TIMEOUT), std::future_status::ready);
+    EXPECT_NE(otherPartition.get(), lockedPartition->hashMap);
+
+    auto samePartition = lockSharedPartitionAsync(OTHER_KEY_HASH_PARTITION_ZERO);
+    EXPECT_EQ(samePartition.wait_for(BLOCKED_TIMEOUT), std::future_status::timeout);
+
+    auto* const hashMap = lockedPartition->hashMap;
+    lockedPartition.reset();
+    ASSERT_EQ(samePartition.wait_for(NOT_BLOCKED_TIMEOUT), std::future_status::ready);
+    EXPECT_EQ(samePartition.get(), hashMap);
+}
+
+TEST_F(AggregationSliceTest, destroyingArenaReleasesHeldLockOfPartition)
+{
+    auto arena = std::make_unique<Arena>(nullptr);
+    arena->heldLocks.emplace_back(slice->lockSharedPartition(KEY_HASH_PARTITION_ZERO).lock);
+
+    auto samePartition = lockSharedPartitionAsync(KEY_HASH_PARTITION_ZERO);
+    EXPECT_EQ(samePartition.wait_for(BLOCKED_TIMEOUT), std::future_status::timeout);
+
+    /// Destroying the arena, e.g., while unwinding after a failed pipeline invocation, must release the lock
+    arena.reset();
+    ASSERT_EQ(samePartition.wait_for(NOT_BLOCKED_TIMEOUT), std::future_status::ready);
+    EXPECT_NE(samePartition.get(), nullptr);
+}
+
+}
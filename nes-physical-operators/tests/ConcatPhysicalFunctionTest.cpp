@@ -0,0 +1,96 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Functions/ConcatPhysicalFunction.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <Functions/ConstantValueVariableSizePhysicalFunction.hpp>
+#include <Functions/PhysicalFunction.hpp>
+#include <Nautilus/DataTypes/VariableSizedData.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <Arena.hpp>
+#include <BaseUnitTest.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+/// Checks that nested concats are folded into one concat, which allocates its result once with the final size
+class ConcatPhysicalFunctionTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("ConcatPhysicalFunctionTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup ConcatPhysicalFunctionTest class.");
+    }
+
+    static PhysicalFunction constant(const std::string_view value)
+    {
+        return ConstantValueVariableSizePhysicalFunction(reinterpret_cast<const int8_t*>(value.data()), value.size()); ///NOLINT
+    }
+
+    static std::byte* getRawPointer(const nautilus::val<int8_t*>& pointer)
+    {
+        return reinterpret_cast<std::byte*>(nautilus::details::RawValueResolver<int8_t*>::getRawValue(pointer)); ///NOLINT
+    }
+
+    /// Executes the function and checks that the result is the only memory that it has allocated from the arena
+    void expectSingleAllocation(const PhysicalFunction& function, const std::string_view expectedContent) const
+    {
+        Arena arena(bufferManager);
+        ArenaRef arenaRef(nautilus::val<Arena*>(&arena));
+        const auto result = function.execute(Record{}, arenaRef).cast<VariableSizedData>();
+        const auto contentSize = nautilus::details::RawValueResolver<uint32_t>::getRawValue(result.getContentSize());
+        const auto* const content = reinterpret_cast<const char*>(getRawPointer(result.getContent())); ///NOLINT
+        EXPECT_EQ(std::string_view(content, contentSize), expectedContent);
+
+        /// The result starts at the beginning of the arena and the next allocation directly follows the result
+        ASSERT_EQ(arena.fixedSizeBuffers.size(), 1);
+        auto* const resultStart = getRawPointer(result.getReference());
+        EXPECT_EQ(resultStart, arena.fixedSizeBuffers.front().getAvailableMemoryArea().data());
+        EXPECT_EQ(getRawPointer(arenaRef.allocateMemory(nautilus::val<size_t>(0))), resultStart + sizeof(uint32_t) + contentSize);
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(4096, 4);
+};
+
+TEST_F(ConcatPhysicalFunctionTest, foldsLeftDeepConcats)
+{
+    const ConcatPhysicalFunction innerConcat(ConcatPhysicalFunction(constant("ab"), constant("cd")), constant("ef"));
+    expectSingleAllocation(ConcatPhysicalFunction(innerConcat, constant("gh")), "abcdefgh");
+}
+
+TEST_F(ConcatPhysicalFunctionTest, foldsRightDeepAndBalancedConcats)
+{
+    const ConcatPhysicalFunction innerConcat(constant("cd"), ConcatPhysicalFunction(constant("ef"), constant("gh")));
+    expectSingleAllocation(ConcatPhysicalFunction(constant("ab"), innerConcat), "abcdefgh");
+
+    /// Empty operands do not change the result
+    const ConcatPhysicalFunction leftConcat(constant("ab"), constant(""));
+    const ConcatPhysicalFunction rightConcat(constant("ef"), constant("gh"));
+    expectSingleAllocation(ConcatPhysicalFunction(leftConcat, rightConcat), "abefgh");
+}
+
+}
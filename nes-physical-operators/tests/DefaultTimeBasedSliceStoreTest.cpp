@@ -0,0 +1,156 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <SliceStore/DefaultTimeBasedSliceStore.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class DefaultTimeBasedSliceStoreTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("DefaultTimeBasedSliceStoreTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup DefaultTimeBasedSliceStoreTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Creates a slice for each timestamp
+    static void createSlices(DefaultTimeBasedSliceStore& sliceStore, const std::vector<uint64_t>& timestamps)
+    {
+        for (const auto timestamp : timestamps)
+        {
+            sliceStore.getSlicesOrCreate(
+                Timestamp(timestamp),
+                [](const SliceStart sliceStart, const SliceEnd sliceEnd) -> std::vector<std::shared_ptr<Slice>>
+                { return {std::make_shared<Slice>(sliceStart, sliceEnd)}; });
+        }
+    }
+
+    /// Returns the sequence number of each triggered window in the order of the window end
+    static std::vector<SequenceNumber>
+    getSequenceNumbers(const std::map<WindowInfoAndSequenceNumber, std::vector<std::shared_ptr<Slice>>>& slicesAndWindowInfo)
+    {
+        std::vector<SequenceNumber> sequenceNumbers;
+        for (const auto& [windowInfo, slices] : slicesAndWindowInfo)
+        {
+            sequenceNumbers.emplace_back(windowInfo.sequenceNumber);
+        }
+        return sequenceNumbers;
+    }
+};
+
+TEST_F(DefaultTimeBasedSliceStoreTest, everyWindowGetsItsOwnSequenceNumber)
+{
+    DefaultTimeBasedSliceStore sliceStore(10, 10);
+    createSlices(sliceStore, {0, 10, 20, 30, 40});
+
+    const auto sequenceNumbers = getSequenceNumbers(sliceStore.getTriggerableWindowSlices(Timestamp(45)));
+    EXPECT_EQ(sequenceNumbers, (std::vector{SequenceNumber(1), SequenceNumber(2), SequenceNumber(3), SequenceNumber(4)}));
+}
+
+TEST_F(DefaultTimeBasedSliceStoreTest, windowsTriggeredAtOnceShareSequenceNumbers)
+{
+    DefaultTimeBasedSliceStore sliceStore(10, 10, 3);
+    createSlices(sliceStore, {0, 10, 20, 30, 40, 50});
+
+    /// Five windows become ready at once. The first three windows share a sequence number and the remaining two windows share the next.
+    const auto sequenceNumbers = getSequenceNumbers(sliceStore.getTriggerableWindowSlices(Timestamp(55)));
+    EXPECT_EQ(
+        sequenceNumbers,
+        (std::vector{SequenceNumber(1), SequenceNumber(1), SequenceNumber(1), SequenceNumber(2), SequenceNumber(2)}));
+
+    /// Windows of a later trigger never share the sequence number of an earlier trigger
+    const auto nextSequenceNumbers = getSequenceNumbers(sliceStore.getTriggerableWindowSlices(Timestamp(100)));
+    EXPECT_EQ(nextSequenceNumbers, (std::vector{SequenceNumber(3)}));
+}
+
+TEST_F(DefaultTimeBasedSliceStoreTest, nonTriggeredWindowsShareSequenceNumbers)
+{
+    DefaultTimeBasedSliceStore sliceStore(10, 10, 2);
+    sliceStore.incrementNumberOfInputPipelines();
+    createSlices(sliceStore, {0, 10, 20});
+
+    const auto sequenceNumbers = getSequenceNumbers(sliceStore.getAllNonTriggeredSlices());
+    EXPECT_EQ(sequenceNumbers, (std::vector{SequenceNumber(1), SequenceNumber(1), SequenceNumber(2)}));
+}
+
+TEST_F(DefaultTimeBasedSliceStoreTest, nextSequenceNumberIsNotSharedWithWindows)
+{
+    DefaultTimeBasedSliceStore sliceStore(10, 10, 2);
+    createSlices(sliceStore, {0, 10, 20, 30});
+
+    /// Results that are emitted before their window is triggered get their own sequence number in between the windows
+    EXPECT_EQ(sliceStore.getNextSequenceNumberAndWatermark([] { return Timestamp(0); }).sequenceNumber, SequenceNumber(1));
+    const auto sequenceNumbers = getSequenceNumbers(sliceStore.getTriggerableWindowSlices(Timestamp(35)));
+    EXPECT_EQ(sequenceNumbers, (std::vector{SequenceNumber(2), SequenceNumber(2), SequenceNumber(3)}));
+    EXPECT_EQ(sliceStore.getNextSequenceNumberAndWatermark([] { return Timestamp(30); }).sequenceNumber, SequenceNumber(4));
+}
+
+TEST_F(DefaultTimeBasedSliceStoreTest, nextWatermarkDoesNotPassWindowsThatAreNotTriggered)
+{
+    DefaultTimeBasedSliceStore sliceStore(10, 10);
+    createSlices(sliceStore, {0, 10, 20, 30});
+
+    /// The windows up to 30 are ready, but have not been triggered yet. Thus, they still get emitted with their window start.
+    const auto beforeTrigger = sliceStore.getNextSequenceNumberAndWatermark([] { return Timestamp(30); });
+    EXPECT_EQ(beforeTrigger.sequenceNumber, SequenceNumber(1));
+    EXPECT_EQ(beforeTrigger.watermark, Timestamp(0));
+
+    const auto sequenceNumbers = getSequenceNumbers(sliceStore.getTriggerableWindowSlices(Timestamp(35)));
+    EXPECT_EQ(sequenceNumbers, (std::vector{SequenceNumber(2), SequenceNumber(3), SequenceNumber(4)}));
+    const auto afterTrigger = sliceStore.getNextSequenceNumberAndWatermark([] { return Timestamp(30); });
+    EXPECT_EQ(afterTrigger.sequenceNumber, SequenceNumber(5));
+    EXPECT_EQ(afterTrigger.watermark, Timestamp(30));
+}
+
+TEST_F(DefaultTimeBasedSliceStoreTest, provisionalWindowsContainCompletedSlices)
+{
+    /// A tumbling window of size 100 that consists of slices spanning at most 10
+    DefaultTimeBasedSliceStore sliceStore(100, 100, 1, 10);
+    createSlices(sliceStore, {0, 15, 25, 105});
+
+    /// Only the slices [0, 10) and [10, 20) end at or before the watermark. The window [100, 200) has no completed slice.
+    const auto provisionalWindows = sliceStore.getProvisionalWindowSlices(Timestamp(20));
+    ASSERT_EQ(provisionalWindows.size(), 1);
+    const auto& [windowInfo, slices] = *provisionalWindows.begin();
+    EXPECT_EQ(windowInfo.windowInfo.windowEnd, Timestamp(100));
+    EXPECT_EQ(windowInfo.sequenceNumber, SequenceNumber(1));
+    ASSERT_EQ(slices.size(), 2);
+    EXPECT_EQ(slices[0]->getSliceEnd(), Timestamp(10));
+    EXPECT_EQ(slices[1]->getSliceEnd(), Timestamp(20));
+
+    /// The provisional results do not consume the window. Thus, the window still gets triggered with all slices.
+    const auto triggeredWindows = sliceStore.getTriggerableWindowSlices(Timestamp(101));
+    ASSERT_EQ(triggeredWindows.size(), 1);
+    EXPECT_EQ(triggeredWindows.begin()->first.sequenceNumber, SequenceNumber(2));
+    EXPECT_EQ(triggeredWindows.begin()->second.size(), 3);
+    EXPECT_TRUE(sliceStore.getProvisionalWindowSlices(Timestamp(101)).empty());
+}
+
+}
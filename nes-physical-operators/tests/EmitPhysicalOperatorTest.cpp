@@ -19,6 +19,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <initializer_list>
 #include <memory>
@@ -26,6 +27,7 @@
 #include <ranges>
 #include <set>
 #include <source_location>
+#include <span>
 #include <thread>
 #include <tuple>
 #include <unordered_map>
@@ -36,11 +38,13 @@
 #include <Identifiers/NESStrongType.hpp>
 #include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
 #include <Nautilus/Interface/BufferRef/RowTupleBufferRef.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Nautilus/Interface/RecordBuffer.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
 #include <Runtime/BufferManager.hpp>
 #include <Runtime/Execution/OperatorHandler.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Runtime/VariableSizedAccess.hpp>
 #include <Sequencing/SequenceData.hpp>
 #include <Util/Logger/LogLevel.hpp>
 #include <Util/Logger/Logger.hpp>
@@ -54,6 +58,7 @@
 #include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PipelineExecutionContext.hpp>
+#include <val.hpp>
 
 namespace NES
 {
@@ -123,6 +128,91 @@ public:
         return emit;
     }
 
+    /// Creates an emit for a schema with a single variable sized field, whose values might get forwarded from the input buffer
+    std::pair<EmitPhysicalOperator, std::shared_ptr<TupleBufferRef>> createVarSizedUUT()
+    {
+        auto schema = Schema{}.addField("A_VARSIZED_FIELD", DataType::Type::VARSIZED);
+        auto bufferRef = LowerSchemaProvider::lowerSchema(512, schema, MemoryLayoutType::ROW_LAYOUT);
+        EmitPhysicalOperator emit{OperatorHandlerId(0), bufferRef};
+        handlers.insert_or_assign(OperatorHandlerId(0), std::make_shared<EmitOperatorHandler>());
+        return {std::move(emit), std::move(bufferRef)};
+    }
+
+    /// Creates a buffer with the given number of variable sized values, which are stored in a single child buffer
+    TupleBuffer createVarSizedBuffer(const size_t numberOfTuples)
+    {
+        auto buffer = createBuffer(SequenceNumber::INITIAL, ChunkNumber::INITIAL, true, INITIAL<OriginId>, numberOfTuples);
+        for (size_t recordIndex = 0; recordIndex < numberOfTuples; ++recordIndex)
+        {
+            const auto varSizedValue = createVarSizedValue(recordIndex);
+            const auto combinedIndex = TupleBufferRef::writeVarSized<TupleBufferRef::PREPEND_NONE>(
+                                           buffer, *bm, std::as_bytes(std::span{varSizedValue}))
+                                           .getCombinedIdxOffset();
+            std::memcpy(
+                buffer.getAvailableMemoryArea().data() + (recordIndex * sizeof(combinedIndex)), &combinedIndex, sizeof(combinedIndex));
+        }
+        return buffer;
+    }
+
+    /// Creates a variable sized value, whose first four bytes store the size of its content
+    static std::vector<int8_t> createVarSizedValue(const size_t content)
+    {
+        constexpr uint32_t contentSize = 8;
+        std::vector<int8_t> varSizedValue(sizeof(uint32_t) + contentSize, static_cast<int8_t>(content));
+        std::memcpy(varSizedValue.data(), &contentSize, sizeof(uint32_t));
+        return varSizedValue;
+    }
+
+    /// Emits every nth record of the input buffer unmodified, as if a selection preceded the emit
+    void runVarSized(
+        const EmitPhysicalOperator& emit, const TupleBufferRef& bufferRef, const TupleBuffer& inputBuffer, const size_t emitEveryNth)
+    {
+        run(
+            [&](auto& executionContext, auto& recordBuffer)
+            {
+                emit.open(executionContext, recordBuffer);
+                for (size_t recordIndex = 0; recordIndex < inputBuffer.getNumberOfTuples(); recordIndex += emitEveryNth)
+                {
+                    nautilus::val<uint64_t> recordIndexVal(recordIndex);
+                    auto record = bufferRef.readRecord(bufferRef.getAllFieldNames(), recordBuffer, recordIndexVal);
+                    emit.execute(executionContext, record);
+                }
+                emit.close(executionContext, recordBuffer);
+            },
+            inputBuffer);
+    }
+
+    /// Checks if the last emitted buffer shares its child buffer with the input buffer instead of storing copies of the values
+    bool lastBufferForwardedValuesOf(const TupleBuffer& inputBuffer)
+    {
+        const auto& outputBuffer = buffers.rlock()->back();
+        const auto inputChildMemory = inputBuffer.loadChildBufferMemoryArea(VariableSizedAccess::Index(0)).data();
+        for (size_t childIndex = 0; childIndex < outputBuffer.getNumberOfChildBuffers(); ++childIndex)
+        {
+            if (outputBuffer.loadChildBufferMemoryArea(VariableSizedAccess::Index(childIndex)).data() == inputChildMemory)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Checks that the last emitted buffer stores the values of every nth input record, regardless of whether they were forwarded
+    void checkLastBufferValues(const size_t emitEveryNth, std::source_location location = std::source_location::current())
+    {
+        const testing::ScopedTrace scopedTrace(location.file_name(), static_cast<int>(location.line()), "checkLastBufferValues");
+        const auto& outputBuffer = buffers.rlock()->back();
+        for (size_t recordIndex = 0; recordIndex < outputBuffer.getNumberOfTuples(); ++recordIndex)
+        {
+            VariableSizedAccess::CombinedIndex combinedIndex = 0;
+            const auto* recordAddress = outputBuffer.getAvailableMemoryArea().data() + (recordIndex * sizeof(combinedIndex));
+            std::memcpy(&combinedIndex, recordAddress, sizeof(combinedIndex));
+            const auto storedValue = TupleBufferRef::loadAssociatedVarSizedValue(outputBuffer, VariableSizedAccess(combinedIndex));
+            const auto expectedValue = createVarSizedValue(recordIndex * emitEveryNth);
+            EXPECT_TRUE(std::ranges::equal(storedValue, std::as_bytes(std::span{expectedValue}))) << "Record " << recordIndex;
+        }
+    }
+
     void run(const std::function<void(ExecutionContext&, RecordBuffer&)>& test, TupleBuffer buffer)
     {
         MockedPipelineContext pec{buffers, bm};
@@ -385,4 +475,50 @@ TEST_F(EmitPhysicalOperatorTest, ConcurrentSequenceChunkNumberTest)
         checkLastChunks();
     }
 }
+/// The emit copies the values of the first buffer, as it has not observed the selectivity of the pipeline yet. Afterward, it forwards the
+/// values, as all input records get emitted. The emitted buffers own the forwarded child buffer and outlive the input buffers.
+TEST_F(EmitPhysicalOperatorTest, ForwardsVarSizedValuesForHighSelectivity)
+{
+    auto [emit, bufferRef] = createVarSizedUUT();
+    constexpr size_t numberOfTuples = 10;
+    {
+        const auto inputBuffer = createVarSizedBuffer(numberOfTuples);
+        runVarSized(emit, *bufferRef, inputBuffer, 1);
+        EXPECT_FALSE(lastBufferForwardedValuesOf(inputBuffer));
+    }
+    checkLastBufferValues(1);
+
+    {
+        const auto inputBuffer = createVarSizedBuffer(numberOfTuples);
+        runVarSized(emit, *bufferRef, inputBuffer, 1);
+        EXPECT_TRUE(lastBufferForwardedValuesOf(inputBuffer));
+    }
+    checkNumberOfBuffers(2);
+    checkLastBufferValues(1);
+}
+
+/// The emit copies the values as long as the observed selectivity is below MIN_SELECTIVITY_FOR_FORWARDING and forwards them afterward
+TEST_F(EmitPhysicalOperatorTest, ForwardingFollowsSelectivity)
+{
+    auto [emit, bufferRef] = createVarSizedUUT();
+    constexpr size_t numberOfTuples = 10;
+    constexpr size_t lowSelectivityEveryNth = 10;
+
+    /// Only one of ten records gets emitted
+    const auto lowSelectivityBuffer = createVarSizedBuffer(numberOfTuples);
+    runVarSized(emit, *bufferRef, lowSelectivityBuffer, lowSelectivityEveryNth);
+    checkLastBufferValues(lowSelectivityEveryNth);
+
+    /// The observed selectivity is 0.1, thus, the emit copies the values, even though all records get emitted
+    const auto copiedBuffer = createVarSizedBuffer(numberOfTuples);
+    runVarSized(emit, *bufferRef, copiedBuffer, 1);
+    EXPECT_FALSE(lastBufferForwardedValuesOf(copiedBuffer));
+    checkLastBufferValues(1);
+
+    /// The observed selectivity is 0.55 now
+    const auto forwardedBuffer = createVarSizedBuffer(numberOfTuples);
+    runVarSized(emit, *bufferRef, forwardedBuffer, 1);
+    EXPECT_TRUE(lastBufferForwardedValuesOf(forwardedBuffer));
+    checkLastBufferValues(1);
+}
 }
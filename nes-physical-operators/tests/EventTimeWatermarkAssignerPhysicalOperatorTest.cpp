@@ -0,0 +1,237 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Watermark/EventTimeWatermarkAssignerPhysicalOperator.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <DataTypes/TimeUnit.hpp>
+#include <Functions/BooleanFunctions/EqualsPhysicalFunction.hpp>
+#include <Functions/ConstantValuePhysicalFunction.hpp>
+#include <Functions/FieldAccessPhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Util/SelectionStrategy.hpp>
+#include <Watermark/TimeFunction.hpp>
+#include <gtest/gtest.h>
+
+#include <BaseUnitTest.hpp>
+#include <EmitOperatorHandler.hpp>
+#include <EmitPhysicalOperator.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <ScanPhysicalOperator.hpp>
+#include <SelectionPhysicalOperator.hpp>
+#include <val.hpp>
+
+namespace NES
+{
+
+/// Checks that the watermark assigner, which determines the watermark of a buffer upfront if the scan hands over all records of the buffer
+/// at once, yields the same watermarks and creation timestamps as executing the watermark assigner per record.
+class EventTimeWatermarkAssignerPhysicalOperatorTest : public Testing::BaseUnitTest
+{
+    struct MockedPipelineContext final : PipelineExecutionContext
+    {
+        bool emitBuffer(const TupleBuffer& buffer, ContinuationPolicy) override
+        {
+            buffers.emplace_back(buffer);
+            return true;
+        }
+
+        TupleBuffer allocateTupleBuffer() override { return bufferManager->getBufferBlocking(); }
+
+        [[nodiscard]] WorkerThreadId getId() const override { return INITIAL<WorkerThreadId>; }
+
+        [[nodiscard]] uint64_t getNumberOfWorkerThreads() const override { return 1; }
+
+        [[nodiscard]] std::shared_ptr<AbstractBufferProvider> getBufferManager() const override { return bufferManager; }
+
+        [[nodiscard]] PipelineId getPipelineId() const override { return PipelineId(1); }
+
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() override
+        {
+            return *operatorHandlers;
+        }
+
+        void setOperatorHandlers(std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& opHandlers) override
+        {
+            operatorHandlers = &opHandlers;
+        }
+
+        explicit MockedPipelineContext(std::shared_ptr<BufferManager> bufferManager) : bufferManager(std::move(bufferManager)) { }
+
+        void repeatTask(const TupleBuffer&, std::chrono::milliseconds) override { INVARIANT(false, "This function should not be called"); }
+
+        std::vector<TupleBuffer> buffers;
+        std::shared_ptr<BufferManager> bufferManager;
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>* operatorHandlers = nullptr;
+    };
+
+public:
+    /// Unordered timestamps, so that the watermark and the current ts differ for most records
+    static constexpr std::array<uint64_t, 10> TIMESTAMPS{5, 3, 9, 1, 12, 7, 2, 11, 4, 6};
+    static constexpr std::array<uint64_t, 10> SELECTED{1, 0, 1, 1, 0, 1, 1, 0, 1, 1};
+    /// The emit fits four records per buffer, so that it emits buffers while the scan still processes the input buffer
+    static constexpr uint64_t EMIT_BUFFER_SIZE = 4 * sizeof(uint64_t);
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("EventTimeWatermarkAssignerPhysicalOperatorTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup EventTimeWatermarkAssignerPhysicalOperatorTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Creates a watermark assigner, whose child is an emit, optionally preceded by a selection on the selected field
+    static EventTimeWatermarkAssignerPhysicalOperator createWatermarkAssigner(const std::optional<SelectionStrategy> selectionStrategy)
+    {
+        auto emitSchema = Schema{}.addField("ts", DataType::Type::UINT64);
+        auto emitBufferRef = LowerSchemaProvider::lowerSchema(EMIT_BUFFER_SIZE, emitSchema, MemoryLayoutType::ROW_LAYOUT);
+        const PhysicalOperator emit = EmitPhysicalOperator{OperatorHandlerId(0), std::move(emitBufferRef)};
+
+        EventTimeWatermarkAssignerPhysicalOperator watermarkAssigner{
+            EventTimeFunction{FieldAccessPhysicalFunction("ts"), Windowing::TimeUnit::Milliseconds()}};
+        if (not selectionStrategy.has_value())
+        {
+            watermarkAssigner.setChild(emit);
+            return watermarkAssigner;
+        }
+
+        SelectionPhysicalOperator selection{
+            EqualsPhysicalFunction(FieldAccessPhysicalFunction("selected"), ConstantUInt64ValueFunction(1)), selectionStrategy.value()};
+        selection.setChild(emit);
+        watermarkAssigner.setChild(selection);
+        return watermarkAssigner;
+    }
+
+    /// Runs the operators on the input buffer via a scan, which hands over all records of the buffer at once to the watermark assigner
+    std::vector<TupleBuffer> runWithScan(const std::optional<SelectionStrategy> selectionStrategy)
+    {
+        ScanPhysicalOperator scan{inputBufferRef, inputBufferRef->getAllFieldNames()};
+        scan.setChild(createWatermarkAssigner(selectionStrategy));
+        return run(
+            [&](ExecutionContext& executionCtx, RecordBuffer& recordBuffer)
+            {
+                scan.open(executionCtx, recordBuffer);
+                scan.close(executionCtx, recordBuffer);
+            });
+    }
+
+    /// Runs the operators on the input buffer by executing the watermark assigner for every record
+    std::vector<TupleBuffer> runPerRecord(const std::optional<SelectionStrategy> selectionStrategy)
+    {
+        const auto watermarkAssigner = createWatermarkAssigner(selectionStrategy);
+        return run(
+            [&](ExecutionContext& executionCtx, RecordBuffer& recordBuffer)
+            {
+                executionCtx.watermarkTs = recordBuffer.getWatermarkTs();
+                executionCtx.currentTs = recordBuffer.getCreatingTs();
+                watermarkAssigner.open(executionCtx, recordBuffer);
+                for (nautilus::val<uint64_t> recordIndex = 0; recordIndex < recordBuffer.getNumRecords(); recordIndex = recordIndex + 1)
+                {
+                    auto record = inputBufferRef->readRecord(inputBufferRef->getAllFieldNames(), recordBuffer, recordIndex);
+                    watermarkAssigner.execute(executionCtx, record);
+                }
+                watermarkAssigner.close(executionCtx, recordBuffer);
+            });
+    }
+
+    std::vector<TupleBuffer> run(const std::function<void(ExecutionContext&, RecordBuffer&)>& test)
+    {
+        auto inputBuffer = bufferManager->getBufferBlocking();
+        for (size_t recordIndex = 0; recordIndex < TIMESTAMPS.size(); ++recordIndex)
+        {
+            const std::array record{TIMESTAMPS[recordIndex], SELECTED[recordIndex]};
+            std::memcpy(inputBuffer.getAvailableMemoryArea().data() + (recordIndex * sizeof(record)), record.data(), sizeof(record));
+        }
+        inputBuffer.setNumberOfTuples(TIMESTAMPS.size());
+        inputBuffer.setSequenceNumber(SequenceNumber::INITIAL);
+        inputBuffer.setChunkNumber(ChunkNumber::INITIAL);
+        inputBuffer.setLastChunk(true);
+        inputBuffer.setOriginId(INITIAL<OriginId>);
+
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> handlers{
+            {OperatorHandlerId(0), std::make_shared<EmitOperatorHandler>()}};
+        MockedPipelineContext pec{bufferManager};
+        pec.setOperatorHandlers(handlers);
+        Arena arena(bufferManager);
+        ExecutionContext executionContext{&pec, &arena};
+        executionContext.originId = inputBuffer.getOriginId();
+        executionContext.sequenceNumber = inputBuffer.getSequenceNumber();
+        executionContext.chunkNumber = inputBuffer.getChunkNumber();
+        executionContext.lastChunk = inputBuffer.isLastChunk();
+
+        RecordBuffer recordBuffer(std::addressof(inputBuffer));
+        test(executionContext, recordBuffer);
+        return std::move(pec.buffers);
+    }
+
+    static void expectEqualTimestamps(const std::vector<TupleBuffer>& expected, const std::vector<TupleBuffer>& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        ASSERT_FALSE(expected.empty());
+        for (size_t bufferIndex = 0; bufferIndex < expected.size(); ++bufferIndex)
+        {
+            EXPECT_EQ(expected[bufferIndex].getNumberOfTuples(), actual[bufferIndex].getNumberOfTuples()) << "Buffer " << bufferIndex;
+            EXPECT_EQ(expected[bufferIndex].getCreationTimestampInMS(), actual[bufferIndex].getCreationTimestampInMS())
+                << "Buffer " << bufferIndex;
+        }
+        /// The scan knows the watermark of the whole input buffer upfront. Thus, solely the last chunk must carry the same watermark.
+        EXPECT_EQ(expected.back().getWatermark(), actual.back().getWatermark());
+        EXPECT_EQ(actual.back().getWatermark(), Timestamp(12));
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(512, 100);
+    std::shared_ptr<TupleBufferRef> inputBufferRef = LowerSchemaProvider::lowerSchema(
+        512,
+        Schema{}.addField("ts", DataType::Type::UINT64).addField("selected", DataType::Type::UINT64),
+        MemoryLayoutType::ROW_LAYOUT);
+};
+
+TEST_F(EventTimeWatermarkAssignerPhysicalOperatorTest, ScanYieldsPerRecordTimestamps)
+{
+    expectEqualTimestamps(runPerRecord(std::nullopt), runWithScan(std::nullopt));
+}
+
+TEST_F(EventTimeWatermarkAssignerPhysicalOperatorTest, ScanYieldsPerRecordTimestampsWithPredicatedSelection)
+{
+    /// The predicated selection reads all records of a block before it executes its child on the selected records
+    expectEqualTimestamps(runPerRecord(SelectionStrategy::PREDICATED), runWithScan(SelectionStrategy::PREDICATED));
+}
+
+}
@@ -0,0 +1,169 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Join/HashJoin/HJSlice.hpp>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Join/StreamJoinUtil.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <SliceStore/Slice.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <HashMapSlice.hpp>
+
+namespace NES
+{
+
+/// Checks that the symmetric hash join collects every pair of tuples with the same hash exactly once, while multiple worker threads
+/// publish batches of tuples of both sides concurrently
+class HJSliceTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_WORKER_THREADS = 4;
+    static constexpr uint64_t NUMBER_OF_BATCHES_PER_WORKER_THREAD = 50;
+    static constexpr uint64_t NUMBER_OF_TUPLES_PER_BATCH = 20;
+    /// Few hashes, so that most tuples have matches and the batches of different worker threads share partitions
+    static constexpr uint64_t NUMBER_OF_HASHES = 7;
+
+    /// The position on the page identifies a tuple
+    struct PublishedTuple
+    {
+        JoinBuildSideType buildSide;
+        uint64_t hash;
+    };
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("HJSliceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup HJSliceTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        /// The cleanup function is only called for hashmaps containing tuples, which the tests do not insert
+        const CreateNewHashMapSliceArgs hashMapSliceArgs{{nullptr}, 8, 8, 4096, 64};
+        slice = std::make_unique<HJSlice>(SliceStart(0), SliceEnd(10), hashMapSliceArgs, NUMBER_OF_WORKER_THREADS);
+    }
+
+    void TearDown() override
+    {
+        slice.reset();
+        BaseUnitTest::TearDown();
+    }
+
+    static uint64_t getTupleId(const uint64_t workerThreadIdx, const uint64_t batchIdx, const uint64_t tupleIdx)
+    {
+        return (((workerThreadIdx * NUMBER_OF_BATCHES_PER_WORKER_THREAD) + batchIdx) * NUMBER_OF_TUPLES_PER_BATCH) + tupleIdx;
+    }
+
+    static PublishedTuple getPublishedTuple(const uint64_t workerThreadIdx, const uint64_t batchIdx, const uint64_t tupleIdx)
+    {
+        /// Every worker thread alternates between the sides, like a worker thread that processes buffers of both join sides
+        const auto buildSide = ((workerThreadIdx + batchIdx) % 2 == 0) ? JoinBuildSideType::Left : JoinBuildSideType::Right;
+        return {buildSide, getTupleId(workerThreadIdx, batchIdx, tupleIdx) % NUMBER_OF_HASHES};
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(512, 1);
+    std::unique_ptr<HJSlice> slice;
+};
+
+TEST_F(HJSliceTest, collectsEveryPairExactlyOnce)
+{
+    const auto page = bufferManager->getBufferBlocking();
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> pairsPerWorkerThread(NUMBER_OF_WORKER_THREADS);
+    std::vector<std::jthread> workerThreads;
+    for (uint64_t workerThreadIdx = 0; workerThreadIdx < NUMBER_OF_WORKER_THREADS; ++workerThreadIdx)
+    {
+        workerThreads.emplace_back(
+            [&, workerThreadIdx]
+            {
+                const WorkerThreadId workerThreadId(workerThreadIdx);
+                for (uint64_t batchIdx = 0; batchIdx < NUMBER_OF_BATCHES_PER_WORKER_THREAD; ++batchIdx)
+                {
+                    for (uint64_t tupleIdx = 0; tupleIdx < NUMBER_OF_TUPLES_PER_BATCH; ++tupleIdx)
+                    {
+                        const auto tupleId = getTupleId(workerThreadIdx, batchIdx, tupleIdx);
+                        const auto hash = getPublishedTuple(workerThreadIdx, batchIdx, tupleIdx).hash;
+                        slice->stageSymmetric(workerThreadId, hash, HJSlice::SymmetricJoinTuple{page, tupleId});
+                    }
+
+                    const auto buildSide = getPublishedTuple(workerThreadIdx, batchIdx, 0).buildSide;
+                    const auto numberOfPairs = slice->publishAndProbeSymmetric(workerThreadId, buildSide);
+                    for (uint64_t pairIdx = 0; pairIdx < numberOfPairs; ++pairIdx)
+                    {
+                        const auto& [tuple, match] = slice->getSymmetricJoinPair(workerThreadId, pairIdx);
+                        /// Storing the pairs with the tuple of the left side first
+                        pairsPerWorkerThread[workerThreadIdx].emplace_back(
+                            buildSide == JoinBuildSideType::Left ? std::pair{tuple->positionOnPage, match->positionOnPage}
+                                                                 : std::pair{match->positionOnPage, tuple->positionOnPage});
+                    }
+                }
+            });
+    }
+    workerThreads.clear();
+
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> numberOfCollectionsPerPair;
+    for (const auto& pairs : pairsPerWorkerThread)
+    {
+        for (const auto& pair : pairs)
+        {
+            ++numberOfCollectionsPerPair[pair];
+        }
+    }
+
+    /// Every pair of a left and a right tuple with the same hash must have been collected exactly once
+    std::vector<PublishedTuple> publishedTuples(
+        NUMBER_OF_WORKER_THREADS * NUMBER_OF_BATCHES_PER_WORKER_THREAD * NUMBER_OF_TUPLES_PER_BATCH);
+    for (uint64_t workerThreadIdx = 0; workerThreadIdx < NUMBER_OF_WORKER_THREADS; ++workerThreadIdx)
+    {
+        for (uint64_t batchIdx = 0; batchIdx < NUMBER_OF_BATCHES_PER_WORKER_THREAD; ++batchIdx)
+        {
+            for (uint64_t tupleIdx = 0; tupleIdx < NUMBER_OF_TUPLES_PER_BATCH; ++tupleIdx)
+            {
+                publishedTuples[getTupleId(workerThreadIdx, batchIdx, tupleIdx)] = getPublishedTuple(workerThreadIdx, batchIdx, tupleIdx);
+            }
+        }
+    }
+    uint64_t expectedNumberOfPairs = 0;
+    for (uint64_t leftId = 0; leftId < publishedTuples.size(); ++leftId)
+    {
+        for (uint64_t rightId = 0; rightId < publishedTuples.size(); ++rightId)
+        {
+            const auto& left = publishedTuples[leftId];
+            const auto& right = publishedTuples[rightId];
+            if (left.buildSide == JoinBuildSideType::Left and right.buildSide == JoinBuildSideType::Right and left.hash == right.hash)
+            {
+                ++expectedNumberOfPairs;
+                const auto collections = numberOfCollectionsPerPair.find({leftId, rightId});
+                ASSERT_NE(collections, numberOfCollectionsPerPair.end()) << "Pair " << leftId << "-" << rightId << " was not collected";
+                EXPECT_EQ(collections->second, 1) << "Pair " << leftId << "-" << rightId;
+            }
+        }
+    }
+    EXPECT_GT(expectedNumberOfPairs, 0);
+    EXPECT_EQ(numberOfCollectionsPerPair.size(), expectedNumberOfPairs);
+}
+
+}
@@ -0,0 +1,106 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <HashMapSizeTuner.hpp>
+
+namespace NES
+{
+
+class HashMapSizeTunerTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t MAX_NUMBER_OF_BUCKETS = 1024;
+    static constexpr uint64_t NUMBER_OF_OBSERVED_HASH_MAPS = 4;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("HashMapSizeTunerTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup HashMapSizeTunerTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+};
+
+TEST_F(HashMapSizeTunerTest, usesConfiguredNumberOfBucketsBeforeFirstObservation)
+{
+    const HashMapSizeTuner tuner(MAX_NUMBER_OF_BUCKETS, NUMBER_OF_OBSERVED_HASH_MAPS);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 64);
+    EXPECT_EQ(tuner.getNumberOfBuckets(0), 1);
+    EXPECT_EQ(tuner.getNumberOfBuckets(MAX_NUMBER_OF_BUCKETS * 2), MAX_NUMBER_OF_BUCKETS);
+}
+
+TEST_F(HashMapSizeTunerTest, keepsNumberOfBucketsWhileChainsHaveAcceptableLength)
+{
+    HashMapSizeTuner tuner(MAX_NUMBER_OF_BUCKETS, NUMBER_OF_OBSERVED_HASH_MAPS);
+    tuner.observe(64, 100, 128);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 100);
+
+    /// A varying number of keys keeps the average chain length within the range and, therefore, must not change the number of buckets
+    tuner.observe(100, 150, 128);
+    tuner.observe(100, 80, 128);
+    tuner.observe(100, 200, 128);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 100);
+}
+
+TEST_F(HashMapSizeTunerTest, resizesIfChainsBecomeTooLong)
+{
+    HashMapSizeTuner tuner(MAX_NUMBER_OF_BUCKETS, NUMBER_OF_OBSERVED_HASH_MAPS);
+    tuner.observe(64, 100, 128);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 100);
+
+    tuner.observe(100, 900, 128);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 500);
+}
+
+TEST_F(HashMapSizeTunerTest, resizesIfChainsBecomeTooShort)
+{
+    HashMapSizeTuner tuner(MAX_NUMBER_OF_BUCKETS, NUMBER_OF_OBSERVED_HASH_MAPS);
+    tuner.observe(64, 800, 1024);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 800);
+
+    tuner.observe(800, 10, 1024);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 405);
+}
+
+TEST_F(HashMapSizeTunerTest, clampsToMaxNumberOfBuckets)
+{
+    HashMapSizeTuner tuner(MAX_NUMBER_OF_BUCKETS, NUMBER_OF_OBSERVED_HASH_MAPS);
+    tuner.observe(64, MAX_NUMBER_OF_BUCKETS * 8, 128);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), MAX_NUMBER_OF_BUCKETS);
+}
+
+TEST_F(HashMapSizeTunerTest, ignoresChainLengthOfHashMapsWithOldNumberOfBuckets)
+{
+    HashMapSizeTuner tuner(MAX_NUMBER_OF_BUCKETS, NUMBER_OF_OBSERVED_HASH_MAPS);
+    tuner.observe(64, 100, 128);
+    tuner.observe(100, 900, 128);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 500);
+
+    /// Slices that have been created before the resize still have too long chains, but must not trigger another resize
+    tuner.observe(100, 900, 128);
+    tuner.observe(100, 900, 128);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 500);
+
+    /// Their number of keys is still taken into account, once a hash map with the current number of buckets triggers a resize
+    tuner.observe(500, 1200, 512);
+    EXPECT_EQ(tuner.getNumberOfBuckets(64), 975);
+}
+
+}
@@ -0,0 +1,112 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Watermark/MultiOriginWatermarkProcessor.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+class MultiOriginWatermarkProcessorTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("MultiOriginWatermarkProcessorTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup MultiOriginWatermarkProcessorTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    static SequenceData sequenceData(const uint64_t sequenceNumber)
+    {
+        return {SequenceNumber(sequenceNumber), INITIAL<ChunkNumber>, true};
+    }
+};
+
+/// The watermark is the minimum across all origins, which only advances once the slowest origin advances.
+TEST_F(MultiOriginWatermarkProcessorTest, minimumAcrossOrigins)
+{
+    const std::vector origins{OriginId(1), OriginId(2), OriginId(3)};
+    const MultiOriginWatermarkProcessor watermarkProcessor(origins);
+    EXPECT_EQ(watermarkProcessor.getCurrentWatermark(), Timestamp(0));
+
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(10), sequenceData(1), OriginId(1)), Timestamp(0));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(20), sequenceData(1), OriginId(2)), Timestamp(0));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(5), sequenceData(1), OriginId(3)), Timestamp(5));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(30), sequenceData(2), OriginId(3)), Timestamp(10));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(40), sequenceData(2), OriginId(1)), Timestamp(20));
+
+    /// An out-of-order sequence number must not advance the watermark of its origin until the gap is closed
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(50), sequenceData(3), OriginId(2)), Timestamp(20));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(25), sequenceData(2), OriginId(2)), Timestamp(30));
+}
+
+/// Origin ids do not need to start at the initial origin id or be consecutive.
+TEST_F(MultiOriginWatermarkProcessorTest, sparseOriginIds)
+{
+    const std::vector origins{OriginId(42), OriginId(7)};
+    const MultiOriginWatermarkProcessor watermarkProcessor(origins);
+
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(10), sequenceData(1), OriginId(42)), Timestamp(0));
+    EXPECT_EQ(watermarkProcessor.updateWatermark(Timestamp(15), sequenceData(1), OriginId(7)), Timestamp(10));
+}
+
+/// Every thread owns one origin and advances it concurrently. Afterward, the watermark must be the exact minimum of all origins.
+TEST_F(MultiOriginWatermarkProcessorTest, concurrentUpdatesOfDifferentOrigins)
+{
+    constexpr size_t numberOfOrigins = 13;
+    constexpr uint64_t updatesPerOrigin = 10000;
+
+    std::vector<OriginId> origins;
+    for (size_t originIdx = 0; originIdx < numberOfOrigins; ++originIdx)
+    {
+        origins.emplace_back(OriginId::INITIAL + originIdx);
+    }
+    const MultiOriginWatermarkProcessor watermarkProcessor(origins);
+
+    {
+        std::vector<std::jthread> threads;
+        for (size_t originIdx = 0; originIdx < numberOfOrigins; ++originIdx)
+        {
+            threads.emplace_back(
+                [&, originIdx]
+                {
+                    /// The origin with index 0 stops earliest, all others overtake it
+                    const auto lastTimestamp = updatesPerOrigin + (originIdx * 10);
+                    for (uint64_t sequenceNumber = SequenceNumber::INITIAL; sequenceNumber <= updatesPerOrigin; ++sequenceNumber)
+                    {
+                        const auto timestamp = sequenceNumber == updatesPerOrigin ? lastTimestamp : sequenceNumber;
+                        const auto currentWatermark
+                            = watermarkProcessor.updateWatermark(Timestamp(timestamp), sequenceData(sequenceNumber), origins[originIdx]);
+                        EXPECT_LE(currentWatermark, Timestamp(timestamp));
+                    }
+                });
+        }
+    }
+    EXPECT_EQ(watermarkProcessor.getCurrentWatermark(), Timestamp(updatesPerOrigin));
+}
+
+}
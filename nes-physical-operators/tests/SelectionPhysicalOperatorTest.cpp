@@ -0,0 +1,279 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SelectionPhysicalOperator.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Functions/BooleanFunctions/EqualsPhysicalFunction.hpp>
+#include <Functions/ConstantValuePhysicalFunction.hpp>
+#include <Functions/FieldAccessPhysicalFunction.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
+#include <Nautilus/Interface/Record.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <Util/SelectionStrategy.hpp>
+#include <gtest/gtest.h>
+#include <magic_enum/magic_enum.hpp>
+
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <ScanPhysicalOperator.hpp>
+#include <SelectionOperatorHandler.hpp>
+#include <function.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+/// Checks that the scan hands over all records of a buffer at once to the selection, and that the adaptive selection only specializes its
+/// traced code for the observed selectivity if its pipeline gets recompiled with the profile. The operators get executed in the
+/// interpreter, which traces the operators anew for every buffer.
+class SelectionPhysicalOperatorTest : public Testing::BaseUnitTest
+{
+    struct MockedPipelineContext final : PipelineExecutionContext
+    {
+        bool emitBuffer(const TupleBuffer&, ContinuationPolicy) override
+        {
+            INVARIANT(false, "This function should not be called");
+            return false;
+        }
+
+        TupleBuffer allocateTupleBuffer() override { return bufferManager->getBufferBlocking(); }
+
+        [[nodiscard]] WorkerThreadId getId() const override { return INITIAL<WorkerThreadId>; }
+
+        [[nodiscard]] uint64_t getNumberOfWorkerThreads() const override { return 1; }
+
+        [[nodiscard]] std::shared_ptr<AbstractBufferProvider> getBufferManager() const override { return bufferManager; }
+
+        [[nodiscard]] PipelineId getPipelineId() const override { return PipelineId(1); }
+
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() override
+        {
+            return *operatorHandlers;
+        }
+
+        void setOperatorHandlers(std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& opHandlers) override
+        {
+            operatorHandlers = &opHandlers;
+        }
+
+        explicit MockedPipelineContext(std::shared_ptr<BufferManager> bufferManager) : bufferManager(std::move(bufferManager)) { }
+
+        void repeatTask(const TupleBuffer&, std::chrono::milliseconds) override { INVARIANT(false, "This function should not be called"); }
+
+        std::shared_ptr<BufferManager> bufferManager;
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>* operatorHandlers = nullptr;
+    };
+
+    /// Counts the records that pass the selection
+    struct CountingPhysicalOperator final : PhysicalOperatorConcept
+    {
+        explicit CountingPhysicalOperator(uint64_t* numberOfRecords) : numberOfRecords(numberOfRecords) { }
+
+        void open(ExecutionContext&, RecordBuffer&) const override { /*noop*/ }
+
+        void close(ExecutionContext&, RecordBuffer&) const override { /*noop*/ }
+
+        void execute(ExecutionContext&, Record&) const override
+        {
+            nautilus::invoke(+[](uint64_t* counter) { ++*counter; }, nautilus::val<uint64_t*>(numberOfRecords));
+        }
+
+        [[nodiscard]] std::optional<PhysicalOperator> getChild() const override { return std::nullopt; }
+
+        void setChild(PhysicalOperator) override { INVARIANT(false, "This function should not be called"); }
+
+        uint64_t* numberOfRecords;
+    };
+
+    /// Counts the batches of records that the operator receives at once
+    struct BatchCountingPhysicalOperator final : PhysicalOperatorConcept
+    {
+        BatchCountingPhysicalOperator(uint64_t* numberOfBatches, uint64_t* numberOfRecords)
+            : numberOfBatches(numberOfBatches), numberOfRecords(numberOfRecords)
+        {
+        }
+
+        void open(ExecutionContext&, RecordBuffer&) const override { /*noop*/ }
+
+        void close(ExecutionContext&, RecordBuffer&) const override { /*noop*/ }
+
+        void execute(ExecutionContext&, Record&) const override { INVARIANT(false, "This function should not be called"); }
+
+        void executeOnRecords(ExecutionContext&, const RecordBatch& records) const override
+        {
+            nautilus::invoke(
+                +[](uint64_t* batches, uint64_t* counter, const uint64_t numberOfRecordsInBatch)
+                {
+                    ++*batches;
+                    *counter += numberOfRecordsInBatch;
+                },
+                nautilus::val<uint64_t*>(numberOfBatches),
+                nautilus::val<uint64_t*>(numberOfRecords),
+                records.numberOfRecords);
+        }
+
+        [[nodiscard]] std::optional<PhysicalOperator> getChild() const override { return std::nullopt; }
+
+        void setChild(PhysicalOperator) override { INVARIANT(false, "This function should not be called"); }
+
+        uint64_t* numberOfBatches;
+        uint64_t* numberOfRecords;
+    };
+
+public:
+    static constexpr uint64_t BUFFER_SIZE = 8192;
+    static constexpr uint64_t NUMBER_OF_RECORDS_PER_BUFFER = BUFFER_SIZE / sizeof(uint64_t);
+    /// The warm-up observes exactly as many records as the adaptive selection requires for the specialization
+    static constexpr uint64_t NUMBER_OF_WARM_UP_BUFFERS
+        = SelectionPhysicalOperator::MIN_NUMBER_OF_RECORDS_FOR_SPECIALIZATION / NUMBER_OF_RECORDS_PER_BUFFER;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SelectionPhysicalOperatorTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SelectionPhysicalOperatorTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        /// Every second record passes the selection, which lets the adaptive selection choose the predicated variant
+        inputBuffer = bufferManager->getBufferBlocking();
+        for (uint64_t recordIndex = 0; recordIndex < NUMBER_OF_RECORDS_PER_BUFFER; ++recordIndex)
+        {
+            inputBuffer.getAvailableMemoryArea<uint64_t>()[recordIndex] = recordIndex % 2;
+        }
+        inputBuffer.setNumberOfTuples(NUMBER_OF_RECORDS_PER_BUFFER);
+    }
+
+    SelectionPhysicalOperator createSelection(const SelectionStrategy strategy, const bool specializeForProfile)
+    {
+        const auto function = EqualsPhysicalFunction(FieldAccessPhysicalFunction("value"), ConstantUInt64ValueFunction(1));
+        auto selection = strategy == SelectionStrategy::ADAPTIVE
+            ? SelectionPhysicalOperator{function, SELECTION_HANDLER_ID, selectionHandler, specializeForProfile}
+            : SelectionPhysicalOperator{function, strategy};
+        selection.setChild(CountingPhysicalOperator{&numberOfSelectedRecords});
+        return selection;
+    }
+
+    /// Scans the input buffer numberOfBuffers times with the operator as child of the scan
+    void run(const PhysicalOperator& scanChild, const uint64_t numberOfBuffers)
+    {
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> handlers{{SELECTION_HANDLER_ID, selectionHandler}};
+        MockedPipelineContext pec{bufferManager};
+        pec.setOperatorHandlers(handlers);
+        ScanPhysicalOperator scan{inputBufferRef, inputBufferRef->getAllFieldNames()};
+        scan.setChild(scanChild);
+        for (uint64_t buffer = 0; buffer < numberOfBuffers; ++buffer)
+        {
+            Arena arena(bufferManager);
+            ExecutionContext executionContext{&pec, &arena};
+            RecordBuffer recordBuffer(std::addressof(inputBuffer));
+            scan.open(executionContext, recordBuffer);
+            scan.close(executionContext, recordBuffer);
+        }
+    }
+
+    static constexpr auto SELECTION_HANDLER_ID = OperatorHandlerId(1);
+    std::shared_ptr<SelectionOperatorHandler> selectionHandler = std::make_shared<SelectionOperatorHandler>();
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, 10);
+    std::shared_ptr<TupleBufferRef> inputBufferRef
+        = LowerSchemaProvider::lowerSchema(BUFFER_SIZE, Schema{}.addField("value", DataType::Type::UINT64), MemoryLayoutType::ROW_LAYOUT);
+    TupleBuffer inputBuffer;
+    uint64_t numberOfSelectedRecords = 0;
+};
+
+TEST_F(SelectionPhysicalOperatorTest, ScanHandsOverAllRecordsOfBufferAtOnce)
+{
+    uint64_t numberOfBatches = 0;
+    uint64_t numberOfRecords = 0;
+    run(BatchCountingPhysicalOperator{&numberOfBatches, &numberOfRecords}, 2);
+    EXPECT_EQ(numberOfBatches, 2UL);
+    EXPECT_EQ(numberOfRecords, 2 * NUMBER_OF_RECORDS_PER_BUFFER);
+
+    /// Operators that do not process all records at once execute each record on its own
+    run(CountingPhysicalOperator{&numberOfRecords}, 1);
+    EXPECT_EQ(numberOfRecords, 3 * NUMBER_OF_RECORDS_PER_BUFFER);
+}
+
+TEST_F(SelectionPhysicalOperatorTest, AllStrategiesSelectTheSameRecords)
+{
+    for (const auto strategy : {SelectionStrategy::BRANCHING, SelectionStrategy::PREDICATED, SelectionStrategy::ADAPTIVE})
+    {
+        numberOfSelectedRecords = 0;
+        run(createSelection(strategy, false), 2);
+        EXPECT_EQ(numberOfSelectedRecords, NUMBER_OF_RECORDS_PER_BUFFER) << magic_enum::enum_name(strategy);
+    }
+}
+
+TEST_F(SelectionPhysicalOperatorTest, AdaptiveSelectionSpecializesForProfile)
+{
+    const auto selection = createSelection(SelectionStrategy::ADAPTIVE, true);
+    EXPECT_FALSE(selection.hasProfileForRecompilation());
+
+    run(selection, NUMBER_OF_WARM_UP_BUFFERS);
+    EXPECT_TRUE(selection.hasProfileForRecompilation());
+    EXPECT_EQ(selection.getNumberOfObservedRecords(), SelectionPhysicalOperator::MIN_NUMBER_OF_RECORDS_FOR_SPECIALIZATION);
+    EXPECT_EQ(numberOfSelectedRecords, NUMBER_OF_WARM_UP_BUFFERS * NUMBER_OF_RECORDS_PER_BUFFER / 2);
+
+    /// The specialized code solely contains the chosen variant, which selects the same records, but does not update the statistics
+    run(selection, 1);
+    EXPECT_EQ(selection.getNumberOfObservedRecords(), SelectionPhysicalOperator::MIN_NUMBER_OF_RECORDS_FOR_SPECIALIZATION);
+    EXPECT_EQ(numberOfSelectedRecords, (NUMBER_OF_WARM_UP_BUFFERS + 1) * NUMBER_OF_RECORDS_PER_BUFFER / 2);
+}
+
+TEST_F(SelectionPhysicalOperatorTest, AdaptiveSelectionKeepsAdaptingWithoutRecompilation)
+{
+    const auto selection = createSelection(SelectionStrategy::ADAPTIVE, false);
+    run(selection, NUMBER_OF_WARM_UP_BUFFERS + 1);
+    EXPECT_FALSE(selection.hasProfileForRecompilation());
+    EXPECT_EQ(selection.getNumberOfObservedRecords(), (NUMBER_OF_WARM_UP_BUFFERS + 1) * NUMBER_OF_RECORDS_PER_BUFFER);
+    EXPECT_EQ(numberOfSelectedRecords, (NUMBER_OF_WARM_UP_BUFFERS + 1) * NUMBER_OF_RECORDS_PER_BUFFER / 2);
+}
+
+TEST_F(SelectionPhysicalOperatorTest, FixedStrategiesHaveNoProfile)
+{
+    for (const auto strategy : {SelectionStrategy::BRANCHING, SelectionStrategy::PREDICATED})
+    {
+        const auto selection = createSelection(strategy, true);
+        run(selection, NUMBER_OF_WARM_UP_BUFFERS);
+        EXPECT_FALSE(selection.hasProfileForRecompilation());
+        EXPECT_EQ(selection.getNumberOfObservedRecords(), 0UL);
+    }
+    /// Both strategies select every second record
+    EXPECT_EQ(numberOfSelectedRecords, NUMBER_OF_WARM_UP_BUFFERS * NUMBER_OF_RECORDS_PER_BUFFER);
+}
+
+}
@@ -0,0 +1,91 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <SelectivityStatistics.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+
+namespace NES
+{
+
+/// Checks that the selectivity statistics neither lose nor mix up concurrent observations of multiple worker threads
+class SelectivityStatisticsTest : public Testing::BaseUnitTest
+{
+public:
+    static constexpr uint64_t NUMBER_OF_THREADS = 8;
+    static constexpr uint64_t NUMBER_OF_OBSERVATIONS_PER_THREAD = 1000;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("SelectivityStatisticsTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup SelectivityStatisticsTest test class.");
+    }
+};
+
+TEST_F(SelectivityStatisticsTest, hasNoSelectivityWithoutObservations)
+{
+    const SelectivityStatistics statistics;
+    EXPECT_FALSE(statistics.getSelectivity().has_value());
+    EXPECT_EQ(statistics.getNumberOfObservedRecords(), 0UL);
+}
+
+TEST_F(SelectivityStatisticsTest, keepsAllConcurrentObservations)
+{
+    /// Every thread observes 100 records per buffer, of which it selects as many records as its thread index
+    SelectivityStatistics statistics;
+    std::vector<std::jthread> threads;
+    for (uint64_t threadIdx = 0; threadIdx < NUMBER_OF_THREADS; ++threadIdx)
+    {
+        threads.emplace_back(
+            [&statistics, threadIdx]
+            {
+                for (uint64_t observation = 0; observation < NUMBER_OF_OBSERVATIONS_PER_THREAD; ++observation)
+                {
+                    statistics.addObservation(100, threadIdx);
+                }
+            });
+    }
+    threads.clear();
+
+    EXPECT_EQ(statistics.getNumberOfObservedRecords(), NUMBER_OF_THREADS * NUMBER_OF_OBSERVATIONS_PER_THREAD * 100);
+    ASSERT_TRUE(statistics.getSelectivity().has_value());
+    /// The mean of the thread indexes 0 to 7 is 3.5, thus 3.5 of 100 records were selected
+    EXPECT_DOUBLE_EQ(statistics.getSelectivity().value(), 0.035);
+}
+
+TEST_F(SelectivityStatisticsTest, halvingKeepsTheSelectivity)
+{
+    constexpr auto numberOfRecords = SelectivityStatistics::MAX_NUMBER_OF_OBSERVED_RECORDS / 4;
+    SelectivityStatistics statistics;
+    for (uint64_t observation = 0; observation < 10; ++observation)
+    {
+        statistics.addObservation(numberOfRecords, numberOfRecords / 4);
+    }
+    EXPECT_LE(statistics.getNumberOfObservedRecords(), SelectivityStatistics::MAX_NUMBER_OF_OBSERVED_RECORDS);
+    EXPECT_DOUBLE_EQ(statistics.getSelectivity().value(), 0.25);
+
+    /// Emits might observe more result records than input records
+    SelectivityStatistics emitStatistics;
+    emitStatistics.addObservation(10, 30);
+    EXPECT_DOUBLE_EQ(emitStatistics.getSelectivity().value(), 3.0);
+}
+
+}
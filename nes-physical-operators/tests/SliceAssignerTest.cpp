@@ -342,4 +342,26 @@ TEST_F(SliceAssignerTest, getSliceNonDividerSize10Slide7)
 }
 
 
+TEST_F(SliceAssignerTest, getSliceWithMaxSliceSizeSize10Slide5)
+{
+    /// Creating a slice store with a particular size and slide, whose slices do not span more than three timestamps
+    constexpr auto windowSize = 10;
+    constexpr auto windowSlide = 5;
+    constexpr auto maxSliceSize = 3;
+    const SliceAssigner sliceAssigner(windowSize, windowSlide, maxSliceSize);
+
+    /// Creating the expected slices for the given timestamps as well as the windows for each slice.
+    const std::vector<SlicesForTimestamp> slicesForTimestamps = {
+        {Timestamp(0), Timestamp(3), Timestamp(1)},
+        {Timestamp(3), Timestamp(5), Timestamp(4)},
+        {Timestamp(5), Timestamp(6), Timestamp(5)},
+        {Timestamp(6), Timestamp(9), Timestamp(8)},
+        {Timestamp(9), Timestamp(10), Timestamp(9)},
+        {Timestamp(10), Timestamp(12), Timestamp(11)},
+    };
+    const std::vector<std::vector<WindowInfo>> windows
+        = {{{0, 10}}, {{0, 10}}, {{0, 10}, {5, 15}}, {{0, 10}, {5, 15}}, {{0, 10}, {5, 15}}, {{5, 15}, {10, 20}}};
+    runValidation(slicesForTimestamps, windows, sliceAssigner);
+}
+
 }
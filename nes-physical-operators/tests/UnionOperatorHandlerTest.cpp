@@ -0,0 +1,80 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstdint>
+#include <vector>
+#include <Identifiers/Identifiers.hpp>
+#include <Sequencing/SequenceData.hpp>
+#include <Time/Timestamp.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <UnionOperatorHandler.hpp>
+
+namespace NES
+{
+
+class UnionOperatorHandlerTest : public Testing::BaseUnitTest
+{
+public:
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("UnionOperatorHandlerTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup UnionOperatorHandlerTest class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    /// Merges a buffer that forms a complete sequence of its input origin
+    static MergedBufferMetaData
+    merge(UnionOperatorHandler& handler, const uint64_t watermarkTs, const uint64_t sequenceNumber, const OriginId origin)
+    {
+        return handler.mergeBuffer(
+            Timestamp(watermarkTs), SequenceData(SequenceNumber(sequenceNumber), ChunkNumber(ChunkNumber::INITIAL), true), origin);
+    }
+};
+
+TEST_F(UnionOperatorHandlerTest, assignsConsecutiveSequenceNumbersAcrossOrigins)
+{
+    UnionOperatorHandler handler({OriginId(1), OriginId(2)}, OriginId(3));
+    EXPECT_EQ(handler.getOutputOriginId(), OriginId(3));
+
+    std::vector<SequenceNumber::Underlying> sequenceNumbers;
+    sequenceNumbers.emplace_back(merge(handler, 10, 1, OriginId(1)).sequenceNumber);
+    sequenceNumbers.emplace_back(merge(handler, 10, 1, OriginId(2)).sequenceNumber);
+    sequenceNumbers.emplace_back(merge(handler, 20, 2, OriginId(2)).sequenceNumber);
+    sequenceNumbers.emplace_back(merge(handler, 20, 2, OriginId(1)).sequenceNumber);
+
+    const std::vector<SequenceNumber::Underlying> expected{
+        SequenceNumber::INITIAL, SequenceNumber::INITIAL + 1, SequenceNumber::INITIAL + 2, SequenceNumber::INITIAL + 3};
+    EXPECT_EQ(sequenceNumbers, expected);
+}
+
+TEST_F(UnionOperatorHandlerTest, carriesMinimalWatermarkOfAllInputs)
+{
+    UnionOperatorHandler handler({OriginId(1), OriginId(2)}, OriginId(3));
+
+    /// The second origin has not sent any buffer yet, thus the merged watermark can not advance
+    EXPECT_EQ(merge(handler, 10, 1, OriginId(1)).watermarkTs, 0);
+    EXPECT_EQ(merge(handler, 5, 1, OriginId(2)).watermarkTs, 5);
+    EXPECT_EQ(merge(handler, 20, 2, OriginId(2)).watermarkTs, 10);
+
+    /// An out-of-order buffer does not advance the watermark of its origin until the gap is closed
+    EXPECT_EQ(merge(handler, 40, 3, OriginId(1)).watermarkTs, 10);
+    EXPECT_EQ(merge(handler, 30, 2, OriginId(1)).watermarkTs, 20);
+}
+
+}
@@ -14,20 +14,28 @@
 
 #include <ChecksumSink.hpp>
 
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <iostream>
 #include <memory>
+#include <span>
 #include <string>
 #include <system_error>
 #include <unordered_map>
 #include <utility>
 #include <Configurations/Descriptor.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Nautilus/Interface/BufferRef/TupleBufferRef.hpp>
 #include <Runtime/TupleBuffer.hpp>
+#include <Runtime/VariableSizedAccess.hpp>
 #include <Sinks/SinkDescriptor.hpp>
 #include <SinksParsing/CSVFormat.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <fmt/ostream.h>
+#include <folly/hash/SpookyHashV2.h>
 #include <ErrorHandling.hpp>
 #include <PipelineExecutionContext.hpp>
 #include <SinkRegistry.hpp>
@@ -36,17 +44,36 @@
 namespace NES
 {
 
+namespace
+{
+/// Seed of the tuple hashes. Arbitrary, but must stay fixed so that binary checksums are comparable across runs.
+constexpr uint64_t BINARY_CHECKSUM_SEED = 0x9E3779B97F4A7C15ULL;
+}
+
 ChecksumSink::ChecksumSink(BackpressureController backpressureController, const SinkDescriptor& sinkDescriptor)
     : Sink(std::move(backpressureController))
     , isOpen(false)
     , outputFilePath(sinkDescriptor.getFromConfig(SinkDescriptor::FILE_PATH))
     , formatter(std::make_unique<CSVFormat>(*sinkDescriptor.getSchema(), true))
+    , mode(sinkDescriptor.getFromConfig(ConfigParametersChecksum::CHECKSUM_MODE))
+    , memoryLayout(sinkDescriptor.getFromConfig(SinkDescriptor::MEMORY_LAYOUT))
+    , tupleSize(sinkDescriptor.getSchema()->getSizeOfSchemaInBytes())
+    , hasVarSizedFields(false)
 {
+    uint64_t fieldOffset = 0;
+    for (const auto& field : *sinkDescriptor.getSchema())
+    {
+        physicalTypes.emplace_back(field.dataType);
+        fieldOffsets.emplace_back(fieldOffset);
+        fieldOffset += field.dataType.getSizeInBytes();
+        hasVarSizedFields |= field.dataType.type == DataType::Type::VARSIZED;
+    }
 }
 
-void ChecksumSink::start(PipelineExecutionContext&)
+void ChecksumSink::start(PipelineExecutionContext& pipelineExecutionContext)
 {
     NES_DEBUG("Setting up checksum sink: {}", *this);
+    partialChecksums = std::vector<PartialChecksum>(pipelineExecutionContext.getNumberOfWorkerThreads());
     if (std::filesystem::exists(outputFilePath.c_str()))
     {
         std::error_code ec;
@@ -74,6 +101,14 @@ void ChecksumSink::start(PipelineExecutionContext&)
 
 void ChecksumSink::stop(PipelineExecutionContext&)
 {
+    /// Summation is commutative, thus the combined checksum does not depend on which worker processed which buffer.
+    for (const auto& partialChecksum : partialChecksums)
+    {
+        checksum.checksum.fetch_add(partialChecksum.checksum, std::memory_order::relaxed);
+        checksum.numberOfTuples.fetch_add(partialChecksum.numberOfTuples, std::memory_order::relaxed);
+    }
+    partialChecksums.clear();
+
     NES_INFO("Checksum Sink completed. Checksum: {}", fmt::streamed(checksum));
 
     outputFileStream << "S$Count:UINT64,S$Checksum:UINT64" << '\n';
@@ -82,11 +117,74 @@ void ChecksumSink::stop(PipelineExecutionContext&)
     isOpen = false;
 }
 
-void ChecksumSink::execute(const TupleBuffer& inputBuffer, PipelineExecutionContext&)
+void ChecksumSink::execute(const TupleBuffer& inputBuffer, PipelineExecutionContext& pipelineExecutionContext)
 {
     PRECONDITION(inputBuffer, "Invalid input buffer in ChecksumSink.");
-    const std::string formatted = formatter->getFormattedBuffer(inputBuffer);
-    checksum.add(formatted);
+    if (mode == ChecksumMode::CSV)
+    {
+        const std::string formatted = formatter->getFormattedBuffer(inputBuffer);
+        checksum.add(formatted);
+        return;
+    }
+
+    const auto workerThreadId = pipelineExecutionContext.getId().getRawValue();
+    INVARIANT(
+        workerThreadId < partialChecksums.size(),
+        "WorkerThreadId {} exceeds the number of partial checksums {}",
+        workerThreadId,
+        partialChecksums.size());
+    auto& partialChecksum = partialChecksums[workerThreadId];
+    partialChecksum.checksum += hashTuplesOfBuffer(inputBuffer);
+    partialChecksum.numberOfTuples += inputBuffer.getNumberOfTuples();
+}
+
+uint64_t ChecksumSink::hashTuplesOfBuffer(const TupleBuffer& inputBuffer) const
+{
+    const auto numberOfTuples = inputBuffer.getNumberOfTuples();
+    const auto* const bufferAddress = inputBuffer.getAvailableMemoryArea().data();
+    uint64_t bufferChecksum = 0;
+
+    /// In a row layout without variable sized fields, the bytes of a tuple are exactly the concatenation of its field bytes.
+    /// As SpookyHash yields the same hash for a single Hash64() call as for Update() calls over the parts, we can hash the whole tuple at once.
+    if (memoryLayout == MemoryLayoutType::ROW_LAYOUT && not hasVarSizedFields)
+    {
+        for (uint64_t tupleIdx = 0; tupleIdx < numberOfTuples; ++tupleIdx)
+        {
+            bufferChecksum += folly::hash::SpookyHashV2::Hash64(bufferAddress + (tupleIdx * tupleSize), tupleSize, BINARY_CHECKSUM_SEED);
+        }
+        return bufferChecksum;
+    }
+
+    /// For the column layout, a column starts after the columns of all previous fields, each taking capacity * fieldSize bytes.
+    const uint64_t capacity = inputBuffer.getBufferSize() / tupleSize;
+    for (uint64_t tupleIdx = 0; tupleIdx < numberOfTuples; ++tupleIdx)
+    {
+        folly::hash::SpookyHashV2 tupleHash;
+        tupleHash.Init(BINARY_CHECKSUM_SEED, BINARY_CHECKSUM_SEED);
+        for (size_t fieldIdx = 0; fieldIdx < physicalTypes.size(); ++fieldIdx)
+        {
+            const auto fieldSize = physicalTypes[fieldIdx].getSizeInBytes();
+            const auto* const fieldAddress = memoryLayout == MemoryLayoutType::ROW_LAYOUT
+                ? bufferAddress + (tupleIdx * tupleSize) + fieldOffsets[fieldIdx]
+                : bufferAddress + (fieldOffsets[fieldIdx] * capacity) + (tupleIdx * fieldSize);
+            if (physicalTypes[fieldIdx].type == DataType::Type::VARSIZED)
+            {
+                /// Hashing the content including its length prefix, as the VariableSizedAccess differs between otherwise equal tuples.
+                const VariableSizedAccess variableSizedAccess{*std::bit_cast<const uint64_t*>(fieldAddress)};
+                const auto varSizedValue = TupleBufferRef::loadAssociatedVarSizedValue(inputBuffer, variableSizedAccess);
+                tupleHash.Update(varSizedValue.data(), varSizedValue.size());
+            }
+            else
+            {
+                tupleHash.Update(fieldAddress, fieldSize);
+            }
+        }
+        uint64_t hash1 = 0;
+        uint64_t hash2 = 0;
+        tupleHash.Final(&hash1, &hash2);
+        bufferChecksum += hash1;
+    }
+    return bufferChecksum;
 }
 
 DescriptorConfig::Config ChecksumSink::validateAndFormat(std::unordered_map<std::string, std::string> config)
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <memory>
 #include <optional>
@@ -22,7 +23,11 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 #include <Configurations/Descriptor.hpp>
+#include <Configurations/Enums/EnumWrapper.hpp>
+#include <DataTypes/DataType.hpp>
+#include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
 #include <Runtime/TupleBuffer.hpp>
 #include <Sinks/Sink.hpp>
 #include <Sinks/SinkDescriptor.hpp>
@@ -34,6 +39,17 @@
 namespace NES
 {
 
+/// Selects how the ChecksumSink derives its checksum from the incoming tuple buffers.
+/// CSV: formats every buffer as CSV and sums up all characters. The result is comparable to the checksum tool of the systests.
+/// BINARY: hashes the raw bytes of every tuple and sums up the tuple hashes. This skips the number-to-text formatting and is meant for
+///         benchmark runs. The result is independent of the order of the tuples and of the memory layout of the input buffers, but it is
+///         not comparable to CSV checksums.
+enum class ChecksumMode : uint8_t
+{
+    CSV,
+    BINARY
+};
+
 /// A sink that counts the number of tuples and accumulates a checksum, which is written to file once the query is stopped.
 /// Example output of the sink:
 /// S$Count:UINT64,S$Checksum:UINT64
@@ -54,17 +70,43 @@ protected:
     std::ostream& toString(std::ostream& os) const override { return os << "ChecksumSink"; }
 
 private:
+    /// Partial checksum of a single worker thread. Padded to a cache line to prevent false sharing between the workers.
+    struct alignas(64) PartialChecksum
+    {
+        uint64_t checksum = 0;
+        uint64_t numberOfTuples = 0;
+    };
+
+    /// Hashes every tuple of the buffer field by field and returns the (commutative) sum of all tuple hashes.
+    [[nodiscard]] uint64_t hashTuplesOfBuffer(const TupleBuffer& inputBuffer) const;
+
     bool isOpen;
     std::string outputFilePath;
     std::ofstream outputFileStream;
     Checksum checksum;
     std::unique_ptr<Format> formatter;
+
+    ChecksumMode mode;
+    MemoryLayoutType memoryLayout;
+    std::vector<DataType> physicalTypes;
+    /// Offset of each field within a tuple. Identical for the row and column layout, as the columnar offsets depend on the buffer size.
+    std::vector<uint64_t> fieldOffsets;
+    uint64_t tupleSize;
+    bool hasVarSizedFields;
+    /// Indexed by WorkerThreadId. Only the owning worker writes to its partial checksum, thus no atomics are required.
+    std::vector<PartialChecksum> partialChecksums;
 };
 
 struct ConfigParametersChecksum
 {
+    static inline const DescriptorConfig::ConfigParameter<EnumWrapper, ChecksumMode> CHECKSUM_MODE{
+        "checksum_mode",
+        EnumWrapper(ChecksumMode::CSV),
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(CHECKSUM_MODE, config); }};
+
+    /// The memory layout of the input buffers, i.e., SinkDescriptor::MEMORY_LAYOUT, is only relevant for the BINARY checksum mode.
     static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
-        = DescriptorConfig::createConfigParameterContainerMap(SinkDescriptor::FILE_PATH);
+        = DescriptorConfig::createConfigParameterContainerMap(SinkDescriptor::FILE_PATH, CHECKSUM_MODE, SinkDescriptor::MEMORY_LAYOUT);
 };
 
 }
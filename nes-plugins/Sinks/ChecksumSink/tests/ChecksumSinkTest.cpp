@@ -0,0 +1,233 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <ChecksumSink.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sinks/SinkCatalog.hpp>
+#include <Sinks/SinkDescriptor.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <magic_enum/magic_enum.hpp>
+#include <BackpressureChannel.hpp>
+#include <BaseUnitTest.hpp>
+#include <ErrorHandling.hpp>
+#include <PipelineExecutionContext.hpp>
+
+namespace NES
+{
+
+/// Checks that the binary checksum of the same tuples does not depend on the memory layout of the buffers or the order of the buffers
+class ChecksumSinkTest : public Testing::BaseUnitTest
+{
+    struct MockedPipelineContext final : PipelineExecutionContext
+    {
+        bool emitBuffer(const TupleBuffer&, ContinuationPolicy) override
+        {
+            INVARIANT(false, "This function should not be called");
+            return false;
+        }
+
+        TupleBuffer allocateTupleBuffer() override { return bufferManager->getBufferBlocking(); }
+
+        [[nodiscard]] WorkerThreadId getId() const override { return INITIAL<WorkerThreadId>; }
+
+        [[nodiscard]] uint64_t getNumberOfWorkerThreads() const override { return 1; }
+
+        [[nodiscard]] std::shared_ptr<AbstractBufferProvider> getBufferManager() const override { return bufferManager; }
+
+        [[nodiscard]] PipelineId getPipelineId() const override { return PipelineId(1); }
+
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() override
+        {
+            return operatorHandlers;
+        }
+
+        void setOperatorHandlers(std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& opHandlers) override
+        {
+            operatorHandlers = opHandlers;
+        }
+
+        explicit MockedPipelineContext(std::shared_ptr<BufferManager> bufferManager) : bufferManager(std::move(bufferManager)) { }
+
+        void repeatTask(const TupleBuffer&, std::chrono::milliseconds) override { INVARIANT(false, "This function should not be called"); }
+
+        std::shared_ptr<BufferManager> bufferManager;
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
+    };
+
+    struct Row
+    {
+        uint64_t id;
+        int32_t value;
+        double ratio;
+    };
+
+public:
+    static constexpr uint64_t BUFFER_SIZE = 4096;
+    static constexpr uint64_t NUMBER_OF_BUFFERS = 3;
+    static constexpr uint64_t NUMBER_OF_ROWS_PER_BUFFER = 100;
+    /// id UINT64, value INT32, ratio FLOAT64
+    static constexpr uint64_t TUPLE_SIZE = sizeof(uint64_t) + sizeof(int32_t) + sizeof(double);
+    static constexpr uint64_t VALUE_OFFSET = sizeof(uint64_t);
+    static constexpr uint64_t RATIO_OFFSET = sizeof(uint64_t) + sizeof(int32_t);
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("ChecksumSinkTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup ChecksumSinkTest test class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        schema.addField("id", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::INT32));
+        schema.addField("ratio", DataTypeProvider::provideDataType(DataType::Type::FLOAT64));
+        for (uint64_t rowIdx = 0; rowIdx < NUMBER_OF_BUFFERS * NUMBER_OF_ROWS_PER_BUFFER; ++rowIdx)
+        {
+            rows.emplace_back(rowIdx, static_cast<int32_t>(rowIdx * 7) - 500, static_cast<double>(rowIdx) / 3);
+        }
+        outputFilePath = std::filesystem::temp_directory_path() / "ChecksumSinkTest.csv";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(outputFilePath);
+        BaseUnitTest::TearDown();
+    }
+
+    /// Writes the rows of each buffer in the given memory layout
+    std::vector<TupleBuffer> createBuffers(const MemoryLayoutType memoryLayout) const
+    {
+        const uint64_t capacity = BUFFER_SIZE / TUPLE_SIZE;
+        std::vector<TupleBuffer> buffers;
+        for (uint64_t bufferIdx = 0; bufferIdx < NUMBER_OF_BUFFERS; ++bufferIdx)
+        {
+            auto buffer = bufferManager->getBufferBlocking();
+            auto* const bufferAddress = buffer.getAvailableMemoryArea().data();
+            for (uint64_t tupleIdx = 0; tupleIdx < NUMBER_OF_ROWS_PER_BUFFER; ++tupleIdx)
+            {
+                const auto& row = rows[(bufferIdx * NUMBER_OF_ROWS_PER_BUFFER) + tupleIdx];
+                if (memoryLayout == MemoryLayoutType::ROW_LAYOUT)
+                {
+                    auto* const tupleAddress = bufferAddress + (tupleIdx * TUPLE_SIZE);
+                    std::memcpy(tupleAddress, &row.id, sizeof(row.id));
+                    std::memcpy(tupleAddress + VALUE_OFFSET, &row.value, sizeof(row.value));
+                    std::memcpy(tupleAddress + RATIO_OFFSET, &row.ratio, sizeof(row.ratio));
+                }
+                else
+                {
+                    std::memcpy(bufferAddress + (tupleIdx * sizeof(row.id)), &row.id, sizeof(row.id));
+                    std::memcpy(bufferAddress + (VALUE_OFFSET * capacity) + (tupleIdx * sizeof(row.value)), &row.value, sizeof(row.value));
+                    std::memcpy(bufferAddress + (RATIO_OFFSET * capacity) + (tupleIdx * sizeof(row.ratio)), &row.ratio, sizeof(row.ratio));
+                }
+            }
+            buffer.setNumberOfTuples(NUMBER_OF_ROWS_PER_BUFFER);
+            buffers.emplace_back(std::move(buffer));
+        }
+        return buffers;
+    }
+
+    /// Runs a binary checksum sink over the buffers and returns the line with the count and the checksum
+    std::string computeChecksum(const MemoryLayoutType memoryLayout, const std::vector<TupleBuffer>& buffers) const
+    {
+        const auto sinkDescriptor = SinkCatalog{}.getInlineSink(
+            schema,
+            ChecksumSink::NAME,
+            {{SinkDescriptor::FILE_PATH.name, outputFilePath.string()},
+             {ConfigParametersChecksum::CHECKSUM_MODE.name, "BINARY"},
+             {SinkDescriptor::MEMORY_LAYOUT.name, std::string(magic_enum::enum_name(memoryLayout))}});
+        EXPECT_TRUE(sinkDescriptor.has_value());
+        if (not sinkDescriptor.has_value())
+        {
+            return "";
+        }
+
+        auto [backpressureController, backpressureListener] = createBackpressureChannel();
+        ChecksumSink sink(std::move(backpressureController), *sinkDescriptor);
+        MockedPipelineContext pec{bufferManager};
+        sink.start(pec);
+        for (const auto& buffer : buffers)
+        {
+            sink.execute(buffer, pec);
+        }
+        sink.stop(pec);
+
+        std::ifstream outputFile(outputFilePath);
+        std::string header;
+        std::string countAndChecksum;
+        std::getline(outputFile, header);
+        std::getline(outputFile, countAndChecksum);
+        return countAndChecksum;
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(BUFFER_SIZE, 2 * NUMBER_OF_BUFFERS);
+    Schema schema;
+    std::vector<Row> rows;
+    std::filesystem::path outputFilePath;
+};
+
+TEST_F(ChecksumSinkTest, binaryChecksumIsIndependentOfMemoryLayout)
+{
+    const auto rowChecksum = computeChecksum(MemoryLayoutType::ROW_LAYOUT, createBuffers(MemoryLayoutType::ROW_LAYOUT));
+    const auto columnChecksum = computeChecksum(MemoryLayoutType::COLUMNAR_LAYOUT, createBuffers(MemoryLayoutType::COLUMNAR_LAYOUT));
+    EXPECT_TRUE(rowChecksum.starts_with(std::to_string(NUMBER_OF_BUFFERS * NUMBER_OF_ROWS_PER_BUFFER) + ","));
+    EXPECT_EQ(rowChecksum, columnChecksum);
+}
+
+TEST_F(ChecksumSinkTest, binaryChecksumIsIndependentOfBufferOrder)
+{
+    for (const auto memoryLayout : {MemoryLayoutType::ROW_LAYOUT, MemoryLayoutType::COLUMNAR_LAYOUT})
+    {
+        auto buffers = createBuffers(memoryLayout);
+        const auto checksum = computeChecksum(memoryLayout, buffers);
+        std::ranges::reverse(buffers);
+        EXPECT_EQ(computeChecksum(memoryLayout, buffers), checksum) << magic_enum::enum_name(memoryLayout);
+        std::ranges::rotate(buffers, buffers.begin() + 1);
+        EXPECT_EQ(computeChecksum(memoryLayout, buffers), checksum) << magic_enum::enum_name(memoryLayout);
+    }
+}
+
+TEST_F(ChecksumSinkTest, binaryChecksumDetectsChangedTuple)
+{
+    auto buffers = createBuffers(MemoryLayoutType::ROW_LAYOUT);
+    const auto checksum = computeChecksum(MemoryLayoutType::ROW_LAYOUT, buffers);
+    buffers.front().getAvailableMemoryArea<uint64_t>()[0] += 1;
+    EXPECT_NE(computeChecksum(MemoryLayoutType::ROW_LAYOUT, buffers), checksum);
+}
+
+}
@@ -17,6 +17,7 @@
 #include <ostream>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Util/CompilationOptions.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <Util/Logger/Formatter.hpp>
 #include <Pipeline.hpp>
@@ -34,12 +35,13 @@ namespace NES
 /// a @link PhysicalPlan into @link CompiledQueryPlan.
 struct PipelinedQueryPlan final
 {
-    explicit PipelinedQueryPlan(QueryId id, ExecutionMode executionMode);
+    explicit PipelinedQueryPlan(QueryId id, ExecutionMode executionMode, CompilationOptions compilationOptions);
 
     friend std::ostream& operator<<(std::ostream& os, const PipelinedQueryPlan& plan);
 
     [[nodiscard]] QueryId getQueryId() const;
     [[nodiscard]] ExecutionMode getExecutionMode() const;
+    [[nodiscard]] CompilationOptions getCompilationOptions() const;
 
     [[nodiscard]] std::vector<std::shared_ptr<Pipeline>> getSourcePipelines() const;
     [[nodiscard]] const std::vector<std::shared_ptr<Pipeline>>& getPipelines() const;
@@ -49,6 +51,7 @@ struct PipelinedQueryPlan final
 private:
     QueryId queryId;
     ExecutionMode executionMode;
+    CompilationOptions compilationOptions;
     std::vector<std::shared_ptr<Pipeline>> pipelines;
 };
 }
@@ -26,6 +26,7 @@
 #include <Identifiers/Identifiers.hpp>
 #include <Pipelines/CompiledExecutablePipelineStage.hpp>
 #include <Sources/SourceDescriptor.hpp>
+#include <Util/CompilationOptions.hpp>
 #include <Util/DumpMode.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <CompiledQueryPlan.hpp>
@@ -129,7 +130,10 @@ std::unique_ptr<ExecutablePipelineStage> LowerToCompiledQueryPlanPhase::getStage
             break;
     }
     options.setOption("dump.graph", dumpQueryCompilationIR.isDumpGraphEnabled());
-    return std::make_unique<CompiledExecutablePipelineStage>(pipeline, pipeline->getOperatorHandlers(), options);
+    /// The interpreter does not benefit from a recompilation
+    const auto recompileWithProfile = pipelineQueryPlan->getExecutionMode() == ExecutionMode::COMPILER
+        and pipelineQueryPlan->getCompilationOptions().profileGuidedRecompilation;
+    return std::make_unique<CompiledExecutablePipelineStage>(pipeline, pipeline->getOperatorHandlers(), options, recompileWithProfile);
 }
 
 std::shared_ptr<ExecutablePipeline> LowerToCompiledQueryPlanPhase::processOperatorPipeline(const std::shared_ptr<Pipeline>& pipeline)
@@ -165,7 +169,12 @@ std::unique_ptr<CompiledQueryPlan> LowerToCompiledQueryPlanPhase::apply(const st
 
     auto pipelines = std::move(pipelineToExecutableMap) | std::views::values | std::ranges::to<std::vector>();
 
-    return CompiledQueryPlan::create(pipelineQueryPlan->getQueryId(), std::move(pipelines), std::move(sinks), std::move(sources));
+    return CompiledQueryPlan::create(
+        pipelineQueryPlan->getQueryId(),
+        std::move(pipelines),
+        std::move(sinks),
+        std::move(sources),
+        pipelineQueryPlan->getCompilationOptions());
 }
 
 }
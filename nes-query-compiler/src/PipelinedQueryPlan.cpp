@@ -21,13 +21,15 @@
 #include <string>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Util/CompilationOptions.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <Pipeline.hpp>
 
 namespace NES
 {
 
-PipelinedQueryPlan::PipelinedQueryPlan(QueryId id, ExecutionMode executionMode) : queryId(id), executionMode(executionMode) { };
+PipelinedQueryPlan::PipelinedQueryPlan(QueryId id, ExecutionMode executionMode, CompilationOptions compilationOptions)
+    : queryId(id), executionMode(executionMode), compilationOptions(compilationOptions) { };
 
 static void printPipeline(const Pipeline* pipeline, std::ostream& os, int indentLevel)
 {
@@ -71,6 +73,11 @@ ExecutionMode PipelinedQueryPlan::getExecutionMode() const
     return executionMode;
 }
 
+CompilationOptions PipelinedQueryPlan::getCompilationOptions() const
+{
+    return compilationOptions;
+}
+
 const std::vector<std::shared_ptr<Pipeline>>& PipelinedQueryPlan::getPipelines() const
 {
     return pipelines;
@@ -744,6 +744,8 @@ void ThreadPool::addThread(WorkerId workerId)
                 if (auto task = taskQueue.getNextTaskBlocking(stopToken))
                 {
                     handleTask(worker, std::move(*task));
+                    /// Buffers obtained during the task might be released by other workers, which requires the owner to give up the ownership
+                    releaseBufferOwnership();
                 }
             }
 
@@ -23,8 +23,11 @@
 #include <Configurations/Enums/EnumOption.hpp>
 #include <Configurations/ScalarOption.hpp>
 #include <Configurations/Validation/FloatValidation.hpp>
+#include <Configurations/Validation/NonZeroValidation.hpp>
 #include <Configurations/Validation/NumberValidation.hpp>
+#include <Util/AggregationSliceLayout.hpp>
 #include <Util/ExecutionMode.hpp>
+#include <Util/SelectionStrategy.hpp>
 
 namespace NES
 {
@@ -34,11 +37,15 @@ static constexpr auto DEFAULT_PAGED_VECTOR_SIZE = 1024;
 static constexpr auto DEFAULT_OPERATOR_BUFFER_SIZE = 4096;
 static constexpr auto DEFAULT_NUMBER_OF_RECORDS_PER_KEY = 10;
 static constexpr auto DEFAULT_MAX_NUMBER_OF_BUCKETS = 10'000.0;
+static constexpr auto DEFAULT_WINDOW_TRIGGER_BATCH_SIZE = 16;
+static constexpr auto DEFAULT_EARLY_FIRE_SLICE_SIZE_MS = 1000;
 
 enum class StreamJoinStrategy : uint8_t
 {
     NESTED_LOOP_JOIN,
     HASH_JOIN,
+    /// Hash join that emits joined records as soon as both tuples have arrived instead of once the window gets triggered
+    SYMMETRIC_HASH_JOIN,
     OPTIMIZER_CHOOSES
 };
 
@@ -53,6 +60,12 @@ public:
            ExecutionMode::COMPILER,
            "Execution mode for the query compiler"
            "[COMPILER|INTERPRETER]."};
+    BoolOption profileGuidedRecompilation
+        = {"profile_guided_recompilation",
+           "false",
+           "Recompiles a pipeline in the background after a warm-up, so that the recompiled pipeline is specialized for the statistics "
+           "that its operators gathered during the warm-up, e.g., the selectivity of a selection with the adaptive selection strategy. "
+           "Pipelines without such statistics are not recompiled."};
     UIntOption numberOfPartitions
         = {"number_of_partitions",
            std::to_string(DEFAULT_NUMBER_OF_PARTITIONS_DATASTRUCTURES),
@@ -78,23 +91,73 @@ public:
            std::to_string(DEFAULT_OPERATOR_BUFFER_SIZE),
            "Buffer size of a operator e.g. during scan",
            {std::make_shared<NumberValidation>()}};
+    UIntOption windowTriggerBatchSize
+        = {"window_trigger_batch_size",
+           std::to_string(DEFAULT_WINDOW_TRIGGER_BATCH_SIZE),
+           "Maximal number of aggregation windows that become ready at once and get probed by a single task. 1 probes each window in its "
+           "own task. Must be at least 1.",
+           {std::make_shared<NumberValidation>(), std::make_shared<NonZeroValidation>()}};
+    UIntOption earlyFireInterval
+        = {"early_fire_interval",
+           "0",
+           "Processing time in ms between two provisional results of windowed aggregations, which are emitted before the watermark passes "
+           "the window end. Provisional results are not marked as such. Thus, only aggregations whose results flow into a sink without "
+           "passing another stateful operator fire early. 0 disables this trigger.",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption earlyFireNumberOfTuples
+        = {"early_fire_number_of_tuples",
+           "0",
+           "Number of tuples that windowed aggregations insert into their slices between two provisional results. Like "
+           "early_fire_interval, only applies to aggregations whose results flow into a sink without passing another stateful operator. "
+           "0 disables this trigger.",
+           {std::make_shared<NumberValidation>()}};
+    UIntOption earlyFireSliceSize
+        = {"early_fire_slice_size",
+           std::to_string(DEFAULT_EARLY_FIRE_SLICE_SIZE_MS),
+           "Maximal event time span in ms of a slice, if early firing is enabled. A provisional result contains all slices of a window "
+           "that end at or before the watermark. Smaller slices make provisional results more recent, but add overhead.",
+           {std::make_shared<NumberValidation>()}};
     EnumOption<StreamJoinStrategy> joinStrategy
         = {"join_strategy",
            StreamJoinStrategy::OPTIMIZER_CHOOSES,
            "Join Strategy"
-           "[NESTED_LOOP_JOIN|HASH_JOIN|OPTIMIZER_CHOOSES]."};
+           "[NESTED_LOOP_JOIN|HASH_JOIN|SYMMETRIC_HASH_JOIN|OPTIMIZER_CHOOSES]."};
+    EnumOption<SelectionStrategy> selectionStrategy
+        = {"selection_strategy",
+           SelectionStrategy::BRANCHING,
+           "Evaluation strategy of selections that directly follow a scan"
+           "[BRANCHING|PREDICATED|ADAPTIVE]."};
+    EnumOption<AggregationSliceLayout> aggregationSliceLayout
+        = {"aggregation_slice_layout",
+           AggregationSliceLayout::OPTIMIZER_CHOOSES,
+           "Layout of the hash maps of a slice of a windowed aggregation. PER_WORKER stores one hash map per worker thread, SHARED "
+           "stores one set of hash maps that all worker threads share. OPTIMIZER_CHOOSES decides based on estimated_number_of_keys"
+           "[PER_WORKER|SHARED|OPTIMIZER_CHOOSES]."};
+    UIntOption estimatedNumberOfKeys
+        = {"estimated_number_of_keys",
+           "0",
+           "Estimated number of distinct keys per slice of a keyed windowed aggregation. 0 means that the number of keys is unknown.",
+           {std::make_shared<NumberValidation>()}};
 
 private:
     std::vector<BaseOption*> getOptions() override
     {
         return {
             &executionMode,
+            &profileGuidedRecompilation,
             &pageSize,
             &numberOfPartitions,
             &joinStrategy,
+            &selectionStrategy,
+            &aggregationSliceLayout,
+            &estimatedNumberOfKeys,
             &numberOfRecordsPerKey,
             &maxNumberOfBuckets,
-            &operatorBufferSize};
+            &operatorBufferSize,
+            &windowTriggerBatchSize,
+            &earlyFireInterval,
+            &earlyFireNumberOfTuples,
+            &earlyFireSliceSize};
     }
 };
 
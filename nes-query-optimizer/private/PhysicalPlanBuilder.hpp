@@ -18,6 +18,7 @@
 #include <memory>
 #include <vector>
 #include <Identifiers/Identifiers.hpp>
+#include <Util/CompilationOptions.hpp>
 #include <Util/ExecutionMode.hpp>
 #include <PhysicalOperator.hpp>
 #include <PhysicalPlan.hpp>
@@ -34,6 +35,7 @@ public:
     explicit PhysicalPlanBuilder(QueryId id);
     void addSinkRoot(std::shared_ptr<PhysicalOperatorWrapper> sink);
     void setExecutionMode(ExecutionMode mode);
+    void setCompilationOptions(CompilationOptions options);
     void setOperatorBufferSize(uint64_t bufferSize);
 
     /// R-value as finalize should be called once at the end, with a move() to 'build' the plan.
@@ -43,6 +45,7 @@ private:
     QueryId queryId;
     Roots sinks;
     ExecutionMode executionMode;
+    CompilationOptions compilationOptions;
     uint64_t operatorBufferSize{};
 
     /// Used internally to flip the plan from sink->source tstatic o source->sink
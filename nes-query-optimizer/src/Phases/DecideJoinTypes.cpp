@@ -104,7 +104,7 @@ LogicalOperator DecideJoinTypes::apply(const LogicalOperator& logicalOperator)
         else
         {
             tryInsert(traitSet, JoinImplementationTypeTrait{JoinImplementation::NESTED_LOOP_JOIN});
-            if (this->joinStrategy == StreamJoinStrategy::HASH_JOIN)
+            if (this->joinStrategy == StreamJoinStrategy::HASH_JOIN or this->joinStrategy == StreamJoinStrategy::SYMMETRIC_HASH_JOIN)
             {
                 NES_WARNING(
                     "Operator {} has not the HashJoinTrait, as the hash join is not supported for the join condition. Therefore, we "
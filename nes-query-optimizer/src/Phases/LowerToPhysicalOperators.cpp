@@ -20,11 +20,17 @@
 #include <utility>
 #include <vector>
 #include <Operators/LogicalOperator.hpp>
+#include <Operators/ProjectionLogicalOperator.hpp>
+#include <Operators/SelectionLogicalOperator.hpp>
+#include <Operators/Sinks/SinkLogicalOperator.hpp>
+#include <Operators/UnionLogicalOperator.hpp>
+#include <Operators/Windows/WindowedAggregationLogicalOperator.hpp>
 #include <Plans/LogicalPlan.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
 #include <Traits/ImplementationTypeTrait.hpp>
 #include <Traits/Trait.hpp>
 #include <Traits/TraitSet.hpp>
+#include <Util/CompilationOptions.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
 #include <PhysicalOperator.hpp>
@@ -74,6 +80,35 @@ resolveRewriteRule(const LogicalOperator& logicalOperator, const RewriteRuleRegi
     }
     throw UnknownOptimizerRule("Rewrite rule for logical operator '{}' can't be resolved", logicalOperator.getName());
 }
+
+/// Provisional results of an early firing windowed aggregation are indistinguishable from its final results. Thus, we only enable early
+/// firing for operators, whose results flow into a sink solely via operators that process each record on its own. Any stateful consumer,
+/// e.g., a join or another aggregation, would combine provisional results as if they were final ones.
+RewriteRuleRegistryArguments getRegistryArgumentOfChild(
+    const LogicalOperator& parent, const LogicalOperator& child, const RewriteRuleRegistryArguments& registryArgument)
+{
+    if (parent.tryGetAs<SinkLogicalOperator>().has_value() or parent.tryGetAs<ProjectionLogicalOperator>().has_value()
+        or parent.tryGetAs<SelectionLogicalOperator>().has_value() or parent.tryGetAs<UnionLogicalOperator>().has_value())
+    {
+        return registryArgument;
+    }
+
+    auto childRegistryArgument = registryArgument;
+    const auto earlyFireEnabled
+        = childRegistryArgument.conf.earlyFireInterval.getValue() > 0 or childRegistryArgument.conf.earlyFireNumberOfTuples.getValue() > 0;
+    if (earlyFireEnabled and child.tryGetAs<WindowedAggregationLogicalOperator>().has_value())
+    {
+        NES_WARNING("Disabling early firing for {}, as its results are consumed by {}", child, parent);
+    }
+    childRegistryArgument.conf.earlyFireInterval.setValue(0);
+    childRegistryArgument.conf.earlyFireNumberOfTuples.setValue(0);
+    return childRegistryArgument;
+}
+
+CompilationOptions getCompilationOptions(const QueryExecutionConfiguration& conf)
+{
+    return {.profileGuidedRecompilation = conf.profileGuidedRecompilation.getValue()};
+}
 }
 
 RewriteRuleResultSubgraph::SubGraphRoot
@@ -114,10 +149,11 @@ lowerOperatorRecursively(const LogicalOperator& logicalOperator, const RewriteRu
 
     std::ranges::for_each(
         std::views::zip(children, leafs),
-        [&registryArgument](const auto& zippedPair)
+        [&logicalOperator, &registryArgument](const auto& zippedPair)
         {
             const auto& [child, leaf] = zippedPair;
-            auto rootNodeOfLoweredChild = lowerOperatorRecursively(child, registryArgument);
+            auto rootNodeOfLoweredChild
+                = lowerOperatorRecursively(child, getRegistryArgumentOfChild(logicalOperator, child, registryArgument));
             leaf->addChild(rootNodeOfLoweredChild);
         });
     return root;
@@ -137,6 +173,7 @@ PhysicalPlan apply(const LogicalPlan& queryPlan, const QueryExecutionConfigurati
     auto physicalPlanBuilder = PhysicalPlanBuilder(queryPlan.getQueryId());
     physicalPlanBuilder.addSinkRoot(newRootOperators[0]);
     physicalPlanBuilder.setExecutionMode(conf.executionMode.getValue());
+    physicalPlanBuilder.setCompilationOptions(getCompilationOptions(conf));
     physicalPlanBuilder.setOperatorBufferSize(conf.operatorBufferSize.getValue());
     return std::move(physicalPlanBuilder).finalize();
 }
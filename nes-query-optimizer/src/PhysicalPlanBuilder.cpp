@@ -45,6 +45,11 @@ void PhysicalPlanBuilder::setExecutionMode(ExecutionMode mode)
     executionMode = mode;
 }
 
+void PhysicalPlanBuilder::setCompilationOptions(CompilationOptions options)
+{
+    compilationOptions = options;
+}
+
 void PhysicalPlanBuilder::setOperatorBufferSize(uint64_t bufferSize)
 {
     operatorBufferSize = bufferSize;
@@ -53,7 +58,7 @@ void PhysicalPlanBuilder::setOperatorBufferSize(uint64_t bufferSize)
 PhysicalPlan PhysicalPlanBuilder::finalize() &&
 {
     auto sources = flip(sinks);
-    return {queryId, std::move(sources), executionMode, operatorBufferSize};
+    return {queryId, std::move(sources), executionMode, compilationOptions, operatorBufferSize};
 }
 
 using PhysicalOpPtr = std::shared_ptr<PhysicalOperatorWrapper>;
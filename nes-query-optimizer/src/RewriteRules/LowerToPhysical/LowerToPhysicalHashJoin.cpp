@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <tuple>
@@ -62,6 +63,7 @@
 #include <HashMapOptions.hpp>
 #include <MapPhysicalOperator.hpp>
 #include <PhysicalOperator.hpp>
+#include <QueryExecutionConfiguration.hpp>
 #include <RewriteRuleRegistry.hpp>
 
 namespace NES
@@ -208,7 +210,7 @@ createHashMapOptions(std::vector<FieldNamesExtension>& joinFieldExtensions, Sche
             const bool fieldReplaceSuccess = inputSchema.replaceTypeOfField(fieldExtension.newName, fieldExtension.newDataType);
             INVARIANT(fieldReplaceSuccess, "Expect to change the type of {} for {}", fieldExtension.newName, inputSchema);
         }
-        keySize += fieldExtension.newDataType.getSizeInBytes();
+        keySize += ChainedEntryMemoryProvider::getFieldSizeInEntry(fieldExtension.newDataType);
         keyFunctions.emplace_back(QueryCompilation::FunctionProvider::lowerFunction(fieldAccessKey));
         fieldKeyNames.emplace_back(fieldExtension.newName);
     }
@@ -280,12 +282,58 @@ RewriteRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logical
     auto leftHashMapOptions = createHashMapOptions(leftJoinFields, newLeftInputSchema, conf);
     auto rightHashMapOptions = createHashMapOptions(rightJoinFields, newRightInputSchema, conf);
 
+    /// The symmetric hash join joins the tuples per slice. Thus, it requires a tumbling window, for which each slice is a window.
+    /// Additionally, it reads the tuples of the other side while their pages still get filled. Thus, the tuples must not contain variable
+    /// sized data, as the child buffers of a page might get reallocated while another worker thread reads them.
+    const auto isTumblingWindow = windowType->getSize().getTime() == windowType->getSlide().getTime();
+    const auto isVarSized = [](const Schema::Field& field)
+    { return field.dataType.isType(DataType::Type::VARSIZED) or field.dataType.isType(DataType::Type::VARSIZED_POINTER_REP); };
+    const auto hasVarSizedFields = std::ranges::any_of(newLeftInputSchema.getFields(), isVarSized)
+        or std::ranges::any_of(newRightInputSchema.getFields(), isVarSized);
+    const auto useSymmetricHashJoin
+        = conf.joinStrategy.getValue() == StreamJoinStrategy::SYMMETRIC_HASH_JOIN and isTumblingWindow and not hasVarSizedFields;
+    if (conf.joinStrategy.getValue() == StreamJoinStrategy::SYMMETRIC_HASH_JOIN and not useSymmetricHashJoin)
+    {
+        NES_WARNING(
+            "The symmetric hash join requires a tumbling window and tuples without variable sized data. Therefore, we fall-back to the "
+            "hash join for {}",
+            logicalOperator);
+    }
+    std::optional<SymmetricHashJoinOptions> leftSymmetricHashJoinOptions;
+    std::optional<SymmetricHashJoinOptions> rightSymmetricHashJoinOptions;
+    std::optional<std::shared_ptr<TupleBufferRef>> symmetricResultBufferRef;
+    if (useSymmetricHashJoin)
+    {
+        auto resultBufferRef = LowerSchemaProvider::lowerSchema(conf.operatorBufferSize.getValue(), outputSchema, memoryLayoutType);
+        leftSymmetricHashJoinOptions = SymmetricHashJoinOptions{
+            .otherSideBufferRef = rightBufferRef,
+            .otherSideHashMapOptions = rightHashMapOptions,
+            .resultBufferRef = resultBufferRef,
+            .windowMetaData = join->getWindowMetaData()};
+        rightSymmetricHashJoinOptions = SymmetricHashJoinOptions{
+            .otherSideBufferRef = leftBufferRef,
+            .otherSideHashMapOptions = leftHashMapOptions,
+            .resultBufferRef = resultBufferRef,
+            .windowMetaData = join->getWindowMetaData()};
+        symmetricResultBufferRef = resultBufferRef;
+    }
+
     /// Creating the left and right hash join build operator
     auto handlerId = getNextOperatorHandlerId();
     const HJBuildPhysicalOperator leftBuildOperator{
-        handlerId, JoinBuildSideType::Left, timeStampFieldLeft.toTimeFunction(), leftBufferRef, leftHashMapOptions};
+        handlerId,
+        JoinBuildSideType::Left,
+        timeStampFieldLeft.toTimeFunction(),
+        leftBufferRef,
+        leftHashMapOptions,
+        std::move(leftSymmetricHashJoinOptions)};
     const HJBuildPhysicalOperator rightBuildOperator{
-        handlerId, JoinBuildSideType::Right, timeStampFieldRight.toTimeFunction(), rightBufferRef, rightHashMapOptions};
+        handlerId,
+        JoinBuildSideType::Right,
+        timeStampFieldRight.toTimeFunction(),
+        rightBufferRef,
+        rightHashMapOptions,
+        std::move(rightSymmetricHashJoinOptions)};
 
     /// Creating the hash join probe
     auto joinSchema = JoinSchema(newLeftInputSchema, newRightInputSchema, outputSchema);
@@ -297,14 +345,15 @@ RewriteRuleResultSubgraph LowerToPhysicalHashJoin::apply(LogicalOperator logical
         leftBufferRef,
         rightBufferRef,
         leftHashMapOptions,
-        rightHashMapOptions);
+        rightHashMapOptions,
+        std::move(symmetricResultBufferRef));
 
 
     /// Creating the hash join operator handler
     auto sliceAndWindowStore
         = std::make_unique<DefaultTimeBasedSliceStore>(windowType->getSize().getTime(), windowType->getSlide().getTime());
-    auto handler
-        = std::make_shared<HJOperatorHandler>(inputOriginIds, outputOriginId, std::move(sliceAndWindowStore), conf.maxNumberOfBuckets);
+    auto handler = std::make_shared<HJOperatorHandler>(
+        inputOriginIds, outputOriginId, std::move(sliceAndWindowStore), conf.maxNumberOfBuckets, useSymmetricHashJoin);
 
 
     /// Building operator wrapper for the two builds and the probe.
@@ -15,14 +15,20 @@
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalSelection.hpp>
 
 #include <memory>
+#include <optional>
+#include <vector>
 #include <Functions/FunctionProvider.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/SelectionLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
 #include <Traits/MemoryLayoutTypeTrait.hpp>
+#include <Util/ExecutionMode.hpp>
+#include <Util/SelectionStrategy.hpp>
 #include <ErrorHandling.hpp>
 #include <PhysicalOperator.hpp>
 #include <RewriteRuleRegistry.hpp>
+#include <SelectionOperatorHandler.hpp>
 #include <SelectionPhysicalOperator.hpp>
 
 namespace NES
@@ -34,16 +40,38 @@ RewriteRuleResultSubgraph LowerToPhysicalSelection::apply(LogicalOperator logica
     const auto selection = logicalOperator.getAs<SelectionLogicalOperator>();
     const auto function = selection->getPredicate();
     const auto func = QueryCompilation::FunctionProvider::lowerFunction(function);
-    auto physicalOperator = SelectionPhysicalOperator(func);
     const auto memoryLayoutTypeTrait = logicalOperator.getTraitSet().tryGet<MemoryLayoutTypeTrait>();
     PRECONDITION(memoryLayoutTypeTrait.has_value(), "Expected a memory layout type trait");
     const auto memoryLayoutType = memoryLayoutTypeTrait.value().memoryLayout;
+
+    /// The adaptive strategy observes the selectivity across all buffers and worker threads of the pipeline in an operator handler
+    const auto strategy = conf.selectionStrategy.getValue();
+    std::optional<OperatorHandlerId> handlerId;
+    std::optional<std::shared_ptr<OperatorHandler>> handler;
+    PhysicalOperator physicalOperator;
+    if (strategy == SelectionStrategy::ADAPTIVE)
+    {
+        const auto selectionHandler = std::make_shared<SelectionOperatorHandler>();
+        handlerId = getNextOperatorHandlerId();
+        handler = selectionHandler;
+        /// The interpreter does not recompile pipelines. Thus, the selection must keep adapting to the selectivity.
+        const auto specializeForProfile
+            = conf.profileGuidedRecompilation.getValue() and conf.executionMode.getValue() == ExecutionMode::COMPILER;
+        physicalOperator = SelectionPhysicalOperator(func, handlerId.value(), selectionHandler, specializeForProfile);
+    }
+    else
+    {
+        physicalOperator = SelectionPhysicalOperator(func, strategy);
+    }
+
     const auto wrapper = std::make_shared<PhysicalOperatorWrapper>(
         physicalOperator,
         logicalOperator.getInputSchemas()[0],
         logicalOperator.getOutputSchema(),
         memoryLayoutType,
         memoryLayoutType,
+        handlerId,
+        handler,
         PhysicalOperatorWrapper::PipelineLocation::INTERMEDIATE);
 
     /// Creates a physical leaf for each logical leaf. Required, as this operator can have any number of sources.
@@ -15,10 +15,14 @@
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalSink.hpp>
 
 #include <memory>
+#include <Configurations/Enums/EnumWrapper.hpp>
+#include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/Sinks/SinkLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
+#include <Sinks/SinkDescriptor.hpp>
 #include <Traits/MemoryLayoutTypeTrait.hpp>
+#include <magic_enum/magic_enum.hpp>
 #include <ErrorHandling.hpp>
 #include <PhysicalOperator.hpp>
 #include <RewriteRuleRegistry.hpp>
@@ -32,10 +36,24 @@ RewriteRuleResultSubgraph LowerToPhysicalSink::apply(LogicalOperator logicalOper
     PRECONDITION(logicalOperator.tryGetAs<SinkLogicalOperator>(), "Expected a SinkLogicalOperator");
     auto sink = logicalOperator.getAs<SinkLogicalOperator>();
     PRECONDITION(sink->getSinkDescriptor().has_value(), "Expected SinkLogicalOperator to have sink descriptor");
+    const auto sinkDescriptor = sink->getSinkDescriptor().value(); /// NOLINT(bugprone-unchecked-optional-access)
     const auto memoryLayoutTypeTrait = logicalOperator.getTraitSet().tryGet<MemoryLayoutTypeTrait>();
     PRECONDITION(memoryLayoutTypeTrait.has_value(), "Expected a memory layout type trait");
     const auto memoryLayoutType = memoryLayoutTypeTrait.value().memoryLayout;
-    auto physicalOperator = SinkPhysicalOperator(sink->getSinkDescriptor().value()); /// NOLINT(bugprone-unchecked-optional-access)
+    /// Sinks that interpret the raw bytes of their input would silently read wrong values from buffers of another memory layout
+    if (const auto sinkMemoryLayout = sinkDescriptor.tryGetFromConfig(SinkDescriptor::MEMORY_LAYOUT))
+    {
+        if (sinkMemoryLayout->asEnum<MemoryLayoutType>() != memoryLayoutType)
+        {
+            throw InvalidConfigParameter(
+                "The {} of sink {} is {}, but its input has the memory layout {}",
+                SinkDescriptor::MEMORY_LAYOUT.name,
+                sinkDescriptor.getSinkName(),
+                sinkMemoryLayout->getValue(),
+                magic_enum::enum_name(memoryLayoutType));
+        }
+    }
+    auto physicalOperator = SinkPhysicalOperator(sinkDescriptor);
     const auto wrapper = std::make_shared<PhysicalOperatorWrapper>(
         physicalOperator,
         sink.getInputSchemas()[0],
@@ -15,16 +15,20 @@
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalUnion.hpp>
 
 #include <memory>
-#include <optional>
 #include <ranges>
 #include <vector>
+#include <Identifiers/Identifiers.hpp>
 #include <Operators/LogicalOperator.hpp>
 #include <Operators/UnionLogicalOperator.hpp>
 #include <RewriteRules/AbstractRewriteRule.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
 #include <Traits/MemoryLayoutTypeTrait.hpp>
+#include <Traits/OutputOriginIdsTrait.hpp>
+#include <Traits/TraitSet.hpp>
 #include <ErrorHandling.hpp>
 #include <PhysicalOperator.hpp>
 #include <RewriteRuleRegistry.hpp>
+#include <UnionOperatorHandler.hpp>
 #include <UnionPhysicalOperator.hpp>
 #include <UnionRenamePhysicalOperator.hpp>
 
@@ -41,6 +45,20 @@ RewriteRuleResultSubgraph LowerToPhysicalUnion::apply(LogicalOperator logicalOpe
     const auto memoryLayoutTypeTrait = logicalOperator.getTraitSet().tryGet<MemoryLayoutTypeTrait>();
     PRECONDITION(memoryLayoutTypeTrait.has_value(), "Expected a memory layout type trait");
     const auto memoryLayoutType = memoryLayoutTypeTrait.value().memoryLayout;
+    const auto outputOriginIdsOpt = getTrait<OutputOriginIdsTrait>(logicalOperator.getTraitSet());
+    PRECONDITION(outputOriginIdsOpt.has_value(), "Expected the outputOriginIds trait to be set");
+    PRECONDITION(std::ranges::size(outputOriginIdsOpt.value()) == 1, "Expected one output origin id");
+    const auto outputOriginId = outputOriginIdsOpt.value()[0];
+
+    /// The union merges all origins of its children into its single output origin
+    std::vector<OriginId> inputOriginIds;
+    for (const auto& child : logicalOperator.getChildren())
+    {
+        const auto inputOriginIdsOpt = getTrait<OutputOriginIdsTrait>(child.getTraitSet());
+        PRECONDITION(inputOriginIdsOpt.has_value(), "Expected the inputOriginIds trait to be set");
+        inputOriginIds.insert(inputOriginIds.end(), inputOriginIdsOpt.value().begin(), inputOriginIdsOpt.value().end());
+    }
+
     auto renames = inputSchemas
         | std::views::transform(
                        [&](const auto& schema)
@@ -55,14 +73,16 @@ RewriteRuleResultSubgraph LowerToPhysicalUnion::apply(LogicalOperator logicalOpe
                        })
         | std::ranges::to<std::vector>();
 
+    const auto handlerId = getNextOperatorHandlerId();
+    const auto handler = std::make_shared<UnionOperatorHandler>(inputOriginIds, outputOriginId);
     const auto wrapper = std::make_shared<PhysicalOperatorWrapper>(
-        UnionPhysicalOperator(),
+        UnionPhysicalOperator(handlerId, outputOriginId),
         source.getOutputSchema(),
         logicalOperator.getOutputSchema(),
         memoryLayoutType,
         memoryLayoutType,
-        std::nullopt,
-        std::nullopt,
+        handlerId,
+        handler,
         PhysicalOperatorWrapper::PipelineLocation::INTERMEDIATE,
         renames);
 
@@ -14,6 +14,7 @@
 
 #include <RewriteRules/LowerToPhysical/LowerToPhysicalWindowedAggregation.hpp>
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <numeric>
@@ -42,6 +43,7 @@
 #include <Traits/MemoryLayoutTypeTrait.hpp>
 #include <Traits/OutputOriginIdsTrait.hpp>
 #include <Traits/TraitSet.hpp>
+#include <Util/AggregationSliceLayout.hpp>
 #include <Watermark/TimeFunction.hpp>
 #include <WindowTypes/Measures/TimeCharacteristic.hpp>
 #include <WindowTypes/Types/TimeBasedWindowType.hpp>
@@ -144,6 +146,28 @@ getAggregationPhysicalFunctions(const WindowedAggregationLogicalOperator& logica
     }
     return aggregationPhysicalFunctions;
 }
+
+/// The per-worker layout stores each key once per worker thread. Once the aggregation states of the estimated keys do not fit into the
+/// cache of a core anymore, each copy costs a cache miss and the trigger has to combine them. Then, we share the hashmaps of a slice.
+constexpr uint64_t MIN_SIZE_OF_AGGREGATION_STATES_FOR_SHARED_SLICES = 1024 * 1024;
+
+AggregationSliceLayout
+chooseSliceLayout(const QueryExecutionConfiguration& configuration, const bool hasGroupingKeys, const uint64_t entrySize)
+{
+    const auto sliceLayout = configuration.aggregationSliceLayout.getValue();
+    if (sliceLayout != AggregationSliceLayout::OPTIMIZER_CHOOSES)
+    {
+        return sliceLayout;
+    }
+
+    /// A global aggregation has a single key, which all worker threads would update under the same lock
+    const auto estimatedSizeOfAggregationStates = configuration.estimatedNumberOfKeys.getValue() * entrySize;
+    if (hasGroupingKeys and estimatedSizeOfAggregationStates >= MIN_SIZE_OF_AGGREGATION_STATES_FOR_SHARED_SLICES)
+    {
+        return AggregationSliceLayout::SHARED;
+    }
+    return AggregationSliceLayout::PER_WORKER;
+}
 }
 
 RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOperator logicalOperator)
@@ -191,12 +215,13 @@ RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOpera
             INVARIANT(fieldReplaceSuccess, "Expect to change the type of {} for {}", nodeFunctionKey.getFieldName(), newInputSchema);
         }
         keyFunctions.emplace_back(QueryCompilation::FunctionProvider::lowerFunction(nodeFunctionKey));
-        keySize += DataTypeProvider::provideDataType(loweredFunctionType.type).getSizeInBytes();
+        keySize += ChainedEntryMemoryProvider::getFieldSizeInEntry(loweredFunctionType);
     }
     const auto entrySize = sizeof(ChainedHashMapEntry) + keySize + valueSize;
     const auto numberOfBuckets = conf.numberOfPartitions.getValue();
     const auto pageSize = conf.pageSize.getValue();
     const auto entriesPerPage = pageSize / entrySize;
+    const auto sliceLayout = chooseSliceLayout(conf, not keyFunctions.empty(), entrySize);
 
     const auto& [fieldKeyNames, fieldValueNames] = getKeyAndValueFields(*aggregation);
     const auto& [fieldKeys, fieldValues] = ChainedEntryMemoryProvider::createFieldOffsets(newInputSchema, fieldKeyNames, fieldValueNames);
@@ -215,11 +240,29 @@ RewriteRuleResultSubgraph LowerToPhysicalWindowedAggregation::apply(LogicalOpera
         pageSize,
         numberOfBuckets);
 
-    auto sliceAndWindowStore
-        = std::make_unique<DefaultTimeBasedSliceStore>(windowType->getSize().getTime(), windowType->getSlide().getTime());
+    /// Provisional results can only contain slices that are completed. Thus, early firing requires slices that are shorter than the window.
+    const EarlyFireTrigger earlyFireTrigger{
+        .interval = std::chrono::milliseconds(conf.earlyFireInterval.getValue()),
+        .numberOfTuples = conf.earlyFireNumberOfTuples.getValue()};
+    const auto maxSliceSize = earlyFireTrigger.isEnabled() ? conf.earlyFireSliceSize.getValue() : 0;
+
+    /// Windows that become ready at once share a sequence number, so that a single probe task emits all of them
+    if (conf.windowTriggerBatchSize.getValue() < 1)
+    {
+        throw InvalidConfigParameter(
+            "{} must be at least 1, but is {}", conf.windowTriggerBatchSize.getName(), conf.windowTriggerBatchSize.getValue());
+    }
+    auto sliceAndWindowStore = std::make_unique<DefaultTimeBasedSliceStore>(
+        windowType->getSize().getTime(), windowType->getSlide().getTime(), conf.windowTriggerBatchSize.getValue(), maxSliceSize);
     auto handler = std::make_shared<AggregationOperatorHandler>(
-        inputOriginIds | std::ranges::to<std::vector>(), outputOriginId, std::move(sliceAndWindowStore), conf.maxNumberOfBuckets);
-    auto build = AggregationBuildPhysicalOperator(handlerId, std::move(timeFunction), aggregationPhysicalFunctions, hashMapOptions);
+        inputOriginIds | std::ranges::to<std::vector>(),
+        outputOriginId,
+        std::move(sliceAndWindowStore),
+        conf.maxNumberOfBuckets,
+        earlyFireTrigger,
+        sliceLayout);
+    auto build
+        = AggregationBuildPhysicalOperator(handlerId, std::move(timeFunction), aggregationPhysicalFunctions, hashMapOptions, sliceLayout);
     auto probe = AggregationProbePhysicalOperator(hashMapOptions, aggregationPhysicalFunctions, handlerId, windowMetaData);
 
     auto buildWrapper = std::make_shared<PhysicalOperatorWrapper>(
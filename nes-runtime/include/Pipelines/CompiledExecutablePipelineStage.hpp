@@ -13,6 +13,8 @@
 */
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <unordered_map>
@@ -23,33 +25,55 @@
 #include <ExecutablePipelineStage.hpp>
 #include <ExecutionContext.hpp>
 #include <Pipeline.hpp>
+#include <Thread.hpp>
 
 namespace NES
 {
 class DumpHelper;
 
 /// A compiled executable pipeline stage uses nautilus-lib to compile a pipeline to a code snippet.
+/// If recompileWithProfile is set, the stage recompiles the pipeline in the background after a warm-up of
+/// PROFILE_WARM_UP_NUMBER_OF_BUFFERS buffers. Operators gather runtime statistics during the warm-up and specialize the code that they
+/// trace during the recompilation for them. The recompiled pipeline replaces the initial one between two tasks. If no operator has a
+/// profile at the end of the warm-up, the stage keeps executing the initial pipeline.
 class CompiledExecutablePipelineStage final : public ExecutablePipelineStage
 {
 public:
+    static constexpr uint64_t PROFILE_WARM_UP_NUMBER_OF_BUFFERS = 1000;
+
     CompiledExecutablePipelineStage(
         std::shared_ptr<Pipeline> pipeline,
         std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandler,
-        nautilus::engine::Options options);
+        nautilus::engine::Options options,
+        bool recompileWithProfile = false);
     void start(PipelineExecutionContext& pipelineExecutionContext) override;
     void execute(const TupleBuffer& inputTupleBuffer, PipelineExecutionContext& pipelineExecutionContext) override;
     void stop(PipelineExecutionContext& pipelineExecutionContext) override;
 
+    /// Returns true once the recompiled pipeline replaced the initial one
+    [[nodiscard]] bool hasRecompiledPipeline() const;
+
 protected:
     std::ostream& toString(std::ostream& os) const override;
 
 private:
-    [[nodiscard]] nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*>
-    compilePipeline() const;
+    using CompiledPipelineFunction = nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*>;
+
+    [[nodiscard]] CompiledPipelineFunction compilePipeline() const;
+    [[nodiscard]] bool hasProfileForRecompilation() const;
+    void recompilePipeline();
     nautilus::engine::NautilusEngine engine;
-    nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*> compiledPipelineFunction;
+    CompiledPipelineFunction compiledPipelineFunction;
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers;
     std::shared_ptr<Pipeline> pipeline;
+
+    /// The recompiled pipeline function is written once by the recompilation thread before it sets isRecompiled
+    bool recompileWithProfile;
+    std::atomic<uint64_t> numberOfExecutedBuffers{0};
+    std::atomic<bool> isRecompiled{false};
+    CompiledPipelineFunction recompiledPipelineFunction;
+    /// Declared last, as the recompilation thread accesses all other members and is joined upon destruction
+    Thread recompilationThread;
 };
 
 }
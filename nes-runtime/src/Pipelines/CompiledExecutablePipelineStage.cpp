@@ -13,9 +13,11 @@
 */
 #include <Pipelines/CompiledExecutablePipelineStage.hpp>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <unordered_map>
 #include <utility>
@@ -27,9 +29,11 @@
 #include <nautilus/val_ptr.hpp>
 #include <CompilationContext.hpp>
 #include <Engine.hpp>
+#include <ErrorHandling.hpp>
 #include <ExecutionContext.hpp>
 #include <PhysicalOperator.hpp>
 #include <Pipeline.hpp>
+#include <Thread.hpp>
 #include <function.hpp>
 #include <options.hpp>
 
@@ -39,11 +43,14 @@ namespace NES
 CompiledExecutablePipelineStage::CompiledExecutablePipelineStage(
     std::shared_ptr<Pipeline> pipeline,
     std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>> operatorHandlers,
-    nautilus::engine::Options options)
+    nautilus::engine::Options options,
+    const bool recompileWithProfile)
     : engine(std::move(options))
     , compiledPipelineFunction(nullptr)
     , operatorHandlers(std::move(operatorHandlers))
     , pipeline(std::move(pipeline))
+    , recompileWithProfile(recompileWithProfile)
+    , recompiledPipelineFunction(nullptr)
 {
 }
 
@@ -52,11 +59,55 @@ void CompiledExecutablePipelineStage::execute(const TupleBuffer& inputTupleBuffe
     /// we call the compiled pipeline function with an input buffer and the execution context
     pipelineExecutionContext.setOperatorHandlers(operatorHandlers);
     Arena arena(pipelineExecutionContext.getBufferManager());
+    if (isRecompiled.load(std::memory_order::acquire))
+    {
+        recompiledPipelineFunction(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(arena));
+        return;
+    }
     compiledPipelineFunction(std::addressof(pipelineExecutionContext), std::addressof(inputTupleBuffer), std::addressof(arena));
+
+    /// Exactly one task observes the end of the warm-up and starts the recompilation, if there is a profile to specialize the pipeline for
+    if (recompileWithProfile
+        and numberOfExecutedBuffers.fetch_add(1, std::memory_order::relaxed) + 1 == PROFILE_WARM_UP_NUMBER_OF_BUFFERS
+        and hasProfileForRecompilation())
+    {
+        recompilationThread = Thread("pipeline-recompilation", [this] { recompilePipeline(); });
+    }
+}
+
+bool CompiledExecutablePipelineStage::hasProfileForRecompilation() const
+{
+    for (std::optional<PhysicalOperator> physicalOperator = pipeline->getRootOperator(); physicalOperator.has_value();
+         physicalOperator = physicalOperator->getChild())
+    {
+        if (physicalOperator->hasProfileForRecompilation())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CompiledExecutablePipelineStage::hasRecompiledPipeline() const
+{
+    return isRecompiled.load(std::memory_order::acquire);
+}
+
+void CompiledExecutablePipelineStage::recompilePipeline()
+{
+    try
+    {
+        recompiledPipelineFunction = compilePipeline();
+        isRecompiled.store(true, std::memory_order::release);
+    }
+    catch (...)
+    {
+        /// The recompilation is solely an optimization. Thus, we keep executing the initially compiled pipeline.
+        tryLogCurrentException();
+    }
 }
 
-nautilus::engine::CallableFunction<void, PipelineExecutionContext*, const TupleBuffer*, const Arena*>
-CompiledExecutablePipelineStage::compilePipeline() const
+CompiledExecutablePipelineStage::CompiledPipelineFunction CompiledExecutablePipelineStage::compilePipeline() const
 {
     CPPTRACE_TRY
     {
@@ -101,6 +152,8 @@ CompiledExecutablePipelineStage::compilePipeline() const
 
 void CompiledExecutablePipelineStage::stop(PipelineExecutionContext& pipelineExecutionContext)
 {
+    /// Waits for a running recompilation, as it traces the operators that get terminated
+    recompilationThread = Thread();
     pipelineExecutionContext.setOperatorHandlers(operatorHandlers);
     Arena arena(pipelineExecutionContext.getBufferManager());
     ExecutionContext ctx(std::addressof(pipelineExecutionContext), std::addressof(arena));
@@ -0,0 +1,198 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <Pipelines/CompiledExecutablePipelineStage.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <Identifiers/Identifiers.hpp>
+#include <Nautilus/Interface/RecordBuffer.hpp>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/Execution/OperatorHandler.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+
+#include <BaseUnitTest.hpp>
+#include <CompilationContext.hpp>
+#include <ErrorHandling.hpp>
+#include <ExecutionContext.hpp>
+#include <PhysicalOperator.hpp>
+#include <Pipeline.hpp>
+#include <PipelineExecutionContext.hpp>
+#include <function.hpp>
+#include <options.hpp>
+#include <val.hpp>
+#include <val_ptr.hpp>
+
+namespace NES
+{
+
+/// Checks that a compiled pipeline stage swaps in a recompiled pipeline after the warm-up, if an operator of the pipeline has a profile.
+class CompiledExecutablePipelineStageTest : public Testing::BaseUnitTest
+{
+    struct MockedPipelineContext final : PipelineExecutionContext
+    {
+        bool emitBuffer(const TupleBuffer&, ContinuationPolicy) override
+        {
+            INVARIANT(false, "This function should not be called");
+            return false;
+        }
+
+        TupleBuffer allocateTupleBuffer() override { return bufferManager->getBufferBlocking(); }
+
+        [[nodiscard]] WorkerThreadId getId() const override { return INITIAL<WorkerThreadId>; }
+
+        [[nodiscard]] uint64_t getNumberOfWorkerThreads() const override { return 1; }
+
+        [[nodiscard]] std::shared_ptr<AbstractBufferProvider> getBufferManager() const override { return bufferManager; }
+
+        [[nodiscard]] PipelineId getPipelineId() const override { return PipelineId(1); }
+
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& getOperatorHandlers() override
+        {
+            return *operatorHandlers;
+        }
+
+        void setOperatorHandlers(std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>& opHandlers) override
+        {
+            operatorHandlers = &opHandlers;
+        }
+
+        explicit MockedPipelineContext(std::shared_ptr<BufferManager> bufferManager) : bufferManager(std::move(bufferManager)) { }
+
+        void repeatTask(const TupleBuffer&, std::chrono::milliseconds) override { INVARIANT(false, "This function should not be called"); }
+
+        std::shared_ptr<BufferManager> bufferManager;
+        std::unordered_map<OperatorHandlerId, std::shared_ptr<OperatorHandler>>* operatorHandlers = nullptr;
+    };
+
+    struct Executions
+    {
+        uint64_t numberOfExecutions = 0;
+        /// Number of executions before the code of the last execution was traced, which identifies the compilation that emitted the code
+        uint64_t numberOfExecutionsBeforeTrace = 0;
+    };
+
+    /// Root operator of the pipeline that records which compilation of the pipeline gets executed
+    struct ProfiledPhysicalOperator final : PhysicalOperatorConcept
+    {
+        ProfiledPhysicalOperator(const bool hasProfile, Executions* executions) : hasProfile(hasProfile), executions(executions) { }
+
+        void setup(ExecutionContext&, CompilationContext&) const override { }
+
+        void open(ExecutionContext&, RecordBuffer&) const override
+        {
+            /// Read while tracing, i.e., this value is a constant in the compiled code
+            const auto numberOfExecutionsBeforeTrace = executions->numberOfExecutions;
+            nautilus::invoke(
+                +[](Executions* executions, const uint64_t numberOfExecutionsBeforeTrace)
+                {
+                    ++executions->numberOfExecutions;
+                    executions->numberOfExecutionsBeforeTrace = numberOfExecutionsBeforeTrace;
+                },
+                nautilus::val<Executions*>(executions),
+                nautilus::val<uint64_t>(numberOfExecutionsBeforeTrace));
+        }
+
+        void close(ExecutionContext&, RecordBuffer&) const override { }
+
+        void terminate(ExecutionContext&) const override { }
+
+        [[nodiscard]] bool hasProfileForRecompilation() const override { return hasProfile; }
+
+        [[nodiscard]] std::optional<PhysicalOperator> getChild() const override { return std::nullopt; }
+
+        void setChild(PhysicalOperator) override { INVARIANT(false, "This function should not be called"); }
+
+        bool hasProfile;
+        Executions* executions;
+    };
+
+public:
+    static constexpr auto RECOMPILATION_TIMEOUT = std::chrono::seconds(60);
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("CompiledExecutablePipelineStageTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup CompiledExecutablePipelineStageTest test class.");
+    }
+
+    void SetUp() override { BaseUnitTest::SetUp(); }
+
+    std::unique_ptr<CompiledExecutablePipelineStage> createStage(const bool hasProfile)
+    {
+        auto pipeline = std::make_shared<Pipeline>(PhysicalOperator(ProfiledPhysicalOperator{hasProfile, &executions}));
+        nautilus::engine::Options options;
+        options.setOption("engine.Compilation", true);
+        options.setOption("mlir.enableMultithreading", false);
+        return std::make_unique<CompiledExecutablePipelineStage>(pipeline, pipeline->getOperatorHandlers(), options, true);
+    }
+
+    void execute(CompiledExecutablePipelineStage& stage, const uint64_t numberOfBuffers)
+    {
+        const auto buffer = bufferManager->getBufferBlocking();
+        for (uint64_t i = 0; i < numberOfBuffers; ++i)
+        {
+            stage.execute(buffer, pec);
+        }
+    }
+
+    std::shared_ptr<BufferManager> bufferManager = BufferManager::create(512, 10);
+    MockedPipelineContext pec{bufferManager};
+    Executions executions;
+};
+
+TEST_F(CompiledExecutablePipelineStageTest, SwapsInRecompiledPipelineWithProfile)
+{
+    const auto stage = createStage(true);
+    stage->start(pec);
+    execute(*stage, CompiledExecutablePipelineStage::PROFILE_WARM_UP_NUMBER_OF_BUFFERS);
+    EXPECT_EQ(executions.numberOfExecutionsBeforeTrace, 0UL);
+
+    const auto deadline = std::chrono::steady_clock::now() + RECOMPILATION_TIMEOUT;
+    while (not stage->hasRecompiledPipeline() and std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_TRUE(stage->hasRecompiledPipeline());
+
+    /// The recompilation traced the pipeline after the warm-up
+    execute(*stage, 1);
+    EXPECT_EQ(executions.numberOfExecutions, CompiledExecutablePipelineStage::PROFILE_WARM_UP_NUMBER_OF_BUFFERS + 1);
+    EXPECT_EQ(executions.numberOfExecutionsBeforeTrace, CompiledExecutablePipelineStage::PROFILE_WARM_UP_NUMBER_OF_BUFFERS);
+    stage->stop(pec);
+}
+
+TEST_F(CompiledExecutablePipelineStageTest, KeepsInitialPipelineWithoutProfile)
+{
+    const auto stage = createStage(false);
+    stage->start(pec);
+    execute(*stage, CompiledExecutablePipelineStage::PROFILE_WARM_UP_NUMBER_OF_BUFFERS + 1);
+    /// Waits for a recompilation, if one was started
+    stage->stop(pec);
+    EXPECT_FALSE(stage->hasRecompiledPipeline());
+    EXPECT_EQ(executions.numberOfExecutions, CompiledExecutablePipelineStage::PROFILE_WARM_UP_NUMBER_OF_BUFFERS + 1);
+    EXPECT_EQ(executions.numberOfExecutionsBeforeTrace, 0UL);
+}
+
+}
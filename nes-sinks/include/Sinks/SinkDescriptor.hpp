@@ -29,6 +29,7 @@
 #include <Configurations/Descriptor.hpp>
 #include <Configurations/Enums/EnumWrapper.hpp>
 #include <DataTypes/Schema.hpp>
+#include <Nautilus/Interface/BufferRef/LowerSchemaProvider.hpp>
 #include <Util/Logger/Formatter.hpp>
 #include <SerializableOperator.pb.h>
 
@@ -100,6 +101,14 @@ public:
         std::nullopt,
         [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FILE_PATH, config); }};
 
+    /// Well-known property for any sink that interprets the raw bytes of its input buffers.
+    /// Must match the memory layout of the sink's input, which is checked when lowering the sink.
+    /// NOLINTNEXTLINE(cert-err58-cpp)
+    static inline const DescriptorConfig::ConfigParameter<EnumWrapper, MemoryLayoutType> MEMORY_LAYOUT{
+        "memory_layout",
+        EnumWrapper(MemoryLayoutType::ROW_LAYOUT),
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(MEMORY_LAYOUT, config); }};
+
     static std::optional<DescriptorConfig::Config>
     validateAndFormatConfig(std::string_view sinkType, std::unordered_map<std::string, std::string> configPairs);
 
@@ -54,7 +54,8 @@ public:
     /// @return bool indicating if this logical source was registered by name and removed
     [[nodiscard]] bool removeLogicalSource(const LogicalSource& logicalSource);
 
-    /// @brief creates a new physical source and associates it with a logical source
+    /// @brief creates a new physical source and associates it with a logical source.
+    /// The first file source of a logical source that opts into grouping also reserves the id of the grouped source.
     /// @return nullopt if the logical source is not registered anymore, otherwise a source descriptor with an assigned id
     [[nodiscard]] std::optional<SourceDescriptor> addPhysicalSource(
         const LogicalSource& logicalSource,
@@ -83,6 +84,12 @@ public:
     /// @returns nullopt if the logical source is not registered anymore, else the set of source descriptors associated with it
     [[nodiscard]] std::optional<std::unordered_set<SourceDescriptor>> getPhysicalSources(const LogicalSource& logicalSource) const;
 
+    /// @brief groups all physical sources of a logical source into a single source descriptor, ordered by their physical source ids.
+    /// The grouped source descriptor keeps the physical source id that addPhysicalSource() reserved for the lifetime of the logical source.
+    /// @returns nullopt if the logical source is not registered anymore, has no physical sources, or if its physical sources are not all
+    /// file sources that opted in via the 'grouped' parameter and share the same parser config
+    [[nodiscard]] std::optional<SourceDescriptor> getGroupedPhysicalSource(const LogicalSource& logicalSource) const;
+
     [[nodiscard]] std::unordered_set<LogicalSource> getAllLogicalSources() const;
     [[nodiscard]] std::unordered_map<LogicalSource, std::unordered_set<SourceDescriptor>> getLogicalToPhysicalSourceMapping() const;
 
@@ -93,5 +100,7 @@ private:
     std::unordered_map<std::string, LogicalSource> namesToLogicalSourceMapping;
     std::unordered_map<PhysicalSourceId, SourceDescriptor> idsToPhysicalSources;
     std::unordered_map<LogicalSource, std::unordered_set<SourceDescriptor>> logicalToPhysicalSourceMapping;
+    /// Assigned by addPhysicalSource() for the first physical source of a logical source that opts into grouping
+    std::unordered_map<LogicalSource, PhysicalSourceId> groupedPhysicalSourceIds;
 };
 }
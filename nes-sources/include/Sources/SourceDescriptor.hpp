@@ -23,6 +23,7 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <Configurations/Descriptor.hpp>
 #include <Configurations/Enums/EnumWrapper.hpp>
@@ -73,6 +74,11 @@ public:
 
     [[nodiscard]] PhysicalSourceId getPhysicalSourceId() const;
 
+    /// A grouped source descriptor multiplexes the physical sources of a logical source behind a single source operator.
+    /// Its source type and parser config are shared by all grouped sources.
+    [[nodiscard]] bool isGrouped() const;
+    [[nodiscard]] const std::vector<SourceDescriptor>& getGroupedSources() const;
+
     [[nodiscard]] SerializableSourceDescriptor serialize() const;
     [[nodiscard]] std::string explain(ExplainVerbosity verbosity) const;
 
@@ -84,6 +90,7 @@ private:
     LogicalSource logicalSource;
     std::string sourceType;
     ParserConfig parserConfig;
+    std::vector<SourceDescriptor> groupedSources;
 
     /// Used by Sources to create a valid SourceDescriptor.
     explicit SourceDescriptor(
@@ -91,7 +98,8 @@ private:
         LogicalSource logicalSource,
         std::string_view sourceType,
         DescriptorConfig::Config config,
-        ParserConfig parserConfig);
+        ParserConfig parserConfig,
+        std::vector<SourceDescriptor> groupedSources = {});
 
 public:
     /// Per default, we set an 'invalid' number of max inflight buffers. We choose zero as an invalid number as giving zero buffers to a source would make it unusable.
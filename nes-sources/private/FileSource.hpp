@@ -19,6 +19,7 @@
 #include <fstream>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stop_token>
 #include <string>
 #include <string_view>
@@ -48,6 +49,10 @@ public:
 
     FillTupleBufferResult fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
 
+    /// Reads the next bytes of the file into the memory area, until the memory area is full or the file ends.
+    /// @return the number of bytes read, which is zero at the end of the file
+    size_t read(std::span<char> memoryArea);
+
     /// Open file socket.
     void open(std::shared_ptr<AbstractBufferProvider> bufferProvider) override;
     /// Close file socket.
@@ -71,8 +76,15 @@ struct ConfigParametersCSV
         std::nullopt,
         [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(FILEPATH, config); }};
 
+    /// Opts the file into being read by a single grouped source together with the other files of its logical source, if all of them
+    /// opted in and share their parser config
+    static inline const DescriptorConfig::ConfigParameter<bool> GROUPED{
+        "grouped",
+        false,
+        [](const std::unordered_map<std::string, std::string>& config) { return DescriptorConfig::tryGet(GROUPED, config); }};
+
     static inline std::unordered_map<std::string, DescriptorConfig::ConfigParameterContainer> parameterMap
-        = DescriptorConfig::createConfigParameterContainerMap(SourceDescriptor::parameterMap, FILEPATH);
+        = DescriptorConfig::createConfigParameterContainerMap(SourceDescriptor::parameterMap, FILEPATH, GROUPED);
 };
 
 }
@@ -0,0 +1,85 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <vector>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <FileSource.hpp>
+
+namespace NES
+{
+
+/// Multiplexes the file sources of a grouped SourceDescriptor behind a single source, i.e., a single SourceThread and origin id.
+/// It interleaves the files round-robin, one tuple buffer at a time, and reads each file directly into the tuple buffer. Thus, the files
+/// progress evenly, which keeps the timestamps of their tuples close together, instead of emitting one file after another.
+/// To never join the bytes of tuples of different files, each tuple buffer ends with a tuple delimiter. The bytes of the incomplete last
+/// tuple are kept and written to the start of the next tuple buffer of the same file. Only if a tuple does not fit into a tuple buffer,
+/// the next tuple buffer continues the same file. At most 'numberOfInterleavedFiles' files are open at the same time. Once a file ends,
+/// the next file in the order of the physical source ids takes its place.
+class GroupedSource final : public Source
+{
+public:
+    static constexpr size_t DEFAULT_NUMBER_OF_INTERLEAVED_FILES = 16;
+
+    GroupedSource(std::vector<std::unique_ptr<FileSource>> files, std::string tupleDelimiter, size_t numberOfInterleavedFiles);
+    ~GroupedSource() override = default;
+
+    GroupedSource(const GroupedSource&) = delete;
+    GroupedSource& operator=(const GroupedSource&) = delete;
+    GroupedSource(GroupedSource&&) = delete;
+    GroupedSource& operator=(GroupedSource&&) = delete;
+
+    /// Reads the next bytes of the next interleaved file into the tuple buffer.
+    FillTupleBufferResult fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token& stopToken) override;
+
+    /// Opens the first files.
+    void open(std::shared_ptr<AbstractBufferProvider> bufferProvider) override;
+    /// Closes all open files.
+    void close() override;
+
+    [[nodiscard]] std::ostream& toString(std::ostream& str) const override;
+
+private:
+    struct InterleavedFile
+    {
+        std::unique_ptr<FileSource> file;
+        /// Bytes of the last tuple of the previous tuple buffer of this file that did not end with a tuple delimiter
+        std::string incompleteTuple;
+        /// True, if the previous tuple buffer of this file did not contain any tuple delimiter
+        bool endedWithinTuple = false;
+    };
+
+    /// Opens the next files, until 'numberOfInterleavedFiles' files are open or all files have been opened.
+    void openNextFiles();
+
+    std::vector<std::unique_ptr<FileSource>> files;
+    std::string tupleDelimiter;
+    size_t numberOfInterleavedFiles;
+    std::shared_ptr<AbstractBufferProvider> bufferProvider;
+
+    size_t nextUnopenedFile = 0;
+    std::vector<InterleavedFile> interleavedFiles;
+    size_t nextInterleavedFile = 0;
+};
+
+}
@@ -15,6 +15,7 @@
 #include <FileSource.hpp>
 
 #include <cerrno>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <format>
@@ -23,6 +24,7 @@
 #include <istream>
 #include <memory>
 #include <ostream>
+#include <span>
 #include <stop_token>
 #include <string>
 #include <unordered_map>
@@ -63,10 +65,7 @@ void FileSource::close()
 
 Source::FillTupleBufferResult FileSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token&)
 {
-    this->inputFile.read(
-        tupleBuffer.getAvailableMemoryArea<std::istream::char_type>().data(), static_cast<std::streamsize>(tupleBuffer.getBufferSize()));
-    const auto numBytesRead = this->inputFile.gcount();
-    this->totalNumBytesRead += numBytesRead;
+    const auto numBytesRead = read(tupleBuffer.getAvailableMemoryArea<std::istream::char_type>());
     if (numBytesRead == 0)
     {
         return FillTupleBufferResult::eos();
@@ -74,6 +73,14 @@ Source::FillTupleBufferResult FileSource::fillTupleBuffer(TupleBuffer& tupleBuff
     return FillTupleBufferResult::withBytes(numBytesRead);
 }
 
+size_t FileSource::read(const std::span<char> memoryArea)
+{
+    this->inputFile.read(memoryArea.data(), static_cast<std::streamsize>(memoryArea.size()));
+    const auto numBytesRead = static_cast<size_t>(this->inputFile.gcount());
+    this->totalNumBytesRead += numBytesRead;
+    return numBytesRead;
+}
+
 DescriptorConfig::Config FileSource::validateAndFormat(std::unordered_map<std::string, std::string> config)
 {
     return DescriptorConfig::validateAndFormat<ConfigParametersCSV>(std::move(config), NAME);
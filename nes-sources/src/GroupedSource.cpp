@@ -0,0 +1,130 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+
+#include <GroupedSource.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <Runtime/AbstractBufferProvider.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/Source.hpp>
+#include <fmt/format.h>
+#include <ErrorHandling.hpp>
+#include <FileSource.hpp>
+
+namespace NES
+{
+
+GroupedSource::GroupedSource(
+    std::vector<std::unique_ptr<FileSource>> files, std::string tupleDelimiter, const size_t numberOfInterleavedFiles)
+    : files(std::move(files)), tupleDelimiter(std::move(tupleDelimiter)), numberOfInterleavedFiles(numberOfInterleavedFiles)
+{
+    PRECONDITION(not this->files.empty(), "A grouped source requires at least one file");
+    PRECONDITION(not this->tupleDelimiter.empty(), "A grouped source requires a tuple delimiter");
+    PRECONDITION(numberOfInterleavedFiles > 0, "A grouped source requires at least one interleaved file");
+}
+
+void GroupedSource::open(std::shared_ptr<AbstractBufferProvider> bufferProvider)
+{
+    this->bufferProvider = std::move(bufferProvider);
+    openNextFiles();
+}
+
+void GroupedSource::close()
+{
+    for (const auto& interleavedFile : interleavedFiles)
+    {
+        interleavedFile.file->close();
+    }
+    interleavedFiles.clear();
+}
+
+void GroupedSource::openNextFiles()
+{
+    while (interleavedFiles.size() < numberOfInterleavedFiles and nextUnopenedFile < files.size())
+    {
+        auto& file = files[nextUnopenedFile++];
+        file->open(bufferProvider);
+        interleavedFiles.emplace_back(InterleavedFile{.file = std::move(file)});
+    }
+}
+
+Source::FillTupleBufferResult GroupedSource::fillTupleBuffer(TupleBuffer& tupleBuffer, const std::stop_token&)
+{
+    const auto memoryArea = tupleBuffer.getAvailableMemoryArea<char>();
+    openNextFiles();
+    while (not interleavedFiles.empty())
+    {
+        nextInterleavedFile %= interleavedFiles.size();
+        auto& interleavedFile = interleavedFiles[nextInterleavedFile];
+
+        /// The incomplete tuple always leaves space for a tuple delimiter, as it followed a tuple delimiter in a tuple buffer
+        const auto numberOfKeptBytes = interleavedFile.incompleteTuple.size();
+        INVARIANT(
+            numberOfKeptBytes + tupleDelimiter.size() <= memoryArea.size(), "The incomplete tuple does not fit into the tuple buffer");
+        std::ranges::copy(interleavedFile.incompleteTuple, memoryArea.begin());
+        interleavedFile.incompleteTuple.clear();
+        const auto numberOfReadBytes = interleavedFile.file->read(memoryArea.subspan(numberOfKeptBytes));
+
+        if (numberOfReadBytes == 0)
+        {
+            /// The file ended. If it did not end with a tuple delimiter, we complete its last tuple before continuing with another file.
+            const auto completeLastTuple = numberOfKeptBytes > 0 or interleavedFile.endedWithinTuple;
+            interleavedFile.file->close();
+            interleavedFiles.erase(interleavedFiles.begin() + static_cast<std::ptrdiff_t>(nextInterleavedFile));
+            openNextFiles();
+            if (completeLastTuple)
+            {
+                std::ranges::copy(tupleDelimiter, memoryArea.begin() + static_cast<std::ptrdiff_t>(numberOfKeptBytes));
+                return FillTupleBufferResult::withBytes(numberOfKeptBytes + tupleDelimiter.size());
+            }
+            continue;
+        }
+
+        const std::string_view bytes{memoryArea.data(), numberOfKeptBytes + numberOfReadBytes};
+        const auto lastTupleDelimiter = bytes.rfind(tupleDelimiter);
+        interleavedFile.endedWithinTuple = lastTupleDelimiter == std::string_view::npos;
+        if (interleavedFile.endedWithinTuple)
+        {
+            /// The tuple does not fit into the tuple buffer. Thus, the next tuple buffer must continue this file.
+            return FillTupleBufferResult::withBytes(bytes.size());
+        }
+
+        const auto endOfLastTuple = lastTupleDelimiter + tupleDelimiter.size();
+        interleavedFile.incompleteTuple = bytes.substr(endOfLastTuple);
+        ++nextInterleavedFile;
+        return FillTupleBufferResult::withBytes(endOfLastTuple);
+    }
+    return FillTupleBufferResult::eos();
+}
+
+std::ostream& GroupedSource::toString(std::ostream& str) const
+{
+    str << fmt::format(
+        "\nGroupedSource(numberOfFiles: {}, numberOfInterleavedFiles: {}, numberOfOpenFiles: {})",
+        files.size(),
+        numberOfInterleavedFiles,
+        interleavedFiles.size());
+    return str;
+}
+
+}
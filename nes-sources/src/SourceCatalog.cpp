@@ -14,6 +14,7 @@
 
 #include <Sources/SourceCatalog.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -24,6 +25,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <DataTypes/Schema.hpp>
 #include <Identifiers/Identifiers.hpp>
@@ -32,10 +34,19 @@
 #include <Sources/SourceValidationProvider.hpp>
 #include <Util/Logger/Logger.hpp>
 #include <ErrorHandling.hpp>
+#include <FileSource.hpp>
 #include <InputFormatterTupleBufferRefProvider.hpp>
 
 namespace NES
 {
+namespace
+{
+/// Grouping is opt-in and restricted to bounded file sources, as the grouped source interleaves the files at tuple boundaries
+bool isGroupedFileSource(const SourceDescriptor& source)
+{
+    return source.getSourceType() == FileSource::NAME and source.tryGetFromConfig(ConfigParametersCSV::GROUPED).value_or(false);
+}
+}
 
 std::optional<LogicalSource> SourceCatalog::addLogicalSource(const std::string& logicalSourceName, const Schema& schema)
 {
@@ -95,6 +106,12 @@ std::optional<SourceDescriptor> SourceCatalog::addPhysicalSource(
     SourceDescriptor descriptor{id, logicalSource, sourceType, std::move(descriptorConfigOpt.value()), parserConfigObject};
     idsToPhysicalSources.emplace(id, descriptor);
     logicalPhysicalIter->second.insert(descriptor);
+
+    /// The grouped source keeps its id for the lifetime of the logical source. Thus, we assign it with the first source that opts in.
+    if (isGroupedFileSource(descriptor))
+    {
+        groupedPhysicalSourceIds.try_emplace(logicalSource, PhysicalSourceId{nextPhysicalSourceId.fetch_add(1)});
+    }
     NES_DEBUG("Successfully registered new physical source of type {} with id {}", descriptor.getSourceType(), id);
     return descriptor;
 }
@@ -172,6 +189,49 @@ std::optional<std::unordered_set<SourceDescriptor>> SourceCatalog::getPhysicalSo
     return std::nullopt;
 }
 
+std::optional<SourceDescriptor> SourceCatalog::getGroupedPhysicalSource(const LogicalSource& logicalSource) const
+{
+    const std::unique_lock lock(catalogMutex);
+    const auto found = logicalToPhysicalSourceMapping.find(logicalSource);
+    if (found == logicalToPhysicalSourceMapping.end() or found->second.empty())
+    {
+        return std::nullopt;
+    }
+
+    /// Source descriptors are not assignable, thus, we sort their ids instead
+    auto ids = found->second | std::views::transform([](const auto& source) { return source.getPhysicalSourceId(); })
+        | std::ranges::to<std::vector>();
+    std::ranges::sort(ids);
+    std::vector<SourceDescriptor> groupedSources;
+    groupedSources.reserve(ids.size());
+    for (const auto id : ids)
+    {
+        groupedSources.emplace_back(idsToPhysicalSources.at(id));
+    }
+
+    const auto& firstSource = groupedSources.front();
+    const auto groupable = std::ranges::all_of(
+        groupedSources,
+        [&firstSource](const SourceDescriptor& source)
+        { return isGroupedFileSource(source) and source.parserConfig == firstSource.parserConfig; });
+    if (not groupable)
+    {
+        NES_DEBUG(
+            "Cannot group the physical sources of logical source \"{}\", as they are not all grouped file sources with the same parser "
+            "config",
+            logicalSource.getLogicalSourceName());
+        return std::nullopt;
+    }
+
+    /// All physical sources opted in, thus, addPhysicalSource() has assigned the id of the grouped source
+    const auto groupId = groupedPhysicalSourceIds.at(logicalSource);
+    DescriptorConfig::Config config{
+        {SourceDescriptor::MAX_INFLIGHT_BUFFERS.name, firstSource.getFromConfig(SourceDescriptor::MAX_INFLIGHT_BUFFERS)}};
+    auto sourceType = firstSource.sourceType;
+    auto parserConfig = firstSource.parserConfig;
+    return SourceDescriptor{groupId, logicalSource, sourceType, std::move(config), std::move(parserConfig), std::move(groupedSources)};
+}
+
 bool SourceCatalog::removeLogicalSource(const LogicalSource& logicalSource)
 {
     const std::unique_lock lock(catalogMutex);
@@ -199,6 +259,7 @@ bool SourceCatalog::removeLogicalSource(const LogicalSource& logicalSource)
     }
 
     logicalToPhysicalSourceMapping.erase(logicalSource);
+    groupedPhysicalSourceIds.erase(logicalSource);
     NES_DEBUG("Removed logical source \"{}\"", logicalSource.getLogicalSourceName());
     return true;
 }
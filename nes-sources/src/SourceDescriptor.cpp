@@ -20,6 +20,7 @@
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 #include <Configurations/Descriptor.hpp>
 #include <Identifiers/Identifiers.hpp>
 #include <Serialization/SchemaSerializationUtil.hpp>
@@ -80,12 +81,14 @@ SourceDescriptor::SourceDescriptor(
     LogicalSource logicalSource,
     std::string_view sourceType,
     DescriptorConfig::Config config,
-    ParserConfig parserConfig)
+    ParserConfig parserConfig,
+    std::vector<SourceDescriptor> groupedSources)
     : Descriptor(std::move(config))
     , physicalSourceId(physicalSourceId)
     , logicalSource(std::move(logicalSource))
     , sourceType(std::move(sourceType))
     , parserConfig(std::move(parserConfig))
+    , groupedSources(std::move(groupedSources))
 {
 }
 
@@ -109,6 +112,16 @@ PhysicalSourceId SourceDescriptor::getPhysicalSourceId() const
     return physicalSourceId;
 }
 
+bool SourceDescriptor::isGrouped() const
+{
+    return not groupedSources.empty();
+}
+
+const std::vector<SourceDescriptor>& SourceDescriptor::getGroupedSources() const
+{
+    return groupedSources;
+}
+
 std::weak_ordering operator<=>(const SourceDescriptor& lhs, const SourceDescriptor& rhs)
 {
     return lhs.physicalSourceId <=> rhs.physicalSourceId;
@@ -132,13 +145,14 @@ std::ostream& operator<<(std::ostream& out, const SourceDescriptor& descriptor)
 {
     return out << fmt::format(
                "SourceDescriptor(sourceId: {}, sourceType: {}, logicalSource:{}, parserConfig: {{type: {}, tupleDelimiter: {}, "
-               "stringDelimiter: {} }})",
+               "stringDelimiter: {} }}, numberOfGroupedSources: {})",
                descriptor.getPhysicalSourceId(),
                descriptor.getSourceType(),
                descriptor.getLogicalSource(),
                descriptor.getParserConfig().parserType,
                escapeSpecialCharacters(descriptor.getParserConfig().tupleDelimiter),
-               escapeSpecialCharacters(descriptor.getParserConfig().fieldDelimiter));
+               escapeSpecialCharacters(descriptor.getParserConfig().fieldDelimiter),
+               descriptor.groupedSources.size());
 }
 
 SerializableSourceDescriptor SourceDescriptor::serialize() const
@@ -163,6 +177,11 @@ SerializableSourceDescriptor SourceDescriptor::serialize() const
         auto* kv = serializableSourceDescriptor.mutable_config();
         kv->emplace(key, descriptorConfigTypeToProto(value));
     }
+
+    for (const auto& groupedSource : groupedSources)
+    {
+        *serializableSourceDescriptor.add_groupedsources() = groupedSource.serialize();
+    }
     return serializableSourceDescriptor;
 }
 }
@@ -15,19 +15,37 @@
 #include <Sources/SourceProvider.hpp>
 
 #include <memory>
+#include <ranges>
 #include <string>
 #include <utility>
+#include <vector>
 #include <Identifiers/Identifiers.hpp>
 #include <Runtime/AbstractBufferProvider.hpp>
+#include <Sources/Source.hpp>
 #include <Sources/SourceDescriptor.hpp>
 #include <Sources/SourceHandle.hpp>
 #include <BackpressureChannel.hpp>
 #include <ErrorHandling.hpp>
+#include <FileSource.hpp>
+#include <GroupedSource.hpp>
 #include <SourceRegistry.hpp>
 
 namespace NES
 {
 
+namespace
+{
+std::unique_ptr<Source> createSource(const SourceDescriptor& sourceDescriptor)
+{
+    auto sourceArguments = SourceRegistryArguments(sourceDescriptor);
+    if (auto source = SourceRegistry::instance().create(sourceDescriptor.getSourceType(), sourceArguments))
+    {
+        return std::move(source.value());
+    }
+    throw UnknownSourceType("unknown source descriptor type: {}", sourceDescriptor.getSourceType());
+}
+}
+
 SourceProvider::SourceProvider(size_t defaultMaxInflightBuffers, std::shared_ptr<AbstractBufferProvider> bufferPool)
     : defaultMaxInflightBuffers(defaultMaxInflightBuffers), bufferPool(std::move(bufferPool))
 {
@@ -37,20 +55,30 @@ std::unique_ptr<SourceHandle>
 SourceProvider::lower(OriginId originId, BackpressureListener backpressureListener, const SourceDescriptor& sourceDescriptor) const
 {
     /// Todo #241: Get the new source identfier from the source descriptor and pass it to SourceHandle.
-    auto sourceArguments = SourceRegistryArguments(sourceDescriptor);
-    if (auto source = SourceRegistry::instance().create(sourceDescriptor.getSourceType(), sourceArguments))
+    auto source = [&sourceDescriptor]() -> std::unique_ptr<Source>
     {
-        /// The source-specific configuration of maxInflightBuffers takes priority.
-        /// If not specified (0), we take the NodeEngine-wide configuration.
-        const auto maxInflightBuffers = (sourceDescriptor.getFromConfig(SourceDescriptor::MAX_INFLIGHT_BUFFERS) > 0)
-            ? sourceDescriptor.getFromConfig(SourceDescriptor::MAX_INFLIGHT_BUFFERS)
-            : defaultMaxInflightBuffers;
-        SourceRuntimeConfiguration runtimeConfig{maxInflightBuffers};
-
-        return std::make_unique<SourceHandle>(
-            std::move(backpressureListener), std::move(originId), std::move(runtimeConfig), bufferPool, std::move(source.value()));
-    }
-    throw UnknownSourceType("unknown source descriptor type: {}", sourceDescriptor.getSourceType());
+        if (sourceDescriptor.isGrouped())
+        {
+            /// The SourceCatalog solely groups file sources
+            auto files = sourceDescriptor.getGroupedSources()
+                | std::views::transform([](const SourceDescriptor& groupedSourceDescriptor)
+                                        { return std::make_unique<FileSource>(groupedSourceDescriptor); })
+                | std::ranges::to<std::vector>();
+            return std::make_unique<GroupedSource>(
+                std::move(files), sourceDescriptor.getParserConfig().tupleDelimiter, GroupedSource::DEFAULT_NUMBER_OF_INTERLEAVED_FILES);
+        }
+        return createSource(sourceDescriptor);
+    }();
+
+    /// The source-specific configuration of maxInflightBuffers takes priority.
+    /// If not specified (0), we take the NodeEngine-wide configuration.
+    const auto maxInflightBuffers = (sourceDescriptor.getFromConfig(SourceDescriptor::MAX_INFLIGHT_BUFFERS) > 0)
+        ? sourceDescriptor.getFromConfig(SourceDescriptor::MAX_INFLIGHT_BUFFERS)
+        : defaultMaxInflightBuffers;
+    SourceRuntimeConfiguration runtimeConfig{maxInflightBuffers};
+
+    return std::make_unique<SourceHandle>(
+        std::move(backpressureListener), std::move(originId), std::move(runtimeConfig), bufferPool, std::move(source));
 }
 
 bool SourceProvider::contains(const std::string& sourceType) const ///NOLINT(readability-convert-member-functions-to-static)
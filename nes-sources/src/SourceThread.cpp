@@ -93,7 +93,9 @@ SourceImplementationTermination dataSourceThreadRoutine(
     };
 
     const bool requiresMetadata = !source.addsMetadata();
-    while (backpressureListener.wait(stopToken), !stopToken.stop_requested())
+    /// The source thread owns the reference counters of the buffers it obtained. It gives up the ownership before every blocking wait,
+    /// so that buffers which it emitted and which were released downstream are recycled while it waits.
+    while (releaseBufferOwnership(), backpressureListener.wait(stopToken), !stopToken.stop_requested())
     {
         /// 4 Things that could happen:
         /// 1. Happy Path: Source produces a tuple buffer and emit is called. The loop continues.
@@ -114,6 +116,8 @@ SourceImplementationTermination dataSourceThreadRoutine(
             return {SourceImplementationTermination::StopRequested};
         }
 
+        /// Sources might block until data arrives, e.g., TCP or MQTT sources
+        releaseBufferOwnership();
         const auto fillTupleResult = source.fillTupleBuffer(*emptyBuffer, stopToken);
 
         if (!fillTupleResult.isEoS())
@@ -0,0 +1,167 @@
+/*
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        https://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <DataTypes/DataType.hpp>
+#include <DataTypes/DataTypeProvider.hpp>
+#include <DataTypes/Schema.hpp>
+#include <Runtime/BufferManager.hpp>
+#include <Runtime/TupleBuffer.hpp>
+#include <Sources/SourceCatalog.hpp>
+#include <Util/Logger/LogLevel.hpp>
+#include <Util/Logger/Logger.hpp>
+#include <Util/Logger/impl/NesLogger.hpp>
+#include <gtest/gtest.h>
+#include <BaseUnitTest.hpp>
+#include <FileSource.hpp>
+#include <GroupedSource.hpp>
+
+namespace NES
+{
+
+class GroupedSourceTest : public Testing::BaseUnitTest
+{
+public:
+    /// Small tuple buffers force the grouped source to split the files into several tuple buffers
+    static constexpr size_t BUFFER_SIZE = 8;
+
+    static void SetUpTestSuite()
+    {
+        Logger::setupLogging("GroupedSourceTest.log", LogLevel::LOG_DEBUG);
+        NES_DEBUG("Setup GroupedSourceTest class.");
+    }
+
+    void SetUp() override
+    {
+        BaseUnitTest::SetUp();
+        testDirectory = std::filesystem::temp_directory_path()
+            / ("GroupedSourceTest_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::create_directories(testDirectory);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDirectory);
+        BaseUnitTest::TearDown();
+    }
+
+    /// Writes the contents to files and creates a grouped source of file sources that read them in the given order
+    std::unique_ptr<GroupedSource> createGroupedSource(const std::vector<std::string_view>& contents, const size_t numberOfInterleavedFiles)
+    {
+        auto schema = Schema{};
+        schema.addField("value", DataTypeProvider::provideDataType(DataType::Type::UINT64));
+        const auto logicalSource = sourceCatalog.addLogicalSource("testSource", schema);
+        EXPECT_TRUE(logicalSource.has_value());
+
+        std::vector<std::unique_ptr<FileSource>> files;
+        for (size_t i = 0; i < contents.size(); ++i)
+        {
+            const auto filePath = testDirectory / ("file" + std::to_string(i) + ".csv");
+            std::ofstream(filePath, std::ios::binary) << contents[i];
+            const auto sourceDescriptor = sourceCatalog.addPhysicalSource(
+                logicalSource.value(), FileSource::NAME, {{"file_path", filePath.string()}}, {{"type", "CSV"}});
+            EXPECT_TRUE(sourceDescriptor.has_value());
+            files.emplace_back(std::make_unique<FileSource>(sourceDescriptor.value()));
+        }
+        return std::make_unique<GroupedSource>(std::move(files), "\n", numberOfInterleavedFiles);
+    }
+
+    /// Fills a buffer and returns its content or an empty optional at the end of the stream
+    static std::optional<std::string> read(GroupedSource& groupedSource, AbstractBufferProvider& bufferProvider)
+    {
+        auto buffer = bufferProvider.getBufferBlocking();
+        const auto result = groupedSource.fillTupleBuffer(buffer, std::stop_token{});
+        if (result.isEoS())
+        {
+            return std::nullopt;
+        }
+        return std::string(buffer.getAvailableMemoryArea<char>().data(), result.getNumberOfBytes());
+    }
+
+private:
+    SourceCatalog sourceCatalog;
+    std::filesystem::path testDirectory;
+};
+
+/// clang tidy doesn't recognize the .has_value in the ASSERT_TRUE
+/// NOLINTBEGIN(bugprone-unchecked-optional-access)
+TEST_F(GroupedSourceTest, interleavesFilesRoundRobinAtTupleBoundaries)
+{
+    const auto bufferManager = BufferManager::create(BUFFER_SIZE, 16);
+    const auto groupedSource = createGroupedSource({"a1\na2\na3\n", "b1\nb2\n"}, 2);
+    groupedSource->open(bufferManager);
+
+    /// The incomplete tuple 'a3' is kept and continued in the next tuple buffer of the first file
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "a1\na2\n");
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "b1\nb2\n");
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "a3\n");
+    EXPECT_FALSE(read(*groupedSource, *bufferManager).has_value());
+    groupedSource->close();
+}
+
+TEST_F(GroupedSourceTest, completesLastTupleWithoutTupleDelimiter)
+{
+    const auto bufferManager = BufferManager::create(BUFFER_SIZE, 16);
+    const auto groupedSource = createGroupedSource({"1\n2", "3\n"}, 2);
+    groupedSource->open(bufferManager);
+
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "1\n");
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "3\n");
+    /// The first file did not end with a tuple delimiter, which must not join its last tuple with a tuple of another file
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "2\n");
+    EXPECT_FALSE(read(*groupedSource, *bufferManager).has_value());
+    groupedSource->close();
+}
+
+TEST_F(GroupedSourceTest, continuesFileIfTupleExceedsTupleBuffer)
+{
+    const auto bufferManager = BufferManager::create(BUFFER_SIZE, 16);
+    const auto groupedSource = createGroupedSource({"abcdefghij\nk\n", "b\n"}, 2);
+    groupedSource->open(bufferManager);
+
+    /// The first tuple does not fit into a tuple buffer. Thus, the second tuple buffer must continue the first file.
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "abcdefgh");
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "ij\nk\n");
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "b\n");
+    EXPECT_FALSE(read(*groupedSource, *bufferManager).has_value());
+    groupedSource->close();
+}
+
+TEST_F(GroupedSourceTest, boundsNumberOfInterleavedFiles)
+{
+    const auto bufferManager = BufferManager::create(BUFFER_SIZE, 16);
+    const auto groupedSource = createGroupedSource({"a1\na2\na3\n", "b1\n", "c1\n"}, 2);
+    groupedSource->open(bufferManager);
+
+    /// The third file only takes the place of the second file once the second file ended
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "a1\na2\n");
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "b1\n");
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "a3\n");
+    EXPECT_EQ(read(*groupedSource, *bufferManager), "c1\n");
+    EXPECT_FALSE(read(*groupedSource, *bufferManager).has_value());
+    groupedSource->close();
+}
+
+/// NOLINTEND(bugprone-unchecked-optional-access)
+
+}
@@ -123,6 +123,51 @@ TEST_F(SourceCatalogTest, AddInvalidPhysicalSource)
     ASSERT_FALSE(physical1Opt.has_value());
 }
 
+TEST_F(SourceCatalogTest, GroupPhysicalSources)
+{
+    auto sourceCatalog = SourceCatalog{};
+    auto schema = Schema{};
+    schema.addField("intField", DataTypeProvider::provideDataType(DataType::Type::INT32));
+
+    const auto sourceOpt = sourceCatalog.addLogicalSource("testSource", schema);
+    ASSERT_TRUE(sourceOpt.has_value());
+    ASSERT_FALSE(sourceCatalog.getGroupedPhysicalSource(*sourceOpt).has_value());
+
+    /// Grouping is opt-in
+    const auto ungroupedOpt = sourceCatalog.addPhysicalSource(*sourceOpt, "File", {{"file_path", "/dev/null"}}, {{"type", "CSV"}});
+    ASSERT_TRUE(ungroupedOpt.has_value());
+    ASSERT_FALSE(sourceCatalog.getGroupedPhysicalSource(*sourceOpt).has_value());
+    ASSERT_TRUE(sourceCatalog.removePhysicalSource(*ungroupedOpt));
+
+    const auto physical1Opt
+        = sourceCatalog.addPhysicalSource(*sourceOpt, "File", {{"file_path", "/dev/null"}, {"grouped", "true"}}, {{"type", "CSV"}});
+    const auto physical2Opt
+        = sourceCatalog.addPhysicalSource(*sourceOpt, "File", {{"file_path", "/dev/zero"}, {"grouped", "true"}}, {{"type", "CSV"}});
+    ASSERT_TRUE(physical1Opt.has_value());
+    ASSERT_TRUE(physical2Opt.has_value());
+
+    const auto groupedOpt = sourceCatalog.getGroupedPhysicalSource(*sourceOpt);
+    ASSERT_TRUE(groupedOpt.has_value());
+    ASSERT_TRUE(groupedOpt->isGrouped());
+    ASSERT_FALSE(physical1Opt->isGrouped());
+    ASSERT_EQ(groupedOpt->getSourceType(), "File");
+    ASSERT_EQ(groupedOpt->getParserConfig(), physical1Opt->getParserConfig());
+    ASSERT_EQ(groupedOpt->getLogicalSource(), *sourceOpt);
+    ASSERT_THAT(groupedOpt->getGroupedSources(), testing::ElementsAre(*physical1Opt, *physical2Opt));
+    ASSERT_FALSE(sourceCatalog.getPhysicalSource(groupedOpt->getPhysicalSourceId()).has_value());
+
+    /// The grouped source keeps its id across calls
+    const auto groupedAgainOpt = sourceCatalog.getGroupedPhysicalSource(*sourceOpt);
+    ASSERT_TRUE(groupedAgainOpt.has_value());
+    ASSERT_EQ(groupedAgainOpt->getPhysicalSourceId(), groupedOpt->getPhysicalSourceId());
+
+    /// Physical sources with different parser configs can not share a single input formatter
+    const auto physical3Opt = sourceCatalog.addPhysicalSource(
+        *sourceOpt, "File", {{"file_path", "/dev/null"}, {"grouped", "true"}}, {{"type", "CSV"}, {"field_delimiter", ";"}});
+    ASSERT_TRUE(physical3Opt.has_value());
+    ASSERT_FALSE(sourceCatalog.getGroupedPhysicalSource(*sourceOpt).has_value());
+}
+
 TEST_F(SourceCatalogTest, RemoveLogicalSource)
 {
     auto sourceCatalog = SourceCatalog{};